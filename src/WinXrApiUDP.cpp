@@ -41,11 +41,12 @@ void WinXrApiUDP::ReceiveData()
 	{
 		try
 		{
-			char buffer[1024];
+			// Room for both hands' joint sections on top of the ~250 byte pose packet
+			char buffer[4096];
 			int addrLen = sizeof(clientAddr);
 			ptrdiff_t bytesReceived = recvfrom(udpSocket, buffer, sizeof(buffer), 0, (struct sockaddr*)&clientAddr, &addrLen);
 
-			if (bytesReceived > 0 && bytesReceived < 1024)
+			if (bytesReceived > 0 && bytesReceived < (ptrdiff_t)sizeof(buffer))
 			{
 				buffer[bytesReceived] = '\0';
 				std::string returnData(buffer);
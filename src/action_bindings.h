@@ -0,0 +1,138 @@
+// Action binding compiler for OpenXR WXR
+// Turns suggested binding paths (or, failing that, action names) into one input channel per hand, once, so queries are a table read
+#pragma once
+
+#include <openxr/openxr.h>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+
+namespace bindings {
+
+// Controller inputs the UDP feed can drive
+enum class Input : uint8_t {
+    None = 0,
+    Trigger,
+    Squeeze,
+    Menu,
+    Primary,          // A / X
+    Secondary,        // B / Y
+    Thumbstick,       // 2D
+    ThumbstickX,
+    ThumbstickY,
+    ThumbstickClick,
+    Pose,
+    TriggerTouch,
+    ThumbstickTouch,
+    PrimaryTouch,
+    SecondaryTouch,
+    ThumbrestTouch,
+};
+
+enum Hand : uint8_t {
+    kHandAny = 0,
+    kHandLeft = 1,
+    kHandRight = 2,
+};
+
+struct Binding {
+    Input input{ Input::None };
+    Hand hand{ kHandAny };
+};
+
+// "/user/hand/<side>/input/<identifier>[/<component>]", for profiles without a table. Outputs (haptics) and inputs
+// the feed doesn't carry yield false.
+inline bool ParseBindingPath(std::string_view path, Binding& out) {
+    constexpr std::string_view kLeft = "/user/hand/left/input/";
+    constexpr std::string_view kRight = "/user/hand/right/input/";
+    Hand hand;
+    if (path.substr(0, kLeft.size()) == kLeft) {
+        hand = kHandLeft;
+        path.remove_prefix(kLeft.size());
+    }
+    else if (path.substr(0, kRight.size()) == kRight) {
+        hand = kHandRight;
+        path.remove_prefix(kRight.size());
+    }
+    else {
+        return false;
+    }
+
+    size_t slash = path.find('/');
+    std::string_view identifier = path.substr(0, slash);
+    std::string_view component = slash == std::string_view::npos ? std::string_view() : path.substr(slash + 1);
+    Input input = Input::None;
+    if (component == "touch") {
+        if (identifier == "trigger") input = Input::TriggerTouch;
+        else if (identifier == "thumbstick") input = Input::ThumbstickTouch;
+        else if (identifier == "a" || identifier == "x") input = Input::PrimaryTouch;
+        else if (identifier == "b" || identifier == "y") input = Input::SecondaryTouch;
+        else if (identifier == "thumbrest") input = Input::ThumbrestTouch;
+    }
+    else if (identifier == "trigger" || identifier == "select") input = Input::Trigger;
+    else if (identifier == "squeeze") input = Input::Squeeze;
+    else if (identifier == "menu" || identifier == "system") input = Input::Menu;
+    else if (identifier == "a" || identifier == "x") input = Input::Primary;
+    else if (identifier == "b" || identifier == "y") input = Input::Secondary;
+    else if (identifier == "thumbstick" || identifier == "trackpad") {
+        if (component == "click") input = Input::ThumbstickClick;
+        else if (component == "x") input = Input::ThumbstickX;
+        else if (component == "y") input = Input::ThumbstickY;
+        else input = Input::Thumbstick;
+    }
+    else if (identifier == "grip" || identifier == "aim") input = Input::Pose;
+    if (input == Input::None) return false;
+
+    out.input = input;
+    out.hand = hand;
+    return true;
+}
+
+inline bool ContainsNoCase(std::string_view haystack, std::string_view needle) {
+    if (needle.size() > haystack.size()) return false;
+    for (size_t i = 0; i + needle.size() <= haystack.size(); ++i) {
+        size_t j = 0;
+        while (j < needle.size()) {
+            char c = haystack[i + j];
+            if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+            if (c != needle[j]) break;
+            ++j;
+        }
+        if (j == needle.size()) return true;
+    }
+    return false;
+}
+
+// Fallback for actions the app gave no usable binding for: guess from the action name (needles are lowercase)
+inline Input GuessInput(std::string_view name, XrActionType type) {
+    auto any = [&](std::initializer_list<std::string_view> needles) {
+        for (std::string_view n : needles) {
+            if (ContainsNoCase(name, n)) return true;
+        }
+        return false;
+    };
+    switch (type) {
+    case XR_ACTION_TYPE_BOOLEAN_INPUT:
+        if (any({ "trigger", "select", "fire" })) return Input::Trigger;
+        if (any({ "grip", "squeeze", "grab" })) return Input::Squeeze;
+        if (any({ "menu" })) return Input::Menu;
+        if (any({ "primary", "a_button", "x_button" })) return Input::Primary;
+        if (any({ "secondary", "b_button", "y_button" })) return Input::Secondary;
+        if (any({ "thumbstick", "joystick" })) return Input::ThumbstickClick;
+        return Input::None;
+    case XR_ACTION_TYPE_FLOAT_INPUT:
+        if (any({ "trigger", "select", "fire" })) return Input::Trigger;
+        if (any({ "grip", "squeeze", "grab" })) return Input::Squeeze;
+        return Input::None;
+    case XR_ACTION_TYPE_VECTOR2F_INPUT:
+        if (any({ "thumbstick", "joystick", "move", "turn" })) return Input::Thumbstick;
+        return Input::None;
+    case XR_ACTION_TYPE_POSE_INPUT:
+        return Input::Pose;
+    default:
+        return Input::None;
+    }
+}
+
+} // namespace bindings
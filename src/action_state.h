@@ -0,0 +1,80 @@
+// Action state synchronisation for OpenXR WXR
+// Controller input is published once per frame into a triple buffer; xrSyncActions takes one consistent copy and derives per-action change state from it
+#pragma once
+
+#include <openxr/openxr.h>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace actstate {
+
+// Single writer, single reader, neither ever blocks: the writer fills Back() and publishes it,
+// the reader picks up the newest published buffer and keeps it until it asks again.
+template <typename T>
+class TripleBuffer {
+public:
+    T& Back() { return buffers_[back_]; }
+
+    void Publish() {
+        back_ = middle_.exchange((uint8_t)(back_ | kFresh), std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    const T& Latest() {
+        if (middle_.load(std::memory_order_relaxed) & kFresh) {
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+        }
+        return buffers_[front_];
+    }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFresh = 0x4;
+
+    T buffers_[3]{};
+    uint8_t back_{ 0 };
+    std::atomic<uint8_t> middle_{ 1 };
+    uint8_t front_{ 2 };
+};
+
+// One action's state for one subaction path as of the last xrSyncActions. Booleans and floats use value.x.
+struct Channel {
+    XrVector2f value{ 0.0f, 0.0f };
+    XrTime lastChangeTime{ 0 };
+    bool changed{ false };
+    bool active{ false };
+};
+
+// Inactive channels read as zero and never report a change; a channel that just became active starts its timeline at now
+inline void Update(Channel& ch, XrVector2f value, bool active, XrTime now) {
+    if (!active) {
+        ch = Channel{};
+        return;
+    }
+    if (!ch.active) {
+        ch.value = value;
+        ch.lastChangeTime = now;
+        ch.changed = false;
+        ch.active = true;
+        return;
+    }
+    ch.changed = value.x != ch.value.x || value.y != ch.value.y;
+    if (ch.changed) {
+        ch.value = value;
+        ch.lastChangeTime = now;
+    }
+}
+
+// Value of an action queried without a subaction path, from its per-hand values (OpenXR's combination rules)
+inline XrVector2f Combine(XrActionType type, XrVector2f a, XrVector2f b) {
+    switch (type) {
+    case XR_ACTION_TYPE_VECTOR2F_INPUT:
+        return (a.x * a.x + a.y * a.y) >= (b.x * b.x + b.y * b.y) ? a : b;
+    case XR_ACTION_TYPE_FLOAT_INPUT:
+        return std::fabs(a.x) >= std::fabs(b.x) ? a : b;
+    default:  // Boolean: either hand pressed
+        return XrVector2f{ (a.x != 0.0f || b.x != 0.0f) ? 1.0f : 0.0f, 0.0f };
+    }
+}
+
+} // namespace actstate
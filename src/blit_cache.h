@@ -0,0 +1,93 @@
+// Per-swapchain-image resource cache for OpenXR WXR preview blits
+// Backend-agnostic: entries are whatever the caller's factory fills in (D3D11 texture + SRV in the runtime)
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+namespace blitcache {
+
+// Everything that decides the shape of an intermediate blit resource
+struct Key {
+    uint64_t swapchain{ 0 };
+    uint32_t imageIndex{ 0 };
+    uint32_t arraySlice{ 0 };
+    uint32_t width{ 0 };
+    uint32_t height{ 0 };
+    int64_t format{ 0 };
+
+    bool operator==(const Key& o) const {
+        return swapchain == o.swapchain && imageIndex == o.imageIndex && arraySlice == o.arraySlice &&
+            width == o.width && height == o.height && format == o.format;
+    }
+};
+
+struct KeyHash {
+    size_t operator()(const Key& k) const {
+        uint64_t h = 1469598103934665603ull;  // FNV-1a over the fields
+        auto mix = [&h](uint64_t v) { h ^= v; h *= 1099511628211ull; };
+        mix(k.swapchain);
+        mix(((uint64_t)k.imageIndex << 32) | k.arraySlice);
+        mix(((uint64_t)k.width << 32) | k.height);
+        mix((uint64_t)k.format);
+        return (size_t)h;
+    }
+};
+
+struct Stats {
+    uint64_t hits{ 0 };
+    uint64_t creates{ 0 };
+    uint64_t failures{ 0 };
+    uint64_t evictions{ 0 };
+};
+
+template <typename Entry>
+class Cache {
+public:
+    // Returns the cached entry for key, or calls create(Entry&) -> bool to build one.
+    // Returns nullptr (and caches nothing) when the factory fails.
+    template <typename Factory>
+    Entry* GetOrCreate(const Key& key, Factory&& create) {
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            ++stats_.hits;
+            return &it->second;
+        }
+        Entry entry{};
+        if (!create(entry)) {
+            ++stats_.failures;
+            return nullptr;
+        }
+        ++stats_.creates;
+        return &entries_.emplace(key, std::move(entry)).first->second;
+    }
+
+    // Swapchain handles are reused after xrDestroySwapchain, so their entries must go with them
+    void InvalidateSwapchain(uint64_t swapchain) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->first.swapchain == swapchain) {
+                it = entries_.erase(it);
+                ++stats_.evictions;
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void Clear() {
+        stats_.evictions += entries_.size();
+        entries_.clear();
+    }
+
+    size_t Size() const { return entries_.size(); }
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    Stats stats_;
+};
+
+} // namespace blitcache
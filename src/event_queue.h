@@ -0,0 +1,222 @@
+// Event queue for OpenXR WXR
+// Bounded lock-free ring of compact event records, expanded into XrEventDataBuffer only when xrPollEvent delivers them
+#pragma once
+
+#include <openxr/openxr.h>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace events {
+
+enum class Kind : uint8_t {
+    SessionStateChanged,
+    VisibilityMaskChanged,
+    InteractionProfileChanged,
+};
+
+// Everything any queued event needs; which fields are used depends on kind
+struct Record {
+    Kind kind{ Kind::SessionStateChanged };
+    XrSession session{ XR_NULL_HANDLE };
+    XrTime time{ 0 };
+    int32_t state{ 0 };                 // XrSessionState, or XrViewConfigurationType for visibility masks
+    uint32_t viewIndex{ 0 };
+};
+
+inline Record SessionStateChanged(XrSession session, XrSessionState state, XrTime time) {
+    Record r;
+    r.kind = Kind::SessionStateChanged;
+    r.session = session;
+    r.state = (int32_t)state;
+    r.time = time;
+    return r;
+}
+
+inline Record VisibilityMaskChanged(XrSession session, XrViewConfigurationType viewConfiguration, uint32_t viewIndex) {
+    Record r;
+    r.kind = Kind::VisibilityMaskChanged;
+    r.session = session;
+    r.state = (int32_t)viewConfiguration;
+    r.viewIndex = viewIndex;
+    return r;
+}
+
+inline Record InteractionProfileChanged(XrSession session) {
+    Record r;
+    r.kind = Kind::InteractionProfileChanged;
+    r.session = session;
+    return r;
+}
+
+namespace detail {
+
+template <typename E>
+inline void Write(const E& e, XrEventDataBuffer& out) {
+    static_assert(sizeof(E) <= sizeof(XrEventDataBuffer), "event does not fit XrEventDataBuffer");
+    std::memcpy(&out, &e, sizeof(E));
+}
+
+} // namespace detail
+
+// Only the event struct itself is written; the rest of the 4 KB buffer is left alone
+inline void Expand(const Record& r, XrEventDataBuffer& out) {
+    switch (r.kind) {
+    case Kind::SessionStateChanged: {
+        XrEventDataSessionStateChanged e{};
+        e.type = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+        e.session = r.session;
+        e.state = (XrSessionState)r.state;
+        e.time = r.time;
+        detail::Write(e, out);
+        break;
+    }
+    case Kind::VisibilityMaskChanged: {
+        XrEventDataVisibilityMaskChangedKHR e{};
+        e.type = XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR;
+        e.session = r.session;
+        e.viewConfigurationType = (XrViewConfigurationType)r.state;
+        e.viewIndex = r.viewIndex;
+        detail::Write(e, out);
+        break;
+    }
+    case Kind::InteractionProfileChanged: {
+        XrEventDataInteractionProfileChanged e{};
+        e.type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+        e.session = r.session;
+        detail::Write(e, out);
+        break;
+    }
+    }
+}
+
+inline void ExpandEventsLost(uint32_t lost, XrEventDataBuffer& out) {
+    XrEventDataEventsLost e{};
+    e.type = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+    e.lostEventCount = lost;
+    detail::Write(e, out);
+}
+
+// Bounded ring after Vyukov: every cell carries a sequence number that says whose turn it is, so producers
+// (the app thread and the window procedure) claim cells with one CAS and never wait on each other or on the
+// consumer. A push into a full ring is counted as lost instead of blocking; the consumer reports that count
+// with XrEventDataEventsLost in the place the first lost record would have had, after everything queued before it.
+// The last kReserved cells only take session state changes, so a flood of other events can't cost the app a
+// state transition.
+template <size_t Capacity>
+class Ring {
+    static_assert(Capacity >= 8 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr size_t kReserved = Capacity / 4;
+
+    Ring() {
+        for (size_t i = 0; i < Capacity; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    Ring(const Ring&) = delete;
+    Ring& operator=(const Ring&) = delete;
+
+    // Safe from any thread; false if the ring was full and the record was dropped
+    bool Push(const Record& record) {
+        const size_t limit = record.kind == Kind::SessionStateChanged ? Capacity : Capacity - kReserved;
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            // Signed: head may already have moved past a stale pos
+            if ((intptr_t)(pos - head_.load(std::memory_order_acquire)) >= (intptr_t)limit) {
+                NoteLost(pos);
+                return false;
+            }
+            cell = &cells_[pos & (Capacity - 1)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) {
+                NoteLost(pos);
+                return false;
+            }
+            else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->record = record;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pops the oldest record; also safe from several threads, though xrPollEvent is normally the only caller
+    bool Pop(Record& record) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & (Capacity - 1)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        record = cell->record;
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    // Fills out with the next event: the oldest record, or the events-lost notice once every record queued before
+    // the first drop has been delivered
+    bool Deliver(XrEventDataBuffer& out) {
+        uint64_t lost = lost_.load(std::memory_order_acquire);
+        while ((uint32_t)lost != 0) {
+            const uint32_t at = (uint32_t)(lost >> 32);
+            if ((int32_t)((uint32_t)head_.load(std::memory_order_relaxed) - at) < 0) break;
+            if (lost_.compare_exchange_weak(lost, 0, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                ExpandEventsLost((uint32_t)lost, out);
+                return true;
+            }
+        }
+        Record record;
+        if (!Pop(record)) return false;
+        Expand(record, out);
+        return true;
+    }
+
+    // Approximate while producers are running; for logging
+    size_t Size() const {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+private:
+    // lost_ packs the ring position of the first drop (high 32 bits) with the number dropped since (low 32 bits),
+    // so both change together
+    void NoteLost(size_t pos) {
+        uint64_t lost = lost_.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((uint32_t)lost == UINT32_MAX) return;
+            const uint64_t next = (uint32_t)lost != 0 ? lost + 1 : ((uint64_t)(uint32_t)pos << 32) | 1;
+            if (lost_.compare_exchange_weak(lost, next, std::memory_order_acq_rel, std::memory_order_relaxed)) return;
+        }
+    }
+
+    struct Cell {
+        std::atomic<size_t> sequence{ 0 };
+        Record record;
+    };
+
+    Cell cells_[Capacity];
+    alignas(64) std::atomic<size_t> tail_{ 0 };
+    alignas(64) std::atomic<size_t> head_{ 0 };
+    std::atomic<uint64_t> lost_{ 0 };
+};
+
+} // namespace events
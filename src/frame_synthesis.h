@@ -0,0 +1,252 @@
+// Half-rate frame synthesis for OpenXR WXR (SpaceWarp-style in-between frames)
+// Pose extrapolation plus CPU reference kernels for motion estimation and motion-vector extrapolation
+#pragma once
+
+#include <openxr/openxr.h>
+#include "reprojection.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SYNTH_HAVE_SSE2 1
+#endif
+
+namespace synth {
+
+// Limits for pose extrapolation, so one bad tracking sample can't throw the view around
+constexpr float kMaxExtrapolatedMeters = 0.05f;
+constexpr float kMaxExtrapolatedRadians = 0.35f;
+
+// Motion estimation runs on a downsampled luma image
+constexpr uint32_t kLumaDownsample = 4;
+constexpr uint32_t kMotionBlockSize = 8;    // in luma pixels
+constexpr int kMotionSearchRadius = 4;      // in luma pixels
+
+inline XrQuaternionf Multiply(const XrQuaternionf& a, const XrQuaternionf& b) {
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+inline XrQuaternionf Conjugate(const XrQuaternionf& q) {
+    return { -q.x, -q.y, -q.z, q.w };
+}
+
+// Pose at parameter t on the path older (t=0) -> newer (t=1); t > 1 extrapolates.
+// The step beyond 'newer' is clamped to kMaxExtrapolatedMeters / kMaxExtrapolatedRadians.
+inline XrPosef ExtrapolatePose(const XrPosef& older, const XrPosef& newer, float t) {
+    const float ahead = t - 1.0f;
+    XrPosef out = newer;
+
+    XrVector3f step = {
+        (newer.position.x - older.position.x) * ahead,
+        (newer.position.y - older.position.y) * ahead,
+        (newer.position.z - older.position.z) * ahead
+    };
+    float len = sqrtf(step.x * step.x + step.y * step.y + step.z * step.z);
+    if (len > kMaxExtrapolatedMeters) {
+        float k = kMaxExtrapolatedMeters / len;
+        step = { step.x * k, step.y * k, step.z * k };
+    }
+    out.position = { newer.position.x + step.x, newer.position.y + step.y, newer.position.z + step.z };
+
+    // Angular delta as axis-angle, scaled by how far past 'newer' we go
+    XrQuaternionf a = reproj::Normalize(older.orientation);
+    XrQuaternionf b = reproj::Normalize(newer.orientation);
+    XrQuaternionf d = Multiply(b, Conjugate(a));
+    if (d.w < 0.0f) d = { -d.x, -d.y, -d.z, -d.w };
+    float sinHalf = sqrtf(d.x * d.x + d.y * d.y + d.z * d.z);
+    if (sinHalf > 1e-6f) {
+        float angle = 2.0f * atan2f(sinHalf, d.w) * ahead;
+        angle = std::min(std::max(angle, -kMaxExtrapolatedRadians), kMaxExtrapolatedRadians);
+        float s = sinf(angle * 0.5f) / sinHalf;
+        XrQuaternionf stepQ = { d.x * s, d.y * s, d.z * s, cosf(angle * 0.5f) };
+        out.orientation = reproj::Normalize(Multiply(stepQ, b));
+    }
+    return out;
+}
+
+// Block motion field between two frames, in full-resolution pixels per frame
+struct MotionField {
+    uint32_t blocksX{ 0 }, blocksY{ 0 };
+    uint32_t blockPixels{ 0 };   // full-resolution pixels covered by one block side
+    std::vector<float> dx, dy;
+};
+
+// Box-filtered luma (BT.601 weights on 8-bit RGBA), one byte per factor x factor block
+inline void DownsampleLuma(const uint32_t* rgba, uint32_t width, uint32_t height, uint32_t factor,
+    std::vector<uint8_t>& out, uint32_t& outWidth, uint32_t& outHeight) {
+    outWidth = width / factor;
+    outHeight = height / factor;
+    out.resize((size_t)outWidth * outHeight);
+    const uint32_t area = factor * factor;
+    for (uint32_t y = 0; y < outHeight; ++y) {
+        for (uint32_t x = 0; x < outWidth; ++x) {
+            uint32_t sum = 0;
+            for (uint32_t sy = 0; sy < factor; ++sy) {
+                const uint32_t* row = rgba + (size_t)(y * factor + sy) * width + x * factor;
+                for (uint32_t sx = 0; sx < factor; ++sx) {
+                    uint32_t p = row[sx];
+                    sum += (77 * (p & 0xFF) + 150 * ((p >> 8) & 0xFF) + 29 * ((p >> 16) & 0xFF)) >> 8;
+                }
+            }
+            out[(size_t)y * outWidth + x] = (uint8_t)(sum / area);
+        }
+    }
+}
+
+namespace detail {
+
+// Sum of absolute differences of an 8x8 block
+inline uint32_t BlockSAD8(const uint8_t* a, const uint8_t* b, uint32_t stride) {
+#if defined(SYNTH_HAVE_SSE2)
+    __m128i acc = _mm_setzero_si128();
+    for (int y = 0; y < 8; y += 2) {
+        __m128i va = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + y * stride)),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + (y + 1) * stride)));
+        __m128i vb = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + y * stride)),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + (y + 1) * stride)));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+    }
+    return (uint32_t)(_mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+#else
+    uint32_t sum = 0;
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            sum += (uint32_t)std::abs((int)a[y * stride + x] - (int)b[y * stride + x]);
+        }
+    }
+    return sum;
+#endif
+}
+
+inline uint32_t Lerp8(uint32_t a, uint32_t b, uint32_t w) {
+    return (a * (256 - w) + b * w) >> 8;
+}
+
+// Bilinear fetch of an RGBA8 pixel with edge clamping, weights in 1/256ths
+inline uint32_t SampleBilinear(const uint32_t* img, uint32_t width, uint32_t height, float fx, float fy) {
+    fx = std::min(std::max(fx, 0.0f), (float)(width - 1));
+    fy = std::min(std::max(fy, 0.0f), (float)(height - 1));
+    uint32_t x0 = (uint32_t)fx, y0 = (uint32_t)fy;
+    uint32_t x1 = std::min(x0 + 1, width - 1), y1 = std::min(y0 + 1, height - 1);
+    uint32_t wx = (uint32_t)((fx - (float)x0) * 256.0f), wy = (uint32_t)((fy - (float)y0) * 256.0f);
+    uint32_t p00 = img[(size_t)y0 * width + x0], p10 = img[(size_t)y0 * width + x1];
+    uint32_t p01 = img[(size_t)y1 * width + x0], p11 = img[(size_t)y1 * width + x1];
+    uint32_t out = 0;
+    for (int c = 0; c < 32; c += 8) {
+        uint32_t top = Lerp8((p00 >> c) & 0xFF, (p10 >> c) & 0xFF, wx);
+        uint32_t bottom = Lerp8((p01 >> c) & 0xFF, (p11 >> c) & 0xFF, wx);
+        out |= Lerp8(top, bottom, wy) << c;
+    }
+    return out;
+}
+
+} // namespace detail
+
+// Full-search block matching from prev to cur on downsampled luma. Each block of 'cur' is looked up
+// in 'prev'; the result is how far that content moved between the two frames.
+inline void EstimateMotion(const uint8_t* prevLuma, const uint8_t* curLuma, uint32_t lumaWidth, uint32_t lumaHeight,
+    uint32_t factor, MotionField& field) {
+    const uint32_t block = kMotionBlockSize;
+    const int radius = kMotionSearchRadius;
+    field.blocksX = lumaWidth / block;
+    field.blocksY = lumaHeight / block;
+    field.blockPixels = block * factor;
+    field.dx.assign((size_t)field.blocksX * field.blocksY, 0.0f);
+    field.dy.assign((size_t)field.blocksX * field.blocksY, 0.0f);
+
+    for (uint32_t by = 0; by < field.blocksY; ++by) {
+        for (uint32_t bx = 0; bx < field.blocksX; ++bx) {
+            const int x0 = (int)(bx * block), y0 = (int)(by * block);
+            const uint8_t* curBlock = curLuma + (size_t)y0 * lumaWidth + x0;
+            uint32_t best = detail::BlockSAD8(curBlock, prevLuma + (size_t)y0 * lumaWidth + x0, lumaWidth);
+            int bestX = 0, bestY = 0;
+            // Bias towards zero motion so flat areas don't pick up noise
+            const uint32_t zeroBias = block * block;
+            best = best > zeroBias ? best - zeroBias : 0;
+            for (int oy = -radius; oy <= radius; ++oy) {
+                int py = y0 + oy;
+                if (py < 0 || py + (int)block > (int)lumaHeight) continue;
+                for (int ox = -radius; ox <= radius; ++ox) {
+                    int px = x0 + ox;
+                    if ((ox == 0 && oy == 0) || px < 0 || px + (int)block > (int)lumaWidth) continue;
+                    uint32_t sad = detail::BlockSAD8(curBlock, prevLuma + (size_t)py * lumaWidth + px, lumaWidth);
+                    if (sad < best) {
+                        best = sad;
+                        bestX = ox;
+                        bestY = oy;
+                    }
+                }
+            }
+            // Content at prev(x + o) is now at cur(x), so it moved by -o
+            size_t i = (size_t)by * field.blocksX + bx;
+            field.dx[i] = -(float)bestX * (float)factor;
+            field.dy[i] = -(float)bestY * (float)factor;
+        }
+    }
+}
+
+// Moves 'cur' forward by t frames along an estimated motion field (backward mapping, so no holes)
+inline void ExtrapolateWithField(const uint32_t* cur, uint32_t width, uint32_t height, const MotionField& field,
+    float t, uint32_t* dst) {
+    if (field.blocksX == 0 || field.blocksY == 0) {
+        std::copy(cur, cur + (size_t)width * height, dst);
+        return;
+    }
+    const float invBlock = 1.0f / (float)field.blockPixels;
+    for (uint32_t y = 0; y < height; ++y) {
+        // Block-centre coordinates for bilinear interpolation of the field
+        float fy = std::min(std::max(((float)y + 0.5f) * invBlock - 0.5f, 0.0f), (float)(field.blocksY - 1));
+        uint32_t by0 = (uint32_t)fy, by1 = std::min(by0 + 1, field.blocksY - 1);
+        float wy = fy - (float)by0;
+        for (uint32_t x = 0; x < width; ++x) {
+            float fx = std::min(std::max(((float)x + 0.5f) * invBlock - 0.5f, 0.0f), (float)(field.blocksX - 1));
+            uint32_t bx0 = (uint32_t)fx, bx1 = std::min(bx0 + 1, field.blocksX - 1);
+            float wx = fx - (float)bx0;
+            size_t i00 = (size_t)by0 * field.blocksX + bx0, i10 = (size_t)by0 * field.blocksX + bx1;
+            size_t i01 = (size_t)by1 * field.blocksX + bx0, i11 = (size_t)by1 * field.blocksX + bx1;
+            float mx = (field.dx[i00] * (1 - wx) + field.dx[i10] * wx) * (1 - wy) + (field.dx[i01] * (1 - wx) + field.dx[i11] * wx) * wy;
+            float my = (field.dy[i00] * (1 - wx) + field.dy[i10] * wx) * (1 - wy) + (field.dy[i01] * (1 - wx) + field.dy[i11] * wx) * wy;
+            dst[(size_t)y * width + x] = detail::SampleBilinear(cur, width, height, (float)x - mx * t, (float)y - my * t);
+        }
+    }
+}
+
+// Same, using app motion vectors as defined by XR_FB_space_warp: per-pixel NDC-space motion since the
+// previous app frame (x right, y up), 'stride' floats per pixel, top row first. The vectors may be at a
+// lower resolution than 'cur' (runtimes recommend half size); each pixel takes the nearest vector.
+inline void ExtrapolateWithMotionVectors(const uint32_t* cur, uint32_t width, uint32_t height,
+    const float* motion, uint32_t mvWidth, uint32_t mvHeight, uint32_t stride, float t, uint32_t* dst) {
+    if (mvWidth == 0 || mvHeight == 0) {
+        std::copy(cur, cur + (size_t)width * height, dst);
+        return;
+    }
+    // NDC spans the whole image whatever the vector resolution, so the scale uses the color size
+    const float sx = 0.5f * (float)width * t;
+    const float sy = -0.5f * (float)height * t;
+    // 16.16 fixed-point walk over the vector image, starting half a color pixel in
+    const uint64_t stepX = ((uint64_t)mvWidth << 16) / width;
+    for (uint32_t y = 0; y < height; ++y) {
+        const uint32_t mvY = std::min((uint32_t)(((uint64_t)y * mvHeight + mvHeight / 2) / height), mvHeight - 1);
+        const float* mvRow = motion + (size_t)mvY * mvWidth * stride;
+        uint64_t fx = stepX / 2;
+        for (uint32_t x = 0; x < width; ++x, fx += stepX) {
+            const float* mv = mvRow + (size_t)std::min((uint32_t)(fx >> 16), mvWidth - 1) * stride;
+            float mx = mv[0] * sx;
+            float my = mv[1] * sy;
+            dst[(size_t)y * width + x] = detail::SampleBilinear(cur, width, height, (float)x - mx, (float)y - my);
+        }
+    }
+}
+
+} // namespace synth
@@ -0,0 +1,338 @@
+// Hand joint skeletons for OpenXR WXR (XR_EXT_hand_tracking)
+// Quantized wire codec for headset-tracked joints, a controller-driven fallback skeleton, and an SSE2 batch transform to world space
+#pragma once
+
+#include <openxr/openxr.h>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HANDJ_HAVE_SSE2 1
+#endif
+
+namespace handjoints {
+
+constexpr size_t kJointCount = XR_HAND_JOINT_COUNT_EXT;
+constexpr size_t kPaddedCount = (kJointCount + 3) & ~(size_t)3;  // Whole SSE lanes
+
+// Joint poses in the hand's local frame, i.e. relative to the controller pose sent for that hand.
+// Stored as structure-of-arrays so the transform works on four joints per instruction.
+struct Skeleton {
+    alignas(16) float px[kPaddedCount]{};
+    alignas(16) float py[kPaddedCount]{};
+    alignas(16) float pz[kPaddedCount]{};
+    alignas(16) float qx[kPaddedCount]{};
+    alignas(16) float qy[kPaddedCount]{};
+    alignas(16) float qz[kPaddedCount]{};
+    alignas(16) float qw[kPaddedCount]{};
+    alignas(16) float radius[kPaddedCount]{};
+
+    void Set(size_t i, const XrPosef& pose, float r) {
+        px[i] = pose.position.x; py[i] = pose.position.y; pz[i] = pose.position.z;
+        qx[i] = pose.orientation.x; qy[i] = pose.orientation.y; qz[i] = pose.orientation.z; qw[i] = pose.orientation.w;
+        radius[i] = r;
+    }
+
+    XrPosef Pose(size_t i) const {
+        return XrPosef{ { qx[i], qy[i], qz[i], qw[i] }, { px[i], py[i], pz[i] } };
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Wire codec
+// ---------------------------------------------------------------------------
+// Each joint packs into 13 bytes, little-endian:
+//   int16 x, y, z      position in 1/16384 m (+-2 m around the hand pose, 0.06 mm steps)
+//   int16 a, b, c      orientation, smallest three components scaled by 32767 * sqrt(2)
+//   uint8              bits 7-6: index of the dropped (largest) component, bits 5-0: radius in 0.5 mm
+// A hand is 26 joints in XrHandJointEXT order, base64 encoded (452 characters).
+constexpr float kPositionScale = 16384.0f;
+constexpr float kRotationScale = 32767.0f * 1.41421356f;
+constexpr float kRadiusStep = 0.0005f;
+constexpr size_t kPackedJointBytes = 13;
+constexpr size_t kPackedHandBytes = kPackedJointBytes * kJointCount;
+constexpr size_t kEncodedHandChars = (kPackedHandBytes + 2) / 3 * 4;
+
+namespace detail {
+
+inline int16_t Quantize(float v, float scale) {
+    float s = v * scale;
+    s = s < -32767.0f ? -32767.0f : (s > 32767.0f ? 32767.0f : s);
+    return (int16_t)std::lround(s);
+}
+
+inline void PutI16(uint8_t*& p, int16_t v) {
+    *p++ = (uint8_t)((uint16_t)v & 0xFF);
+    *p++ = (uint8_t)((uint16_t)v >> 8);
+}
+
+inline int16_t GetI16(const uint8_t*& p) {
+    uint16_t v = (uint16_t)(p[0] | (p[1] << 8));
+    p += 2;
+    return (int16_t)v;
+}
+
+constexpr char kBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+inline int Base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+} // namespace detail
+
+inline void PackJoint(const Skeleton& s, size_t i, uint8_t* p) {
+    detail::PutI16(p, detail::Quantize(s.px[i], kPositionScale));
+    detail::PutI16(p, detail::Quantize(s.py[i], kPositionScale));
+    detail::PutI16(p, detail::Quantize(s.pz[i], kPositionScale));
+
+    float q[4] = { s.qx[i], s.qy[i], s.qz[i], s.qw[i] };
+    int largest = 0;
+    for (int k = 1; k < 4; ++k) {
+        if (std::fabs(q[k]) > std::fabs(q[largest])) largest = k;
+    }
+    // q and -q are the same rotation; make the dropped component positive so it can be rebuilt from the others
+    const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+    for (int k = 0; k < 4; ++k) {
+        if (k != largest) detail::PutI16(p, detail::Quantize(q[k] * sign, kRotationScale));
+    }
+
+    int r = (int)std::lround(s.radius[i] / kRadiusStep);
+    r = r < 0 ? 0 : (r > 63 ? 63 : r);
+    *p = (uint8_t)((largest << 6) | r);
+}
+
+inline void UnpackJoint(const uint8_t* p, Skeleton& s, size_t i) {
+    s.px[i] = detail::GetI16(p) / kPositionScale;
+    s.py[i] = detail::GetI16(p) / kPositionScale;
+    s.pz[i] = detail::GetI16(p) / kPositionScale;
+
+    const float a = detail::GetI16(p) / kRotationScale;
+    const float b = detail::GetI16(p) / kRotationScale;
+    const float c = detail::GetI16(p) / kRotationScale;
+    const int largest = *p >> 6;
+    const float sum = a * a + b * b + c * c;
+    const float d = sum < 1.0f ? std::sqrt(1.0f - sum) : 0.0f;
+    float q[4];
+    const float small[3] = { a, b, c };
+    for (int k = 0, n = 0; k < 4; ++k) q[k] = k == largest ? d : small[n++];
+    const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    s.qx[i] = q[0] / len; s.qy[i] = q[1] / len; s.qz[i] = q[2] / len; s.qw[i] = q[3] / len;
+
+    s.radius[i] = (*p & 0x3F) * kRadiusStep;
+}
+
+inline std::string EncodeHand(const Skeleton& s) {
+    uint8_t bytes[kPackedHandBytes];
+    for (size_t i = 0; i < kJointCount; ++i) PackJoint(s, i, bytes + i * kPackedJointBytes);
+
+    std::string out;
+    out.reserve(kEncodedHandChars);
+    for (size_t i = 0; i < kPackedHandBytes; i += 3) {
+        const size_t n = kPackedHandBytes - i < 3 ? kPackedHandBytes - i : 3;
+        uint32_t v = (uint32_t)bytes[i] << 16;
+        if (n > 1) v |= (uint32_t)bytes[i + 1] << 8;
+        if (n > 2) v |= bytes[i + 2];
+        out += detail::kBase64[(v >> 18) & 0x3F];
+        out += detail::kBase64[(v >> 12) & 0x3F];
+        out += n > 1 ? detail::kBase64[(v >> 6) & 0x3F] : '=';
+        out += n > 2 ? detail::kBase64[v & 0x3F] : '=';
+    }
+    return out;
+}
+
+// Returns false (and leaves s untouched) unless text is exactly one encoded hand
+inline bool DecodeHand(std::string_view text, Skeleton& s) {
+    if (text.size() != kEncodedHandChars) return false;
+    uint8_t bytes[kEncodedHandChars / 4 * 3];
+    size_t n = 0;
+    for (size_t i = 0; i < text.size(); i += 4) {
+        uint32_t v = 0;
+        for (size_t k = 0; k < 4; ++k) {
+            const char c = text[i + k];
+            int d = detail::Base64Value(c);
+            if (d < 0) {
+                // Padding is only allowed in the last group
+                if (c != '=' || i + 4 != text.size() || k < 2) return false;
+                d = 0;
+            }
+            v = (v << 6) | (uint32_t)d;
+        }
+        bytes[n++] = (uint8_t)(v >> 16);
+        bytes[n++] = (uint8_t)(v >> 8);
+        bytes[n++] = (uint8_t)v;
+    }
+    for (size_t i = 0; i < kJointCount; ++i) UnpackJoint(bytes + i * kPackedJointBytes, s, i);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Fallback skeleton
+// ---------------------------------------------------------------------------
+// How far each finger is bent, 0 = straight, 1 = fist. The runtime derives these from trigger, grip and touch state.
+struct Curls {
+    float thumb{ 0.0f };
+    float index{ 0.0f };
+    float middle{ 0.0f };
+    float ring{ 0.0f };
+    float little{ 0.0f };
+};
+
+namespace detail {
+
+inline XrQuaternionf Mul(const XrQuaternionf& a, const XrQuaternionf& b) {
+    return XrQuaternionf{
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+inline XrVector3f Rotate(const XrQuaternionf& q, const XrVector3f& v) {
+    // v + 2w(u x v) + 2u x (u x v)
+    const XrVector3f t{ 2.0f * (q.y * v.z - q.z * v.y), 2.0f * (q.z * v.x - q.x * v.z), 2.0f * (q.x * v.y - q.y * v.x) };
+    return XrVector3f{
+        v.x + q.w * t.x + (q.y * t.z - q.z * t.y),
+        v.y + q.w * t.y + (q.z * t.x - q.x * t.z),
+        v.z + q.w * t.z + (q.x * t.y - q.y * t.x)
+    };
+}
+
+inline XrQuaternionf AxisAngle(float x, float y, float z, float angle) {
+    const float s = std::sin(angle * 0.5f);
+    return XrQuaternionf{ x * s, y * s, z * s, std::cos(angle * 0.5f) };
+}
+
+// One finger of a right hand in the hand frame (palm down, fingers along -Z, thumb toward -X)
+struct FingerModel {
+    uint32_t firstJoint;      // Metacarpal joint
+    uint32_t boneCount;       // Bones from the metacarpal joint to the tip
+    XrVector3f base;          // Metacarpal joint position
+    float yaw;                // Rotation about +Y of the whole finger
+    float length[4];          // Bone lengths, metacarpal first
+    float radius[5];          // Joint radii, metacarpal first
+    float flex[4];            // Flexion at each bone's start joint for a full curl (radians)
+};
+
+// Average adult hand; the thumb has no intermediate bone, so it runs metacarpal, proximal, distal, tip
+inline constexpr FingerModel kFingers[] = {
+    { XR_HAND_JOINT_THUMB_METACARPAL_EXT, 3, { -0.025f, -0.012f, 0.030f }, 0.60f,
+        { 0.045f, 0.032f, 0.028f, 0.0f }, { 0.014f, 0.011f, 0.010f, 0.008f, 0.0f }, { 0.35f, 0.55f, 0.70f, 0.0f } },
+    { XR_HAND_JOINT_INDEX_METACARPAL_EXT, 4, { -0.022f, 0.0f, 0.040f }, 0.05f,
+        { 0.065f, 0.040f, 0.024f, 0.022f }, { 0.011f, 0.010f, 0.009f, 0.008f, 0.007f }, { 0.0f, 1.40f, 1.60f, 1.00f } },
+    { XR_HAND_JOINT_MIDDLE_METACARPAL_EXT, 4, { -0.002f, 0.0f, 0.040f }, 0.0f,
+        { 0.063f, 0.045f, 0.028f, 0.023f }, { 0.011f, 0.010f, 0.009f, 0.008f, 0.007f }, { 0.0f, 1.45f, 1.65f, 1.00f } },
+    { XR_HAND_JOINT_RING_METACARPAL_EXT, 4, { 0.017f, -0.002f, 0.040f }, -0.05f,
+        { 0.058f, 0.042f, 0.027f, 0.022f }, { 0.010f, 0.009f, 0.008f, 0.007f, 0.006f }, { 0.0f, 1.50f, 1.65f, 1.00f } },
+    { XR_HAND_JOINT_LITTLE_METACARPAL_EXT, 4, { 0.033f, -0.005f, 0.040f }, -0.12f,
+        { 0.055f, 0.033f, 0.019f, 0.020f }, { 0.009f, 0.008f, 0.007f, 0.006f, 0.005f }, { 0.0f, 1.55f, 1.65f, 1.00f } },
+};
+
+} // namespace detail
+
+// Poses the model hand in the controller's local frame. The palm sits at the controller origin; the left hand is the
+// right hand mirrored across the YZ plane.
+inline void Synthesize(bool right, const Curls& curls, Skeleton& s) {
+    const XrQuaternionf identity{ 0.0f, 0.0f, 0.0f, 1.0f };
+    XrPosef pose{ identity, { 0.0f, 0.0f, 0.0f } };
+    s.Set(XR_HAND_JOINT_PALM_EXT, pose, 0.020f);
+    pose.position = { 0.0f, 0.0f, 0.045f };
+    s.Set(XR_HAND_JOINT_WRIST_EXT, pose, 0.020f);
+
+    const float curl[] = { curls.thumb, curls.index, curls.middle, curls.ring, curls.little };
+    for (size_t f = 0; f < std::size(detail::kFingers); ++f) {
+        const detail::FingerModel& m = detail::kFingers[f];
+        const float c = curl[f] < 0.0f ? 0.0f : (curl[f] > 1.0f ? 1.0f : curl[f]);
+        // The thumb also swings in across the palm as it closes
+        const float yaw = f == 0 ? m.yaw + 0.45f * c : m.yaw;
+        XrQuaternionf q = detail::AxisAngle(0.0f, 1.0f, 0.0f, yaw);
+        XrVector3f p = m.base;
+        for (uint32_t b = 0; b <= m.boneCount; ++b) {
+            if (b < m.boneCount) q = detail::Mul(q, detail::AxisAngle(1.0f, 0.0f, 0.0f, -m.flex[b] * c));
+            s.Set(m.firstJoint + b, XrPosef{ q, p }, m.radius[b]);
+            if (b < m.boneCount) {
+                const XrVector3f d = detail::Rotate(q, XrVector3f{ 0.0f, 0.0f, -m.length[b] });
+                p = XrVector3f{ p.x + d.x, p.y + d.y, p.z + d.z };
+            }
+        }
+    }
+
+    if (!right) {
+        for (size_t i = 0; i < kJointCount; ++i) {
+            s.px[i] = -s.px[i];
+            s.qy[i] = -s.qy[i];
+            s.qz[i] = -s.qz[i];
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Locate
+// ---------------------------------------------------------------------------
+// Writes base * local for the first count joints (count <= kJointCount); flags go to every joint
+inline void Transform(const XrPosef& base, const Skeleton& local, XrHandJointLocationEXT* out, size_t count,
+    XrSpaceLocationFlags flags) {
+    const XrQuaternionf& bq = base.orientation;
+    const XrVector3f& bp = base.position;
+    size_t i = 0;
+
+#if defined(HANDJ_HAVE_SSE2)
+    const __m128 qx = _mm_set1_ps(bq.x), qy = _mm_set1_ps(bq.y), qz = _mm_set1_ps(bq.z), qw = _mm_set1_ps(bq.w);
+    const __m128 tx0 = _mm_set1_ps(bp.x), ty0 = _mm_set1_ps(bp.y), tz0 = _mm_set1_ps(bp.z);
+    const __m128 two = _mm_set1_ps(2.0f);
+    alignas(16) float r[7][4];
+    for (; i + 4 <= count; i += 4) {
+        // Position: base + rotate(bq, local), with t = 2 (u x v) and v' = v + w t + u x t
+        const __m128 vx = _mm_load_ps(local.px + i), vy = _mm_load_ps(local.py + i), vz = _mm_load_ps(local.pz + i);
+        const __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy)));
+        const __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz)));
+        const __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx)));
+        _mm_store_ps(r[0], _mm_add_ps(_mm_add_ps(tx0, vx), _mm_add_ps(_mm_mul_ps(qw, tx),
+            _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)))));
+        _mm_store_ps(r[1], _mm_add_ps(_mm_add_ps(ty0, vy), _mm_add_ps(_mm_mul_ps(qw, ty),
+            _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)))));
+        _mm_store_ps(r[2], _mm_add_ps(_mm_add_ps(tz0, vz), _mm_add_ps(_mm_mul_ps(qw, tz),
+            _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)))));
+
+        // Orientation: bq * local
+        const __m128 lx = _mm_load_ps(local.qx + i), ly = _mm_load_ps(local.qy + i);
+        const __m128 lz = _mm_load_ps(local.qz + i), lw = _mm_load_ps(local.qw + i);
+        _mm_store_ps(r[3], _mm_add_ps(_mm_add_ps(_mm_mul_ps(qw, lx), _mm_mul_ps(qx, lw)),
+            _mm_sub_ps(_mm_mul_ps(qy, lz), _mm_mul_ps(qz, ly))));
+        _mm_store_ps(r[4], _mm_add_ps(_mm_sub_ps(_mm_mul_ps(qw, ly), _mm_mul_ps(qx, lz)),
+            _mm_add_ps(_mm_mul_ps(qy, lw), _mm_mul_ps(qz, lx))));
+        _mm_store_ps(r[5], _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(qw, lz), _mm_mul_ps(qx, ly)),
+            _mm_mul_ps(qy, lx)), _mm_mul_ps(qz, lw)));
+        _mm_store_ps(r[6], _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(qw, lw), _mm_mul_ps(qx, lx)),
+            _mm_add_ps(_mm_mul_ps(qy, ly), _mm_mul_ps(qz, lz))));
+
+        for (size_t k = 0; k < 4; ++k) {
+            XrHandJointLocationEXT& j = out[i + k];
+            j.locationFlags = flags;
+            j.pose.position = XrVector3f{ r[0][k], r[1][k], r[2][k] };
+            j.pose.orientation = XrQuaternionf{ r[3][k], r[4][k], r[5][k], r[6][k] };
+            j.radius = local.radius[i + k];
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        const XrVector3f v = detail::Rotate(bq, XrVector3f{ local.px[i], local.py[i], local.pz[i] });
+        XrHandJointLocationEXT& j = out[i];
+        j.locationFlags = flags;
+        j.pose.position = XrVector3f{ bp.x + v.x, bp.y + v.y, bp.z + v.z };
+        j.pose.orientation = detail::Mul(bq, XrQuaternionf{ local.qx[i], local.qy[i], local.qz[i], local.qw[i] });
+        j.radius = local.radius[i];
+    }
+}
+
+} // namespace handjoints
@@ -0,0 +1,141 @@
+// Generational handle tables for OpenXR WXR objects
+// Handles encode [type:8][generation:24][index:32], so lookups are array indexing and stale or foreign handles fail cheaply
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace handles {
+
+enum class HandleType : uint8_t {
+    Swapchain = 1,
+    Space = 2,
+    ActionSet = 3,
+    Action = 4,
+    HandTracker = 5,
+};
+
+constexpr uint64_t kIndexBits = 32;
+constexpr uint64_t kGenerationBits = 24;
+constexpr uint64_t kGenerationMask = (1ull << kGenerationBits) - 1;
+
+constexpr uint64_t Encode(HandleType type, uint32_t generation, uint32_t index) {
+    return ((uint64_t)type << (kIndexBits + kGenerationBits)) |
+        (((uint64_t)generation & kGenerationMask) << kIndexBits) | (uint64_t)index;
+}
+
+constexpr HandleType TypeOf(uint64_t handle) { return (HandleType)(handle >> (kIndexBits + kGenerationBits)); }
+constexpr uint32_t GenerationOf(uint64_t handle) { return (uint32_t)((handle >> kIndexBits) & kGenerationMask); }
+constexpr uint32_t IndexOf(uint64_t handle) { return (uint32_t)handle; }
+
+// XR_DEFINE_HANDLE is an opaque pointer on 64-bit builds and a uint64_t on 32-bit ones; these keep all 64 bits either way
+template <typename H>
+inline uint64_t ToBits(H handle) {
+    if constexpr (std::is_pointer_v<H>) return (uint64_t)reinterpret_cast<uintptr_t>(handle);
+    else return (uint64_t)handle;
+}
+
+template <typename H>
+inline H FromBits(uint64_t bits) {
+    if constexpr (std::is_pointer_v<H>) return reinterpret_cast<H>((uintptr_t)bits);
+    else return (H)bits;
+}
+
+// Slot map of T addressed by handles H of one type. Generations start at 1, so no handle is ever 0 (XR_NULL_HANDLE).
+// Removing bumps the slot's generation: every handle to the old object is rejected from then on.
+// Pointers returned by Get are invalidated by the next Insert, which may grow the slot vector; look the
+// handle up again instead of holding a T* across one.
+template <typename T, HandleType Type, typename H = uint64_t>
+class Table {
+public:
+    // Returns the new handle; value is moved in
+    H Insert(T value) {
+        uint32_t index;
+        if (!freeList_.empty()) {
+            index = freeList_.back();
+            freeList_.pop_back();
+        }
+        else {
+            index = (uint32_t)slots_.size();
+            slots_.emplace_back();
+        }
+        Slot& slot = slots_[index];
+        slot.value = std::move(value);
+        slot.alive = true;
+        ++count_;
+        return FromBits<H>(Encode(Type, slot.generation, index));
+    }
+
+    T* Get(H h) {
+        const uint64_t handle = ToBits(h);
+        if (TypeOf(handle) != Type) return nullptr;
+        uint32_t index = IndexOf(handle);
+        if (index >= slots_.size()) return nullptr;
+        Slot& slot = slots_[index];
+        return (slot.alive && slot.generation == GenerationOf(handle)) ? &slot.value : nullptr;
+    }
+
+    const T* Get(H h) const {
+        return const_cast<Table*>(this)->Get(h);
+    }
+
+    bool Contains(H h) const { return Get(h) != nullptr; }
+
+    bool Remove(H h) {
+        if (!Get(h)) return false;
+        uint32_t index = IndexOf(ToBits(h));
+        Slot& slot = slots_[index];
+        slot.value = T{};  // Release whatever the object held now, not when the slot is reused
+        slot.alive = false;
+        slot.generation = NextGeneration(slot.generation);
+        freeList_.push_back(index);
+        --count_;
+        return true;
+    }
+
+    // fn(H handle, T& value) for every live object
+    template <typename Fn>
+    void ForEach(Fn&& fn) {
+        for (uint32_t i = 0; i < (uint32_t)slots_.size(); ++i) {
+            Slot& slot = slots_[i];
+            if (slot.alive) fn(FromBits<H>(Encode(Type, slot.generation, i)), slot.value);
+        }
+    }
+
+    // Removes every object. Slots are kept and their generations bumped, so handles from before the Clear stay stale.
+    void Clear() {
+        freeList_.clear();
+        for (uint32_t i = (uint32_t)slots_.size(); i-- > 0;) {
+            Slot& slot = slots_[i];
+            if (slot.alive) {
+                slot.value = T{};
+                slot.alive = false;
+                slot.generation = NextGeneration(slot.generation);
+            }
+            freeList_.push_back(i);  // Pushed in reverse so the lowest index is reused first
+        }
+        count_ = 0;
+    }
+
+    size_t Size() const { return count_; }
+
+private:
+    struct Slot {
+        T value{};
+        uint32_t generation{ 1 };
+        bool alive{ false };
+    };
+
+    static uint32_t NextGeneration(uint32_t generation) {
+        return (generation & kGenerationMask) == kGenerationMask ? 1 : generation + 1;
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> freeList_;
+    size_t count_{ 0 };
+};
+
+} // namespace handles
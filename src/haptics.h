@@ -0,0 +1,124 @@
+// Haptics scheduler for OpenXR WXR
+// Tracks each hand's vibrations with end times, merges overlapping ones and reports what changed once per frame
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace haptics {
+
+constexpr int kHandCount = 2;                  // 0 = left, 1 = right
+constexpr int64_t kMinDurationNs = 10000000;   // Used for XR_MIN_HAPTIC_DURATION and XR_NO_DURATION
+constexpr int64_t kInfiniteNs = INT64_MAX;     // XR_INFINITE_DURATION: runs until stopped or replaced
+constexpr size_t kMaxSourcesPerHand = 8;
+
+// What one hand should be doing right now
+struct Output {
+    bool active{ false };
+    float amplitude{ 0.0f };     // 0..1
+    float frequency{ 0.0f };     // Hz, 0 = let the headset pick
+    int64_t remainingNs{ 0 };    // kInfiniteNs while an infinite vibration is running
+
+    bool operator==(const Output& o) const {
+        return active == o.active && amplitude == o.amplitude && frequency == o.frequency;
+    }
+    bool operator!=(const Output& o) const { return !(*this == o); }
+};
+
+// Deterministic: the output depends only on the calls made and the times passed in.
+// Each source (e.g. an action handle) holds at most one vibration per hand; a new one from the same source replaces
+// it, vibrations from different sources overlap and the strongest wins. A vibration's clock starts at the flush that
+// first reports it, so a pulse shorter than a frame is delayed rather than lost.
+class Scheduler {
+public:
+    void Apply(int hand, uint64_t source, int64_t durationNs, float amplitude, float frequency) {
+        if (hand < 0 || hand >= kHandCount) return;
+        if (durationNs <= 0) durationNs = kMinDurationNs;
+        amplitude = amplitude < 0.0f ? 0.0f : (amplitude > 1.0f ? 1.0f : amplitude);
+        if (frequency < 0.0f) frequency = 0.0f;
+
+        std::vector<Entry>& entries = entries_[hand];
+        Entry* slot = nullptr;
+        for (Entry& e : entries) {
+            if (e.source == source) slot = &e;
+        }
+        if (!slot) {
+            if (entries.size() >= kMaxSourcesPerHand) entries.erase(entries.begin());
+            entries.push_back(Entry{});
+            slot = &entries.back();
+        }
+        *slot = Entry{ source, durationNs, 0, amplitude, frequency, false };
+    }
+
+    void Stop(int hand, uint64_t source) {
+        if (hand < 0 || hand >= kHandCount) return;
+        std::vector<Entry>& entries = entries_[hand];
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].source == source) {
+                entries.erase(entries.begin() + i);
+                return;
+            }
+        }
+    }
+
+    void Clear() {
+        for (int h = 0; h < kHandCount; ++h) {
+            entries_[h].clear();
+            last_[h] = Output{};
+        }
+    }
+
+    // Fills out with both hands' current output; changed[h] is set when hand h needs a new message
+    // (output differs from the last flush, or a vibration (re)started since then)
+    bool Flush(int64_t nowNs, Output (&out)[kHandCount], bool (&changed)[kHandCount]) {
+        bool any = false;
+        for (int h = 0; h < kHandCount; ++h) {
+            std::vector<Entry>& entries = entries_[h];
+            bool started = false;
+            for (size_t i = 0; i < entries.size();) {
+                Entry& e = entries[i];
+                if (!e.scheduled) {
+                    // Saturates instead of overflowing, so XR_INFINITE_DURATION never ends on its own
+                    e.endNs = e.durationNs > kInfiniteNs - nowNs ? kInfiniteNs : nowNs + e.durationNs;
+                    e.scheduled = true;
+                    started = true;
+                }
+                if (e.endNs != kInfiniteNs && e.endNs <= nowNs) entries.erase(entries.begin() + i);
+                else ++i;
+            }
+
+            Output o;
+            for (const Entry& e : entries) {
+                if (!o.active || e.amplitude > o.amplitude) {
+                    o.amplitude = e.amplitude;
+                    o.frequency = e.frequency;
+                }
+                o.active = true;
+                const int64_t remaining = e.endNs == kInfiniteNs ? kInfiniteNs : e.endNs - nowNs;
+                if (remaining > o.remainingNs) o.remainingNs = remaining;
+            }
+
+            changed[h] = started || o != last_[h];
+            out[h] = o;
+            last_[h] = o;
+            any = any || changed[h];
+        }
+        return any;
+    }
+
+private:
+    struct Entry {
+        uint64_t source;
+        int64_t durationNs;
+        int64_t endNs;
+        float amplitude;
+        float frequency;
+        bool scheduled;
+    };
+
+    std::vector<Entry> entries_[kHandCount];
+    Output last_[kHandCount];
+};
+
+} // namespace haptics
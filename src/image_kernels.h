@@ -0,0 +1,276 @@
+// CPU pixel kernels for OpenXR WXR (GL readback, quad layers, MCP screenshots)
+// Row flips, channel swizzles and 8-bit conversions with SSE2/AVX2/NEON paths and scalar references
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMGK_HAVE_SSE2 1
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define IMGK_HAVE_AVX2 1
+#endif
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define IMGK_HAVE_NEON 1
+#endif
+
+namespace imgk {
+
+namespace detail {
+
+// Swaps two non-overlapping byte ranges
+inline void SwapBytes(uint8_t* a, uint8_t* b, size_t n) {
+    size_t i = 0;
+#if defined(IMGK_HAVE_AVX2)
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(a + i), vb);
+        _mm256_storeu_si256((__m256i*)(b + i), va);
+    }
+#endif
+#if defined(IMGK_HAVE_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(a + i), vb);
+        _mm_storeu_si128((__m128i*)(b + i), va);
+    }
+#elif defined(IMGK_HAVE_NEON)
+    for (; i + 16 <= n; i += 16) {
+        uint8x16_t va = vld1q_u8(a + i);
+        uint8x16_t vb = vld1q_u8(b + i);
+        vst1q_u8(a + i, vb);
+        vst1q_u8(b + i, va);
+    }
+#endif
+    for (; i < n; i++) std::swap(a[i], b[i]);
+}
+
+inline uint32_t SwapRB(uint32_t p) {
+    return (p & 0xFF00FF00u) | ((p >> 16) & 0xFFu) | ((p & 0xFFu) << 16);
+}
+
+// IEEE half -> float, handles denormals, inf and NaN
+inline float HalfToFloat(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+    uint32_t exp = (h >> 10) & 0x1Fu;
+    uint32_t mant = h & 0x3FFu;
+    uint32_t bits;
+    if (exp == 0) {
+        if (mant == 0) {
+            bits = sign;
+        }
+        else {
+            // Denormal: renormalize
+            exp = 127 - 15 + 1;
+            while ((mant & 0x400u) == 0) { mant <<= 1; exp--; }
+            bits = sign | (exp << 23) | ((mant & 0x3FFu) << 13);
+        }
+    }
+    else if (exp == 31) {
+        bits = sign | 0x7F800000u | (mant << 13);
+    }
+    else {
+        bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline float LinearToSrgb(float c) {
+    return (c <= 0.0031308f) ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+}
+
+inline uint8_t UnitToByte(float c) {
+    c = std::min(std::max(c, 0.0f), 1.0f);
+    return (uint8_t)(c * 255.0f + 0.5f);
+}
+
+// Halfs in [0, 1] are codes 0x0000..0x3C00; everything above clamps to 255 and negatives to 0
+constexpr uint32_t kHalfOne = 0x3C00u;
+
+struct HalfTables {
+    uint8_t linear[kHalfOne + 1];
+    uint8_t srgb[kHalfOne + 1];
+    HalfTables() {
+        for (uint32_t h = 0; h <= kHalfOne; h++) {
+            float f = HalfToFloat((uint16_t)h);
+            linear[h] = UnitToByte(f);
+            srgb[h] = UnitToByte(LinearToSrgb(f));
+        }
+    }
+};
+
+struct Unorm10Tables {
+    uint8_t linear[1024];
+    uint8_t srgb[1024];
+    Unorm10Tables() {
+        for (uint32_t v = 0; v < 1024; v++) {
+            float f = (float)v / 1023.0f;
+            linear[v] = UnitToByte(f);
+            srgb[v] = UnitToByte(LinearToSrgb(f));
+        }
+    }
+};
+
+inline const HalfTables& GetHalfTables() {
+    static const HalfTables tables;
+    return tables;
+}
+
+inline const Unorm10Tables& GetUnorm10Tables() {
+    static const Unorm10Tables tables;
+    return tables;
+}
+
+inline uint8_t HalfToByte(uint16_t h, const uint8_t* table) {
+    if (h & 0x8000u) return 0;             // Negative (and -0, -NaN)
+    if (h > kHalfOne) return (h > 0x7C00u) ? 0 : 255;  // > 1.0 or +inf clamp; NaN -> 0
+    return table[h];
+}
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// Scalar references (also the fallback for tails and non-SIMD builds)
+// ---------------------------------------------------------------------------
+
+inline void FlipRowsInPlaceScalar(uint8_t* pixels, size_t rowBytes, uint32_t rows, size_t pitch) {
+    for (uint32_t y = 0; y < rows / 2; y++) {
+        uint8_t* top = pixels + (size_t)y * pitch;
+        uint8_t* bottom = pixels + (size_t)(rows - 1 - y) * pitch;
+        for (size_t i = 0; i < rowBytes; i++) std::swap(top[i], bottom[i]);
+    }
+}
+
+inline void SwizzleRBScalar(uint32_t* dst, const uint32_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) dst[i] = detail::SwapRB(src[i]);
+}
+
+// srcRedFirst: RGBA input, otherwise BGRA. Output is BGR (BMP order).
+inline void PackToBGRScalar(uint8_t* dst, const uint8_t* src, size_t count, bool srcRedFirst) {
+    const int r = srcRedFirst ? 0 : 2, b = srcRedFirst ? 2 : 0;
+    for (size_t i = 0; i < count; i++) {
+        dst[i * 3 + 0] = src[i * 4 + b];
+        dst[i * 3 + 1] = src[i * 4 + 1];
+        dst[i * 3 + 2] = src[i * 4 + r];
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Kernels
+// ---------------------------------------------------------------------------
+
+// Reverse row order in place (OpenGL bottom-up <-> D3D top-down). pitch defaults to rowBytes.
+inline void FlipRowsInPlace(void* pixels, size_t rowBytes, uint32_t rows, size_t pitch = 0) {
+    if (!pixels || rows < 2) return;
+    if (pitch == 0) pitch = rowBytes;
+    uint8_t* base = (uint8_t*)pixels;
+    for (uint32_t y = 0; y < rows / 2; y++) {
+        detail::SwapBytes(base + (size_t)y * pitch, base + (size_t)(rows - 1 - y) * pitch, rowBytes);
+    }
+}
+
+// Copy rows in reverse order (flip while copying out of a mapped readback buffer)
+inline void CopyFlipped(void* dst, size_t dstPitch, const void* src, size_t srcPitch, size_t rowBytes, uint32_t rows) {
+    if (!dst || !src) return;
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    for (uint32_t y = 0; y < rows; y++) {
+        memcpy(d + (size_t)y * dstPitch, s + (size_t)(rows - 1 - y) * srcPitch, rowBytes);
+    }
+}
+
+// RGBA <-> BGRA; dst may equal src
+inline void SwizzleRB(uint32_t* dst, const uint32_t* src, size_t count) {
+    size_t i = 0;
+#if defined(IMGK_HAVE_AVX2)
+    const __m256i shuf = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                          2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(v, shuf));
+    }
+#endif
+#if defined(IMGK_HAVE_SSE2)
+    const __m128i ag = _mm_set1_epi32((int)0xFF00FF00u);
+    const __m128i lo = _mm_set1_epi32(0xFF);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i r = _mm_or_si128(_mm_and_si128(v, ag),
+            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), lo), _mm_slli_epi32(_mm_and_si128(v, lo), 16)));
+        _mm_storeu_si128((__m128i*)(dst + i), r);
+    }
+#elif defined(IMGK_HAVE_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t v = vld4q_u8((const uint8_t*)(src + i));
+        uint8x16_t t = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = t;
+        vst4q_u8((uint8_t*)(dst + i), v);
+    }
+#endif
+    for (; i < count; i++) dst[i] = detail::SwapRB(src[i]);
+}
+
+// 4-byte pixels to packed BGR (BMP rows). srcRedFirst: RGBA input, otherwise BGRA.
+inline void PackToBGR(uint8_t* dst, const uint8_t* src, size_t count, bool srcRedFirst) {
+    size_t i = 0;
+#if defined(IMGK_HAVE_AVX2)
+    // 4 pixels -> 12 bytes per 128-bit lane via pshufb, written 12 bytes at a time
+    const __m128i shuf = srcRedFirst
+        ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+        : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    // Each 16-byte store runs 4 bytes past its group, so keep 6 pixels of headroom
+    for (; i + 6 <= count; i += 4) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i * 4)), shuf);
+        _mm_storeu_si128((__m128i*)(dst + i * 3), v);
+    }
+#elif defined(IMGK_HAVE_NEON)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t v = vld4q_u8(src + i * 4);
+        uint8x16x3_t o;
+        o.val[0] = srcRedFirst ? v.val[2] : v.val[0];
+        o.val[1] = v.val[1];
+        o.val[2] = srcRedFirst ? v.val[0] : v.val[2];
+        vst3q_u8(dst + i * 3, o);
+    }
+#endif
+    PackToBGRScalar(dst + i * 3, src + i * 4, count - i, srcRedFirst);
+}
+
+// R16G16B16A16_FLOAT -> 8-bit RGBA (clamped to [0, 1]), optionally sRGB encoded
+inline void HalfToRGBA8(uint8_t* dst, const uint16_t* src, size_t count, bool encodeSrgb) {
+    const detail::HalfTables& t = detail::GetHalfTables();
+    const uint8_t* color = encodeSrgb ? t.srgb : t.linear;
+    for (size_t i = 0; i < count; i++) {
+        dst[i * 4 + 0] = detail::HalfToByte(src[i * 4 + 0], color);
+        dst[i * 4 + 1] = detail::HalfToByte(src[i * 4 + 1], color);
+        dst[i * 4 + 2] = detail::HalfToByte(src[i * 4 + 2], color);
+        dst[i * 4 + 3] = detail::HalfToByte(src[i * 4 + 3], t.linear);  // Alpha is never encoded
+    }
+}
+
+// R10G10B10A2_UNORM -> 8-bit RGBA, optionally sRGB encoded
+inline void Unorm1010102ToRGBA8(uint8_t* dst, const uint32_t* src, size_t count, bool encodeSrgb) {
+    const detail::Unorm10Tables& t = detail::GetUnorm10Tables();
+    const uint8_t* color = encodeSrgb ? t.srgb : t.linear;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t p = src[i];
+        dst[i * 4 + 0] = color[p & 0x3FFu];
+        dst[i * 4 + 1] = color[(p >> 10) & 0x3FFu];
+        dst[i * 4 + 2] = color[(p >> 20) & 0x3FFu];
+        dst[i * 4 + 3] = (uint8_t)((p >> 30) * 85u);  // 0, 85, 170, 255
+    }
+}
+
+} // namespace imgk
@@ -0,0 +1,235 @@
+// Interaction profile tables for OpenXR WXR
+// Controller profiles the simulated controllers can stand in for, every input path each exposes, and the UDP button string layout
+#pragma once
+
+#include "action_bindings.h"
+#include <openxr/openxr.h>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace profiles {
+
+using bindings::Input;
+
+// One path below /user/hand/<side>. input is the channel that drives it; None marks paths the profile
+// has but the feed carries nothing for (trackpads, haptics...), which still bind without error.
+struct InputPath {
+    const char* path;
+    Input input;
+};
+
+struct Profile {
+    const char* path;
+    const char* localizedName;
+    const char* nativeMake;   // Headset make whose controllers this is; preferred over table order on that headset
+    const InputPath* left;
+    size_t leftCount;
+    const InputPath* right;
+    size_t rightCount;
+};
+
+inline constexpr InputPath kTouchLeft[] = {
+    { "/input/x/click", Input::Primary },
+    { "/input/x/touch", Input::PrimaryTouch },
+    { "/input/y/click", Input::Secondary },
+    { "/input/y/touch", Input::SecondaryTouch },
+    { "/input/menu/click", Input::Menu },
+    { "/input/squeeze/value", Input::Squeeze },
+    { "/input/trigger/value", Input::Trigger },
+    { "/input/trigger/touch", Input::TriggerTouch },
+    { "/input/thumbstick", Input::Thumbstick },
+    { "/input/thumbstick/x", Input::ThumbstickX },
+    { "/input/thumbstick/y", Input::ThumbstickY },
+    { "/input/thumbstick/click", Input::ThumbstickClick },
+    { "/input/thumbstick/touch", Input::ThumbstickTouch },
+    { "/input/thumbrest/touch", Input::ThumbrestTouch },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+inline constexpr InputPath kTouchRight[] = {
+    { "/input/a/click", Input::Primary },
+    { "/input/a/touch", Input::PrimaryTouch },
+    { "/input/b/click", Input::Secondary },
+    { "/input/b/touch", Input::SecondaryTouch },
+    { "/input/system/click", Input::Menu },
+    { "/input/squeeze/value", Input::Squeeze },
+    { "/input/trigger/value", Input::Trigger },
+    { "/input/trigger/touch", Input::TriggerTouch },
+    { "/input/thumbstick", Input::Thumbstick },
+    { "/input/thumbstick/x", Input::ThumbstickX },
+    { "/input/thumbstick/y", Input::ThumbstickY },
+    { "/input/thumbstick/click", Input::ThumbstickClick },
+    { "/input/thumbstick/touch", Input::ThumbstickTouch },
+    { "/input/thumbrest/touch", Input::ThumbrestTouch },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+inline constexpr InputPath kPico4Left[] = {
+    { "/input/x/click", Input::Primary },
+    { "/input/x/touch", Input::PrimaryTouch },
+    { "/input/y/click", Input::Secondary },
+    { "/input/y/touch", Input::SecondaryTouch },
+    { "/input/menu/click", Input::Menu },
+    { "/input/system/click", Input::None },
+    { "/input/trigger/click", Input::Trigger },
+    { "/input/trigger/value", Input::Trigger },
+    { "/input/trigger/touch", Input::TriggerTouch },
+    { "/input/thumbstick", Input::Thumbstick },
+    { "/input/thumbstick/x", Input::ThumbstickX },
+    { "/input/thumbstick/y", Input::ThumbstickY },
+    { "/input/thumbstick/click", Input::ThumbstickClick },
+    { "/input/thumbstick/touch", Input::ThumbstickTouch },
+    { "/input/squeeze/click", Input::Squeeze },
+    { "/input/squeeze/value", Input::Squeeze },
+    { "/input/thumbrest/touch", Input::ThumbrestTouch },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+inline constexpr InputPath kPico4Right[] = {
+    { "/input/a/click", Input::Primary },
+    { "/input/a/touch", Input::PrimaryTouch },
+    { "/input/b/click", Input::Secondary },
+    { "/input/b/touch", Input::SecondaryTouch },
+    { "/input/system/click", Input::Menu },
+    { "/input/trigger/click", Input::Trigger },
+    { "/input/trigger/value", Input::Trigger },
+    { "/input/trigger/touch", Input::TriggerTouch },
+    { "/input/thumbstick", Input::Thumbstick },
+    { "/input/thumbstick/x", Input::ThumbstickX },
+    { "/input/thumbstick/y", Input::ThumbstickY },
+    { "/input/thumbstick/click", Input::ThumbstickClick },
+    { "/input/thumbstick/touch", Input::ThumbstickTouch },
+    { "/input/squeeze/click", Input::Squeeze },
+    { "/input/squeeze/value", Input::Squeeze },
+    { "/input/thumbrest/touch", Input::ThumbrestTouch },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+// Same inputs on both hands
+inline constexpr InputPath kIndex[] = {
+    { "/input/system/click", Input::Menu },
+    { "/input/system/touch", Input::None },
+    { "/input/a/click", Input::Primary },
+    { "/input/a/touch", Input::PrimaryTouch },
+    { "/input/b/click", Input::Secondary },
+    { "/input/b/touch", Input::SecondaryTouch },
+    { "/input/squeeze/value", Input::Squeeze },
+    { "/input/squeeze/force", Input::Squeeze },
+    { "/input/trigger/click", Input::Trigger },
+    { "/input/trigger/value", Input::Trigger },
+    { "/input/trigger/touch", Input::TriggerTouch },
+    { "/input/thumbstick", Input::Thumbstick },
+    { "/input/thumbstick/x", Input::ThumbstickX },
+    { "/input/thumbstick/y", Input::ThumbstickY },
+    { "/input/thumbstick/click", Input::ThumbstickClick },
+    { "/input/thumbstick/touch", Input::ThumbstickTouch },
+    { "/input/trackpad", Input::None },
+    { "/input/trackpad/x", Input::None },
+    { "/input/trackpad/y", Input::None },
+    { "/input/trackpad/force", Input::None },
+    { "/input/trackpad/touch", Input::None },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+inline constexpr InputPath kSimple[] = {
+    { "/input/select/click", Input::Trigger },
+    { "/input/menu/click", Input::Menu },
+    { "/input/grip/pose", Input::Pose },
+    { "/input/aim/pose", Input::Pose },
+    { "/output/haptic", Input::None },
+};
+
+// Closest match to the simulated (Touch-style) controllers first
+inline constexpr Profile kProfiles[] = {
+    { "/interaction_profiles/oculus/touch_controller", "Oculus Touch Controller", "META",
+        kTouchLeft, std::size(kTouchLeft), kTouchRight, std::size(kTouchRight) },
+    { "/interaction_profiles/bytedance/pico4_controller", "PICO 4 Controller", "PICO",
+        kPico4Left, std::size(kPico4Left), kPico4Right, std::size(kPico4Right) },
+    { "/interaction_profiles/valve/index_controller", "Valve Index Controller", nullptr,
+        kIndex, std::size(kIndex), kIndex, std::size(kIndex) },
+    { "/interaction_profiles/khr/simple_controller", "Khronos Simple Controller", nullptr,
+        kSimple, std::size(kSimple), kSimple, std::size(kSimple) },
+};
+
+// Component an identifier-only path ("/input/trigger") stands for, by action type, in order of preference
+inline size_t DefaultComponents(XrActionType type, const char* (&out)[2]) {
+    switch (type) {
+    case XR_ACTION_TYPE_BOOLEAN_INPUT: out[0] = "click"; out[1] = "value"; return 2;
+    case XR_ACTION_TYPE_FLOAT_INPUT: out[0] = "value"; out[1] = "click"; return 2;
+    case XR_ACTION_TYPE_POSE_INPUT: out[0] = "pose"; return 1;
+    default: return 0;
+    }
+}
+
+// Looks subpath ("/input/trigger/value") up in one hand's table. An identifier-only subpath resolves to the
+// component DefaultComponents picks for the action's type. nullptr if the profile has no such path.
+inline const InputPath* FindInput(const InputPath* inputs, size_t count, std::string_view subpath, XrActionType type) {
+    for (size_t i = 0; i < count; ++i) {
+        if (subpath == inputs[i].path) return &inputs[i];
+    }
+    const char* components[2];
+    const size_t componentCount = DefaultComponents(type, components);
+    for (size_t c = 0; c < componentCount; ++c) {
+        const std::string_view component = components[c];
+        for (size_t i = 0; i < count; ++i) {
+            const std::string_view path = inputs[i].path;
+            if (path.size() == subpath.size() + 1 + component.size() && path.substr(0, subpath.size()) == subpath &&
+                path[subpath.size()] == '/' && path.substr(subpath.size() + 1) == component) {
+                return &inputs[i];
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Lower is better: the headset's own controllers, then table order
+inline size_t Rank(size_t profileIndex, const std::string& hmdMake) {
+    const Profile& p = kProfiles[profileIndex];
+    if (p.nativeMake && hmdMake == p.nativeMake) return 0;
+    return profileIndex + 1;
+}
+
+// What each character of the UDP button string reports. Thumbstick directions are digital duplicates
+// of the analog axes and drive no channel of their own.
+struct ButtonSlot {
+    bindings::Hand hand;
+    Input input;
+};
+
+inline constexpr ButtonSlot kButtonString[] = {
+    { bindings::kHandLeft, Input::Squeeze },          // L_GRIP
+    { bindings::kHandLeft, Input::Menu },             // L_MENU
+    { bindings::kHandLeft, Input::ThumbstickClick },  // L_THUMBSTICK_PRESS
+    { bindings::kHandLeft, Input::None },             // L_THUMBSTICK_LEFT
+    { bindings::kHandLeft, Input::None },             // L_THUMBSTICK_RIGHT
+    { bindings::kHandLeft, Input::None },             // L_THUMBSTICK_UP
+    { bindings::kHandLeft, Input::None },             // L_THUMBSTICK_DOWN
+    { bindings::kHandLeft, Input::Trigger },          // L_TRIGGER
+    { bindings::kHandLeft, Input::Primary },          // L_X
+    { bindings::kHandLeft, Input::Secondary },        // L_Y
+    { bindings::kHandRight, Input::Primary },         // R_A
+    { bindings::kHandRight, Input::Secondary },       // R_B
+    { bindings::kHandRight, Input::Squeeze },         // R_GRIP
+    { bindings::kHandRight, Input::ThumbstickClick }, // R_THUMBSTICK_PRESS
+    { bindings::kHandRight, Input::None },            // R_THUMBSTICK_LEFT
+    { bindings::kHandRight, Input::None },            // R_THUMBSTICK_RIGHT
+    { bindings::kHandRight, Input::None },            // R_THUMBSTICK_UP
+    { bindings::kHandRight, Input::None },            // R_THUMBSTICK_DOWN
+    { bindings::kHandRight, Input::Trigger },         // R_TRIGGER
+};
+
+inline constexpr size_t kButtonCount = std::size(kButtonString);
+
+} // namespace profiles
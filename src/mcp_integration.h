@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstring>
 #include <cstdarg>
+#include "image_kernels.h"
 
 namespace mcp {
 
@@ -169,29 +170,27 @@ inline bool SaveTextureToBMP(ID3D11Device* device, ID3D11DeviceContext* ctx,
 
     // Write pixel data (BMP is bottom-up, BGR)
     std::vector<uint8_t> row(rowStride, 0);
+    std::vector<uint8_t> rgba8;
     uint8_t* src = (uint8_t*)mapped.pData;
 
+    // Wide formats are converted to 8-bit RGBA first; float16 is linear, so it gets sRGB encoded
+    const bool isHalf = desc.Format == DXGI_FORMAT_R16G16B16A16_FLOAT;
+    const bool is1010102 = desc.Format == DXGI_FORMAT_R10G10B10A2_UNORM;
+    const bool isBGRA = desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM ||
+                        desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+    if (isHalf || is1010102) rgba8.resize((size_t)w * 4);
+
     for (int y = h - 1; y >= 0; y--) {
-        uint8_t* srcRow = src + y * mapped.RowPitch;
-        for (uint32_t x = 0; x < w; x++) {
-            // Handle different DXGI formats
-            if (desc.Format == DXGI_FORMAT_R8G8B8A8_UNORM ||
-                desc.Format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB) {
-                row[x*3 + 0] = srcRow[x*4 + 2]; // B
-                row[x*3 + 1] = srcRow[x*4 + 1]; // G
-                row[x*3 + 2] = srcRow[x*4 + 0]; // R
-            } else if (desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM ||
-                       desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM_SRGB) {
-                row[x*3 + 0] = srcRow[x*4 + 0]; // B
-                row[x*3 + 1] = srcRow[x*4 + 1]; // G
-                row[x*3 + 2] = srcRow[x*4 + 2]; // R
-            } else {
-                // Fallback - assume RGBA
-                row[x*3 + 0] = srcRow[x*4 + 2];
-                row[x*3 + 1] = srcRow[x*4 + 1];
-                row[x*3 + 2] = srcRow[x*4 + 0];
-            }
+        const uint8_t* srcRow = src + y * mapped.RowPitch;
+        if (isHalf) {
+            imgk::HalfToRGBA8(rgba8.data(), (const uint16_t*)srcRow, w, true);
+            srcRow = rgba8.data();
+        } else if (is1010102) {
+            imgk::Unorm1010102ToRGBA8(rgba8.data(), (const uint32_t*)srcRow, w, false);
+            srcRow = rgba8.data();
         }
+        // Anything else is assumed to be RGBA
+        imgk::PackToBGR(row.data(), srcRow, w, !isBGRA);
         fwrite(row.data(), 1, rowStride, file);
     }
 
@@ -266,13 +265,8 @@ inline bool SavePixelsToBMP(const uint8_t* pixels, uint32_t width, uint32_t heig
     std::vector<uint8_t> row(rowStride, 0);
 
     for (int y = height - 1; y >= 0; y--) {
-        const uint8_t* srcRow = pixels + y * width * 4;
-        for (uint32_t x = 0; x < width; x++) {
-            // RGBA to BGR
-            row[x*3 + 0] = srcRow[x*4 + 2]; // B
-            row[x*3 + 1] = srcRow[x*4 + 1]; // G
-            row[x*3 + 2] = srcRow[x*4 + 0]; // R
-        }
+        const uint8_t* srcRow = pixels + (size_t)y * width * 4;
+        imgk::PackToBGR(row.data(), srcRow, width, true);  // RGBA to BGR
         fwrite(row.data(), 1, rowStride, file);
     }
 
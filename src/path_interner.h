@@ -0,0 +1,192 @@
+// Path interner for OpenXR WXR
+// XrPath values are dense IDs into an arena of path strings, with an open-addressing index for string -> path
+#pragma once
+
+#include <openxr/openxr.h>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace paths {
+
+// Absolute, no empty components, no trailing slash, within XR_MAX_PATH_LENGTH
+inline bool IsWellFormed(std::string_view path) {
+    if (path.empty() || path.size() >= XR_MAX_PATH_LENGTH || path.front() != '/' || path.back() == '/') return false;
+    return path.find("//") == std::string_view::npos;
+}
+
+// XrPath n refers to the n-th interned string (1-based, so XR_NULL_PATH is never issued).
+// Strings never move once interned; views handed out stay valid for the interner's lifetime.
+// Intern serializes on a mutex, but View, Contains, Find and Size never lock: xrPathToString, the binding lookups
+// and every xrGetActionState* subaction check read while the app may be interning on another thread. Entries
+// live in chunks that never move, published by a release store of the count after they are written; the index
+// is swapped whole on rehash and old tables are kept until the interner goes, so a reader never sees freed memory.
+class Interner {
+public:
+    // Preinterned paths get IDs 1, 2, ... in list order, so callers can name them as constants
+    explicit Interner(std::initializer_list<std::string_view> preinterned = {}) {
+        for (std::string_view path : preinterned) InternLocked(path, Hash(path));
+    }
+
+    Interner(const Interner&) = delete;
+    Interner& operator=(const Interner&) = delete;
+
+    XrPath Intern(std::string_view path) {
+        const uint32_t hash = Hash(path);
+        if (XrPath existing = FindHashed(path, hash)) return existing;
+        std::lock_guard<std::mutex> lock(mutex_);
+        return InternLocked(path, hash);
+    }
+
+    // XR_NULL_PATH if the string was never interned
+    XrPath Find(std::string_view path) const {
+        return FindHashed(path, Hash(path));
+    }
+
+    // Empty view for XR_NULL_PATH and unknown IDs
+    std::string_view View(XrPath path) const {
+        if (!Contains(path)) return std::string_view();
+        const Entry& e = At((uint32_t)path - 1);
+        return std::string_view(e.str, e.length);
+    }
+
+    bool Contains(XrPath path) const {
+        return path != XR_NULL_PATH && path <= count_.load(std::memory_order_acquire);
+    }
+
+    size_t Size() const {
+        return count_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t kBlockSize = 4096;
+    // Chunk c holds kFirstChunk << c entries, so 25 chunks cover every 32-bit ID
+    static constexpr uint32_t kFirstChunk = 256;
+    static constexpr uint32_t kMaxChunks = 25;
+
+    struct Entry {
+        const char* str;
+        uint32_t length;
+        uint32_t hash;
+    };
+
+    // Open addressing, 0 = empty, else path ID
+    struct Index {
+        explicit Index(size_t size) : mask(size - 1), slots(new std::atomic<uint32_t>[size]) {
+            for (size_t i = 0; i < size; ++i) slots[i].store(0, std::memory_order_relaxed);
+        }
+        size_t mask;
+        std::unique_ptr<std::atomic<uint32_t>[]> slots;
+    };
+
+    // FNV-1a
+    static uint32_t Hash(std::string_view s) {
+        uint32_t h = 2166136261u;
+        for (char c : s) {
+            h ^= (uint8_t)c;
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    static void Locate(uint32_t i, uint32_t& chunk, uint32_t& offset) {
+        const uint64_t q = (uint64_t)i / kFirstChunk + 1;
+        uint32_t c = 0;
+        while ((q >> (c + 1)) != 0) ++c;
+        chunk = c;
+        offset = (uint32_t)(i - (uint64_t)kFirstChunk * ((1ull << c) - 1));
+    }
+
+    // i must be below the published count (or be the entry being written under the mutex)
+    const Entry& At(uint32_t i) const {
+        uint32_t chunk, offset;
+        Locate(i, chunk, offset);
+        return chunks_[chunk].load(std::memory_order_acquire)[offset];
+    }
+
+    XrPath FindHashed(std::string_view path, uint32_t hash) const {
+        const Index* index = index_.load(std::memory_order_acquire);
+        if (!index) return XR_NULL_PATH;
+        for (size_t slot = hash & index->mask;; slot = (slot + 1) & index->mask) {
+            const uint32_t id = index->slots[slot].load(std::memory_order_acquire);
+            if (id == 0) return XR_NULL_PATH;
+            const Entry& e = At(id - 1);
+            if (e.hash == hash && std::string_view(e.str, e.length) == path) return (XrPath)id;
+        }
+    }
+
+    static void Insert(Index& index, uint32_t id, uint32_t hash) {
+        size_t slot = hash & index.mask;
+        while (index.slots[slot].load(std::memory_order_relaxed) != 0) slot = (slot + 1) & index.mask;
+        index.slots[slot].store(id, std::memory_order_release);
+    }
+
+    XrPath InternLocked(std::string_view path, uint32_t hash) {
+        if (XrPath existing = FindHashed(path, hash)) return existing;
+
+        const uint32_t id = count_.load(std::memory_order_relaxed) + 1;
+        uint32_t chunk, offset;
+        Locate(id - 1, chunk, offset);
+        if (offset == 0) {
+            chunkStorage_.push_back(std::make_unique<Entry[]>((size_t)kFirstChunk << chunk));
+            chunks_[chunk].store(chunkStorage_.back().get(), std::memory_order_release);
+        }
+        chunkStorage_.back()[offset] = Entry{ Store(path), (uint32_t)path.size(), hash };
+        count_.store(id, std::memory_order_release);
+
+        // Keep the index at most half full
+        Index* index = indexes_.empty() ? nullptr : indexes_.back().get();
+        if (!index || (size_t)id * 2 > index->mask + 1) {
+            Rehash(index ? (index->mask + 1) * 2 : 256);
+        }
+        else {
+            Insert(*index, id, hash);
+        }
+        return (XrPath)id;
+    }
+
+    // Builds the bigger table off to the side and swaps it in; readers still on the old one see every path but the newest
+    void Rehash(size_t slots) {
+        auto index = std::make_unique<Index>(slots);
+        const uint32_t count = count_.load(std::memory_order_relaxed);
+        for (uint32_t id = 1; id <= count; ++id) Insert(*index, id, At(id - 1).hash);
+        index_.store(index.get(), std::memory_order_release);
+        indexes_.push_back(std::move(index));
+    }
+
+    // Copies the string (null-terminated) into the arena
+    const char* Store(std::string_view path) {
+        const size_t need = path.size() + 1;
+        if (blocks_.empty() || blockUsed_ + need > blockSize_) {
+            blockSize_ = need > kBlockSize ? need : kBlockSize;
+            blocks_.push_back(std::make_unique<char[]>(blockSize_));
+            blockUsed_ = 0;
+        }
+        char* dst = blocks_.back().get() + blockUsed_;
+        std::memcpy(dst, path.data(), path.size());
+        dst[path.size()] = '\0';
+        blockUsed_ += need;
+        return dst;
+    }
+
+    // Read without the lock
+    std::atomic<uint32_t> count_{ 0 };
+    std::atomic<Entry*> chunks_[kMaxChunks]{};
+    std::atomic<const Index*> index_{ nullptr };
+
+    // Owned by writers under mutex_
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry[]>> chunkStorage_;
+    std::vector<std::unique_ptr<Index>> indexes_;     // Current table last, retired ones kept for readers
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t blockSize_{ 0 };
+    size_t blockUsed_{ 0 };
+};
+
+} // namespace paths
@@ -0,0 +1,121 @@
+// Compile-time perfect hash for OpenXR WXR entry point lookup
+// Every known name gets its own slot through a per-bucket displacement chosen at compile time, so a lookup is one hash and one compare
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace procdispatch {
+
+// FNV-1a
+constexpr uint64_t Hash(std::string_view s) {
+    uint64_t h = 14695981039346656037ull;
+    for (char c : s) {
+        h ^= (uint8_t)c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Rehashes the name's hash with its bucket's displacement (murmur3 finalizer), no second pass over the string
+constexpr uint64_t Mix(uint64_t h, uint32_t displacement) {
+    h += (uint64_t)displacement * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+}
+
+constexpr size_t NextPow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+template <size_t N>
+class PerfectHash {
+public:
+    static constexpr size_t kSlots = NextPow2(N * 2);
+    static constexpr size_t kBuckets = NextPow2((N + 1) / 2);
+    static constexpr uint32_t kEmpty = (uint32_t)N;
+    static constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+    // Buckets are placed largest first, each trying displacements until all of its names land in free slots.
+    // Duplicate names can never be separated: ok_ stays false and the caller's static_assert catches it.
+    constexpr explicit PerfectHash(const std::string_view (&names)[N]) {
+        for (size_t i = 0; i < N; ++i) names_[i] = names[i];
+        for (size_t s = 0; s < kSlots; ++s) slots_[s] = kEmpty;
+
+        uint64_t hashes[N]{};
+        uint32_t bucketSize[kBuckets]{};
+        uint32_t maxBucketSize = 0;
+        for (size_t i = 0; i < N; ++i) {
+            hashes[i] = Hash(names[i]);
+            uint32_t size = ++bucketSize[Bucket(hashes[i])];
+            if (size > maxBucketSize) maxBucketSize = size;
+        }
+
+        // Names grouped by bucket (counting sort) so each attempt only touches its own bucket
+        uint32_t bucketStart[kBuckets + 1]{};
+        for (size_t b = 0; b < kBuckets; ++b) bucketStart[b + 1] = bucketStart[b] + bucketSize[b];
+        uint32_t fill[kBuckets]{};
+        uint32_t order[N]{};
+        for (size_t i = 0; i < N; ++i) {
+            size_t b = Bucket(hashes[i]);
+            order[bucketStart[b] + fill[b]++] = (uint32_t)i;
+        }
+
+        bool used[kSlots]{};
+        uint32_t placed[N]{};
+        for (uint32_t size = maxBucketSize; size > 0; --size) {
+            for (size_t b = 0; b < kBuckets; ++b) {
+                if (bucketSize[b] != size) continue;
+                uint32_t d = 0;
+                for (; d < kMaxDisplacement; ++d) {
+                    uint32_t count = 0;
+                    for (uint32_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k) {
+                        size_t s = Slot(hashes[order[k]], d);
+                        if (used[s]) break;
+                        used[s] = true;
+                        placed[count++] = (uint32_t)s;
+                    }
+                    if (count == size) break;
+                    for (uint32_t k = 0; k < count; ++k) used[placed[k]] = false;
+                }
+                if (d == kMaxDisplacement) return;
+                displacement_[b] = d;
+                for (uint32_t k = bucketStart[b]; k < bucketStart[b + 1]; ++k) {
+                    slots_[Slot(hashes[order[k]], d)] = order[k];
+                }
+            }
+        }
+        ok_ = true;
+    }
+
+    constexpr bool Ok() const { return ok_; }
+
+    // Index of name in the list it was built from, or N
+    constexpr size_t Find(std::string_view name) const {
+        uint64_t h = Hash(name);
+        uint32_t index = slots_[Slot(h, displacement_[Bucket(h)])];
+        return (index != kEmpty && names_[index] == name) ? index : N;
+    }
+
+private:
+    static constexpr size_t Bucket(uint64_t h) { return (size_t)(h >> 32) & (kBuckets - 1); }
+    static constexpr size_t Slot(uint64_t h, uint32_t displacement) { return (size_t)Mix(h, displacement) & (kSlots - 1); }
+
+    std::array<std::string_view, N> names_{};
+    std::array<uint32_t, kSlots> slots_{};
+    std::array<uint32_t, kBuckets> displacement_{};
+    bool ok_{ false };
+};
+
+template <size_t N>
+constexpr PerfectHash<N> Build(const std::string_view (&names)[N]) {
+    return PerfectHash<N>(names);
+}
+
+} // namespace procdispatch
@@ -0,0 +1,77 @@
+// Readback ring bookkeeping for OpenXR WXR
+// Decides which slot a frame's GPU->CPU copy goes into and which finished copy is shown; the caller owns the GPU objects in each slot
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace readback {
+
+// Frame N is queued into one slot and frame N-1 is shown from the slot before it, so the GPU gets a whole
+// frame to finish a copy before anyone waits on it. Slot is whatever the backend keeps per frame (PBOs and a
+// fence in the runtime); the ring only tracks which slots hold a queued copy that has not been shown yet.
+template <typename Slot, uint32_t Count>
+class Ring {
+    static_assert(Count >= 2, "a readback ring needs a slot to write and one to read");
+
+public:
+    // Returns true when the size changed: every slot is forgotten and the caller must (re)create its storage
+    bool Configure(uint32_t width, uint32_t height) {
+        if (width == width_ && height == height_) return false;
+        width_ = width;
+        height_ = height;
+        for (auto& q : queued_) q = false;
+        next_ = 0;
+        return true;
+    }
+
+    // Claims the slot for this frame's copy. superseded is set when the slot still held a copy that was never
+    // shown; the caller drops whatever GPU work that copy left behind before reusing the slot.
+    Slot& Queue(bool& superseded) {
+        const uint32_t cur = next_;
+        next_ = (cur + 1) % Count;
+        superseded = queued_[cur];
+        queued_[cur] = true;
+        return slots_[cur];
+    }
+
+    // The copy queued one frame before the last Queue, or nullptr when there is none (first frame after a resize)
+    Slot* Previous() {
+        const uint32_t prev = (next_ + Count - 2) % Count;
+        return queued_[prev] ? &slots_[prev] : nullptr;
+    }
+
+    // The previous copy was taken out; its slot is free until Queue comes round to it again
+    void Consumed(const Slot& slot) { queued_[IndexOf(slot)] = false; }
+
+    // The previous copy was not finished in time and the older image stays on screen
+    void Late() { ++lateFrames_; }
+
+    // Forgets every slot and the size; the caller has already released the GPU objects
+    void Reset() {
+        for (auto& s : slots_) s = Slot{};
+        for (auto& q : queued_) q = false;
+        width_ = 0;
+        height_ = 0;
+        next_ = 0;
+    }
+
+    bool Queued(const Slot& slot) const { return queued_[IndexOf(slot)]; }
+    Slot* begin() { return slots_; }
+    Slot* end() { return slots_ + Count; }
+    uint32_t Width() const { return width_; }
+    uint32_t Height() const { return height_; }
+    uint64_t LateFrames() const { return lateFrames_; }
+
+private:
+    size_t IndexOf(const Slot& slot) const { return (size_t)(&slot - slots_); }
+
+    Slot slots_[Count]{};
+    bool queued_[Count]{};
+    uint32_t width_{ 0 };
+    uint32_t height_{ 0 };
+    uint32_t next_{ 0 };
+    uint64_t lateFrames_{ 0 };
+};
+
+} // namespace readback
@@ -0,0 +1,307 @@
+// Depth-aware reprojection for OpenXR WXR (XR_KHR_composition_layer_depth)
+// Pose/depth math shared by the D3D11 warp shader and the CPU reference kernel used by the OpenGL path
+#pragma once
+
+#include <openxr/openxr.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define REPROJ_HAVE_SSE2 1
+#endif
+
+namespace reproj {
+
+// Anything closer than this (in 1/meters) is treated as infinitely far (10 km)
+constexpr float kMinInverseDistance = 1.0e-4f;
+
+// Pose change below which a submitted frame is shown as-is
+constexpr float kMinTranslationMeters = 0.0005f;
+constexpr float kMinRotationRadians = 0.0005f;
+
+// Tangent-space extents of a view, derived from the XrFovf the app rendered with
+struct FovTangents {
+    float left, right, up, down;
+};
+
+inline FovTangents TangentsFromFov(const XrFovf& fov) {
+    return { tanf(fov.angleLeft), tanf(fov.angleRight), tanf(fov.angleUp), tanf(fov.angleDown) };
+}
+
+// Mapping from depth-buffer values to view distance, following XrCompositionLayerDepthInfoKHR:
+// minDepth maps to nearZ and maxDepth to farZ, 1/z is linear in between.
+// Works for reversed-Z (nearZ > farZ) and infinite far planes.
+struct DepthRange {
+    float minDepth, maxDepth;
+    float invNear, invFar;
+};
+
+inline float SafeInverse(float z) {
+    return (z > 0.0f && std::isfinite(z)) ? 1.0f / z : 0.0f;
+}
+
+inline DepthRange MakeDepthRange(float minDepth, float maxDepth, float nearZ, float farZ) {
+    DepthRange r;
+    r.minDepth = minDepth;
+    r.maxDepth = (maxDepth > minDepth) ? maxDepth : minDepth + 1.0f;
+    r.invNear = SafeInverse(nearZ);
+    r.invFar = SafeInverse(farZ);
+    return r;
+}
+
+// Everything at infinity: the warp degenerates to a rotation-only timewarp
+inline DepthRange RotationOnlyDepthRange() {
+    return { 0.0f, 1.0f, 0.0f, 0.0f };
+}
+
+inline float LinearDistance(float depth, const DepthRange& r) {
+    float t = (depth - r.minDepth) / (r.maxDepth - r.minDepth);
+    t = std::min(std::max(t, 0.0f), 1.0f);
+    float invZ = r.invNear + t * (r.invFar - r.invNear);
+    return 1.0f / std::max(invZ, kMinInverseDistance);
+}
+
+inline XrQuaternionf Normalize(const XrQuaternionf& q) {
+    float len = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    if (len <= 0.0f) return { 0.0f, 0.0f, 0.0f, 1.0f };
+    return { q.x / len, q.y / len, q.z / len, q.w / len };
+}
+
+inline void QuatToMatrix(const XrQuaternionf& qIn, float m[3][3]) {
+    XrQuaternionf q = Normalize(qIn);
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    m[0][0] = 1.0f - 2.0f * (yy + zz); m[0][1] = 2.0f * (xy - wz);        m[0][2] = 2.0f * (xz + wy);
+    m[1][0] = 2.0f * (xy + wz);        m[1][1] = 1.0f - 2.0f * (xx + zz); m[1][2] = 2.0f * (yz - wx);
+    m[2][0] = 2.0f * (xz - wy);        m[2][1] = 2.0f * (yz + wx);        m[2][2] = 1.0f - 2.0f * (xx + yy);
+}
+
+inline XrVector3f Rotate(const XrQuaternionf& q, const XrVector3f& v) {
+    float m[3][3];
+    QuatToMatrix(q, m);
+    return {
+        m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+        m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+        m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z
+    };
+}
+
+// Eye pose from a head pose, matching the IPD offset applied by xrLocateViews
+inline XrPosef EyePoseFromHead(const XrPosef& head, float eyeOffsetX) {
+    XrVector3f offset = Rotate(head.orientation, { eyeOffsetX, 0.0f, 0.0f });
+    XrPosef eye;
+    eye.orientation = head.orientation;
+    eye.position = { head.position.x + offset.x, head.position.y + offset.y, head.position.z + offset.z };
+    return eye;
+}
+
+// Rigid transform taking points from the rendered eye space into the target eye space (3x4, row-major)
+struct EyeDelta {
+    float m[3][4];
+};
+
+inline EyeDelta ComputeEyeDelta(const XrPosef& rendered, const XrPosef& target) {
+    // p_target = Rt^T * (Rr * p + Tr - Tt)
+    float rr[3][3], rtm[3][3];
+    QuatToMatrix(rendered.orientation, rr);
+    QuatToMatrix(target.orientation, rtm);
+    const float dt[3] = {
+        rendered.position.x - target.position.x,
+        rendered.position.y - target.position.y,
+        rendered.position.z - target.position.z
+    };
+    EyeDelta d{};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            d.m[i][j] = rtm[0][i] * rr[0][j] + rtm[1][i] * rr[1][j] + rtm[2][i] * rr[2][j];
+        }
+        d.m[i][3] = rtm[0][i] * dt[0] + rtm[1][i] * dt[1] + rtm[2][i] * dt[2];
+    }
+    return d;
+}
+
+inline bool NeedsReprojection(const XrPosef& rendered, const XrPosef& target) {
+    float dx = rendered.position.x - target.position.x;
+    float dy = rendered.position.y - target.position.y;
+    float dz = rendered.position.z - target.position.z;
+    if (dx * dx + dy * dy + dz * dz > kMinTranslationMeters * kMinTranslationMeters) return true;
+    XrQuaternionf a = Normalize(rendered.orientation);
+    XrQuaternionf b = Normalize(target.orientation);
+    float dot = fabsf(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+    float angle = 2.0f * acosf(std::min(dot, 1.0f));
+    return angle > kMinRotationRadians;
+}
+
+// Projects a rendered-eye ray (tangent x/y) at the given distance into the target image.
+// Returns false when the point lands behind the target eye.
+inline bool ProjectSample(float tx, float ty, float dist, const EyeDelta& d, const FovTangents& dstFov,
+    float& outU, float& outV, float& outDepth) {
+    // Rendered-eye point: dist * (tx, ty, -1)
+    float px = dist * tx, py = dist * ty, pz = -dist;
+    float qx = d.m[0][0] * px + d.m[0][1] * py + d.m[0][2] * pz + d.m[0][3];
+    float qy = d.m[1][0] * px + d.m[1][1] * py + d.m[1][2] * pz + d.m[1][3];
+    float qz = d.m[2][0] * px + d.m[2][1] * py + d.m[2][2] * pz + d.m[2][3];
+    float qd = -qz;
+    if (qd <= kMinInverseDistance) return false;
+    outU = (qx / qd - dstFov.left) / (dstFov.right - dstFov.left);
+    outV = (dstFov.up - qy / qd) / (dstFov.up - dstFov.down);
+    outDepth = qd;
+    return true;
+}
+
+namespace detail {
+
+inline void SplatSample(uint32_t color, float fx, float fy, float qd, uint32_t width, uint32_t height,
+    uint32_t* dst, float* zbuf) {
+    if (!(qd > kMinInverseDistance) || !(fx >= 0.0f) || !(fy >= 0.0f)) return;
+    uint32_t x = (uint32_t)fx, y = (uint32_t)fy;
+    if (x >= width || y >= height) return;
+    size_t i = (size_t)y * width + x;
+    if (qd < zbuf[i]) {
+        zbuf[i] = qd;
+        dst[i] = color;
+    }
+}
+
+// Fill pixels no sample landed on from the farther of two neighbours, so disocclusions are patched with
+// background rather than smeared foreground. One-pixel gaps between rows go first: a warp that stretches the
+// image vertically leaves every few rows sparse, and filling those along the row would pull in pixels from
+// the far end of a long run. Whatever is left is filled from the ends of its horizontal run.
+inline void FillHoles(const uint32_t* src, uint32_t width, uint32_t height, uint32_t* dst, float* zbuf) {
+    const float empty = std::numeric_limits<float>::infinity();
+    for (uint32_t y = 1; y + 1 < height; ++y) {
+        float* zRow = zbuf + (size_t)y * width;
+        const float* zUp = zRow - width;
+        const float* zDown = zRow + width;
+        uint32_t* dRow = dst + (size_t)y * width;
+        for (uint32_t x = 0; x < width; ++x) {
+            if (zRow[x] != empty || zUp[x] == empty || zDown[x] == empty) continue;
+            const bool fromUp = zUp[x] > zDown[x];
+            dRow[x] = fromUp ? dRow[x - width] : dRow[x + width];
+            zRow[x] = fromUp ? zUp[x] : zDown[x];
+        }
+    }
+    for (uint32_t y = 0; y < height; ++y) {
+        const float* zRow = zbuf + (size_t)y * width;
+        uint32_t* dRow = dst + (size_t)y * width;
+        const uint32_t* sRow = src + (size_t)y * width;
+        uint32_t x = 0;
+        while (x < width) {
+            if (zRow[x] != empty) { ++x; continue; }
+            uint32_t start = x;
+            while (x < width && zRow[x] == empty) ++x;
+            bool hasLeft = start > 0;
+            bool hasRight = x < width;
+            for (uint32_t i = start; i < x; ++i) {
+                if (hasLeft && hasRight) dRow[i] = (zRow[start - 1] > zRow[x]) ? dRow[start - 1] : dRow[x];
+                else if (hasLeft) dRow[i] = dRow[start - 1];
+                else if (hasRight) dRow[i] = dRow[x];
+                else dRow[i] = sRow[i];
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+// CPU reference kernel: forward-splats every source pixel into the target eye with a nearest-wins
+// depth test, then fills holes. Images are tightly packed 32-bit pixels, top row first, same size
+// for source and target. srcDepth may be null for a rotation-only warp. zbuf is reused between calls.
+inline void ReprojectImage(const uint32_t* src, const float* srcDepth, uint32_t width, uint32_t height,
+    const FovTangents& srcFov, const FovTangents& dstFov, const EyeDelta& delta, const DepthRange& range,
+    uint32_t* dst, std::vector<float>& zbuf) {
+    if (!src || !dst || width == 0 || height == 0) return;
+    const size_t count = (size_t)width * height;
+    zbuf.assign(count, std::numeric_limits<float>::infinity());
+
+    const DepthRange r = srcDepth ? range : RotationOnlyDepthRange();
+    const float invDepthSpan = 1.0f / (r.maxDepth - r.minDepth);
+    const float stepU = (srcFov.right - srcFov.left) / (float)width;
+    const float stepV = (srcFov.down - srcFov.up) / (float)height;
+    const float dstScaleU = (float)width / (dstFov.right - dstFov.left);
+    const float dstScaleV = (float)height / (dstFov.up - dstFov.down);
+    const float (*m)[4] = delta.m;
+
+    for (uint32_t y = 0; y < height; ++y) {
+        const float ty = srcFov.up + ((float)y + 0.5f) * stepV;
+        // Per-row part of M * (tx, ty, -1); tx contributes m[.][0] * tx per pixel
+        const float rowX = m[0][1] * ty - m[0][2];
+        const float rowY = m[1][1] * ty - m[1][2];
+        const float rowZ = m[2][1] * ty - m[2][2];
+        const uint32_t* sRow = src + (size_t)y * width;
+        const float* dRow = srcDepth ? srcDepth + (size_t)y * width : nullptr;
+        uint32_t x = 0;
+
+#if defined(REPROJ_HAVE_SSE2)
+        const __m128 vMin = _mm_set1_ps(r.minDepth);
+        const __m128 vInvSpan = _mm_set1_ps(invDepthSpan);
+        const __m128 vInvNear = _mm_set1_ps(r.invNear);
+        const __m128 vInvDelta = _mm_set1_ps(r.invFar - r.invNear);
+        const __m128 vZero = _mm_setzero_ps();
+        const __m128 vOne = _mm_set1_ps(1.0f);
+        const __m128 vEps = _mm_set1_ps(kMinInverseDistance);
+        const __m128 vM00 = _mm_set1_ps(m[0][0]), vM10 = _mm_set1_ps(m[1][0]), vM20 = _mm_set1_ps(m[2][0]);
+        const __m128 vRowX = _mm_set1_ps(rowX), vRowY = _mm_set1_ps(rowY), vRowZ = _mm_set1_ps(rowZ);
+        const __m128 vT0 = _mm_set1_ps(m[0][3]), vT1 = _mm_set1_ps(m[1][3]), vT2 = _mm_set1_ps(m[2][3]);
+        const __m128 vDstL = _mm_set1_ps(dstFov.left), vDstU = _mm_set1_ps(dstFov.up);
+        const __m128 vScaleU = _mm_set1_ps(dstScaleU), vScaleV = _mm_set1_ps(dstScaleV);
+        const __m128 vStepU = _mm_set1_ps(stepU);
+        const __m128 vLane = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+        alignas(16) float fx[4], fy[4], qd[4];
+        for (; x + 4 <= width; x += 4) {
+            __m128 vDist;
+            if (dRow) {
+                __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(dRow + x), vMin), vInvSpan);
+                t = _mm_min_ps(_mm_max_ps(t, vZero), vOne);
+                __m128 invZ = _mm_add_ps(vInvNear, _mm_mul_ps(t, vInvDelta));
+                vDist = _mm_div_ps(vOne, _mm_max_ps(invZ, vEps));
+            }
+            else {
+                vDist = _mm_div_ps(vOne, vEps);
+            }
+            __m128 tx = _mm_add_ps(_mm_set1_ps(srcFov.left),
+                _mm_mul_ps(_mm_add_ps(_mm_set1_ps((float)x), vLane), vStepU));
+            __m128 qx = _mm_add_ps(_mm_mul_ps(vDist, _mm_add_ps(_mm_mul_ps(vM00, tx), vRowX)), vT0);
+            __m128 qy = _mm_add_ps(_mm_mul_ps(vDist, _mm_add_ps(_mm_mul_ps(vM10, tx), vRowY)), vT1);
+            __m128 qz = _mm_add_ps(_mm_mul_ps(vDist, _mm_add_ps(_mm_mul_ps(vM20, tx), vRowZ)), vT2);
+            __m128 vQd = _mm_sub_ps(vZero, qz);
+            __m128 safeQd = _mm_max_ps(vQd, vEps);
+            __m128 u = _mm_mul_ps(_mm_sub_ps(_mm_div_ps(qx, safeQd), vDstL), vScaleU);
+            __m128 v = _mm_mul_ps(_mm_sub_ps(vDstU, _mm_div_ps(qy, safeQd)), vScaleV);
+            _mm_store_ps(fx, u);
+            _mm_store_ps(fy, v);
+            _mm_store_ps(qd, vQd);
+            for (int k = 0; k < 4; ++k) {
+                detail::SplatSample(sRow[x + k], fx[k], fy[k], qd[k], width, height, dst, zbuf.data());
+            }
+        }
+#endif
+        for (; x < width; ++x) {
+            float dist = dRow ? 0.0f : 1.0f / kMinInverseDistance;
+            if (dRow) {
+                float t = (dRow[x] - r.minDepth) * invDepthSpan;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                float invZ = r.invNear + t * (r.invFar - r.invNear);
+                dist = 1.0f / std::max(invZ, kMinInverseDistance);
+            }
+            float tx = srcFov.left + ((float)x + 0.5f) * stepU;
+            float qx = dist * (m[0][0] * tx + rowX) + m[0][3];
+            float qy = dist * (m[1][0] * tx + rowY) + m[1][3];
+            float qz = dist * (m[2][0] * tx + rowZ) + m[2][3];
+            float qdS = -qz;
+            float safeQd = std::max(qdS, kMinInverseDistance);
+            float u = (qx / safeQd - dstFov.left) * dstScaleU;
+            float v = (dstFov.up - qy / safeQd) * dstScaleV;
+            detail::SplatSample(sRow[x], u, v, qdS, width, height, dst, zbuf.data());
+        }
+    }
+
+    detail::FillHoles(src, width, height, dst, zbuf.data());
+}
+
+} // namespace reproj
@@ -0,0 +1,120 @@
+// Dynamic resolution governor for OpenXR WXR
+// Tracks measured frame time against the pacer's budget and picks a per-eye render scale over a per-headset baseline
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace resgov {
+
+// Full-scale per-eye render size. Winlator renders on the headset's own SoC, so this follows its GPU, not its panels.
+struct Baseline {
+    const char* make;
+    const char* model;   // nullptr matches any model of the make
+    uint32_t width;
+    uint32_t height;
+};
+
+inline constexpr Baseline kDefaultBaseline{ "", nullptr, 1280, 720 };
+
+inline constexpr Baseline kBaselines[] = {
+    { "META", "QUEST 3", 1600, 900 },            // XR2 Gen 2
+    { "META", "QUEST 2", 1280, 720 },            // XR2
+    { "PICO", nullptr, 1280, 720 },              // Pico 4 (XR2)
+    { "PLAY FOR DREAM", nullptr, 1600, 900 },    // XR2+ Gen 2
+};
+
+inline const Baseline& FindBaseline(const std::string& make, const std::string& model) {
+    for (const Baseline& b : kBaselines) {
+        if (make != b.make) continue;
+        if (!b.model || model == b.model) return b;
+    }
+    return kDefaultBaseline;
+}
+
+struct Config {
+    float minScale{ 0.5f };
+    float maxScale{ 1.0f };
+    float step{ 0.05f };                // Scales are kept on this grid so resources are reused between changes
+    float smoothing{ 0.1f };            // EWMA weight of the newest frame
+    float downThreshold{ 0.95f };       // Smoothed budget use above this scales down...
+    float targetUtilization{ 0.85f };   // ...to the scale expected to land here
+    float upThreshold{ 0.70f };         // Budget use below this for upHoldFrames frames scales up one step
+    uint32_t upHoldFrames{ 90 };
+    uint32_t cooldownFrames{ 15 };      // Frames to let the average settle after any change
+};
+
+class Governor {
+public:
+    explicit Governor(Config config = {}) : config_(config), scale_(config.maxScale) {}
+
+    void Reset() {
+        scale_ = config_.maxScale;
+        utilization_ = 0.0;
+        primed_ = false;
+        underFrames_ = 0;
+        cooldown_ = 0;
+    }
+
+    // Feeds one frame's measured time against its budget; returns true when the scale changed
+    bool Update(double frameTimeNs, double budgetNs) {
+        if (budgetNs <= 0.0 || frameTimeNs < 0.0) return false;
+        double sample = frameTimeNs / budgetNs;
+        utilization_ = primed_ ? utilization_ + (sample - utilization_) * config_.smoothing : sample;
+        primed_ = true;
+
+        if (cooldown_ > 0) {
+            --cooldown_;
+            return false;
+        }
+
+        float next = scale_;
+        if (utilization_ > config_.downThreshold) {
+            // Cost follows pixel count, i.e. the square of the per-axis scale
+            next = FloorToStep((float)(scale_ * std::sqrt(config_.targetUtilization / utilization_)));
+            if (next >= scale_) next = scale_ - config_.step;
+            underFrames_ = 0;
+        }
+        else if (utilization_ < config_.upThreshold) {
+            if (++underFrames_ >= config_.upHoldFrames) {
+                next = FloorToStep(scale_ + config_.step * 1.5f);
+                underFrames_ = 0;
+            }
+        }
+        else {
+            underFrames_ = 0;
+        }
+
+        next = std::clamp(next, config_.minScale, config_.maxScale);
+        if (std::fabs(next - scale_) < config_.step * 0.5f) return false;
+        scale_ = next;
+        cooldown_ = config_.cooldownFrames;
+        return true;
+    }
+
+    float Scale() const { return scale_; }
+    double Utilization() const { return utilization_; }
+    const Config& GetConfig() const { return config_; }
+
+    // Scaled extent, rounded down to a multiple of 8 texels
+    void Extent(uint32_t baseWidth, uint32_t baseHeight, uint32_t& width, uint32_t& height) const {
+        width = std::max<uint32_t>(8, (uint32_t)(baseWidth * scale_) & ~7u);
+        height = std::max<uint32_t>(8, (uint32_t)(baseHeight * scale_) & ~7u);
+    }
+
+private:
+    float FloorToStep(float scale) const {
+        return std::floor(scale / config_.step + 1e-3f) * config_.step;
+    }
+
+    Config config_;
+    float scale_;
+    double utilization_{ 0.0 };
+    bool primed_{ false };
+    uint32_t underFrames_{ 0 };
+    uint32_t cooldown_{ 0 };
+};
+
+} // namespace resgov
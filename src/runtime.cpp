@@ -14,6 +14,7 @@
 #include <WinUser.h>
 #include <wrl/client.h>
 #include <d3d11.h>
+#include <d3d11_1.h>
 #include <d3d12.h>
 #include <d3d11on12.h>
 #include <d3dcompiler.h>
@@ -97,6 +98,43 @@
 #ifndef GL_FRAMEBUFFER_COMPLETE
 #define GL_FRAMEBUFFER_COMPLETE           0x8CD5
 #endif
+#ifndef GL_READ_FRAMEBUFFER
+#define GL_READ_FRAMEBUFFER               0x8CA8
+#endif
+#ifndef GL_READ_FRAMEBUFFER_BINDING
+#define GL_READ_FRAMEBUFFER_BINDING       0x8CAA
+#endif
+#ifndef GL_DEPTH_ATTACHMENT
+#define GL_DEPTH_ATTACHMENT               0x8D00
+#endif
+#ifndef GL_PIXEL_PACK_BUFFER
+#define GL_PIXEL_PACK_BUFFER              0x88EB
+#endif
+#ifndef GL_PIXEL_PACK_BUFFER_BINDING
+#define GL_PIXEL_PACK_BUFFER_BINDING      0x88ED
+#endif
+#ifndef GL_STREAM_READ
+#define GL_STREAM_READ                    0x88E1
+#endif
+#ifndef GL_MAP_READ_BIT
+#define GL_MAP_READ_BIT                   0x0001
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
+#endif
+#ifndef GL_ALREADY_SIGNALED
+#define GL_ALREADY_SIGNALED               0x911A
+#endif
+#ifndef GL_CONDITION_SATISFIED
+#define GL_CONDITION_SATISFIED            0x911C
+#endif
+typedef ptrdiff_t GLsizeiptr;
+typedef ptrdiff_t GLintptr;
+typedef struct __GLsync* GLsync;
+typedef unsigned long long GLuint64;
 
 // Function pointer types for GL extension functions
 typedef void (APIENTRY* PFNGLTEXIMAGE3DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels);
@@ -104,8 +142,18 @@ typedef void (APIENTRY* PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint* framebuffer
 typedef void (APIENTRY* PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n, const GLuint* framebuffers);
 typedef void (APIENTRY* PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
 typedef void (APIENTRY* PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef void (APIENTRY* PFNGLFRAMEBUFFERTEXTURELAYERPROC)(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
 typedef GLenum(APIENTRY* PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
 typedef void (APIENTRY* PFNGLREADPIXELSPROC)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels);
+typedef void (APIENTRY* PFNGLGENBUFFERSPROC)(GLsizei n, GLuint* buffers);
+typedef void (APIENTRY* PFNGLDELETEBUFFERSPROC)(GLsizei n, const GLuint* buffers);
+typedef void (APIENTRY* PFNGLBINDBUFFERPROC)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+typedef void* (APIENTRY* PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLboolean(APIENTRY* PFNGLUNMAPBUFFERPROC)(GLenum target);
+typedef GLsync(APIENTRY* PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
+typedef GLenum(APIENTRY* PFNGLCLIENTWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+typedef void (APIENTRY* PFNGLDELETESYNCPROC)(GLsync sync);
 
 // GL function pointers (loaded at runtime)
 static PFNGLTEXIMAGE3DPROC g_glTexImage3D = nullptr;
@@ -113,7 +161,17 @@ static PFNGLGENFRAMEBUFFERSPROC g_glGenFramebuffers = nullptr;
 static PFNGLDELETEFRAMEBUFFERSPROC g_glDeleteFramebuffers = nullptr;
 static PFNGLBINDFRAMEBUFFERPROC g_glBindFramebuffer = nullptr;
 static PFNGLFRAMEBUFFERTEXTURE2DPROC g_glFramebufferTexture2D = nullptr;
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC g_glFramebufferTextureLayer = nullptr;
 static PFNGLCHECKFRAMEBUFFERSTATUSPROC g_glCheckFramebufferStatus = nullptr;
+static PFNGLGENBUFFERSPROC g_glGenBuffers = nullptr;
+static PFNGLDELETEBUFFERSPROC g_glDeleteBuffers = nullptr;
+static PFNGLBINDBUFFERPROC g_glBindBuffer = nullptr;
+static PFNGLBUFFERDATAPROC g_glBufferData = nullptr;
+static PFNGLMAPBUFFERRANGEPROC g_glMapBufferRange = nullptr;
+static PFNGLUNMAPBUFFERPROC g_glUnmapBuffer = nullptr;
+static PFNGLFENCESYNCPROC g_glFenceSync = nullptr;
+static PFNGLCLIENTWAITSYNCPROC g_glClientWaitSync = nullptr;
+static PFNGLDELETESYNCPROC g_glDeleteSync = nullptr;
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -133,8 +191,51 @@ static PFNGLCHECKFRAMEBUFFERSTATUSPROC g_glCheckFramebufferStatus = nullptr;
 #include <openxr/openxr.h>
 #include <openxr/openxr_platform.h>
 #include <loader_interfaces.h>
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// XR_META_recommended_layer_resolution postdates the bundled 1.0.27 headers
+#ifndef XR_META_recommended_layer_resolution
+#define XR_META_recommended_layer_resolution 1
+#define XR_META_recommended_layer_resolution_SPEC_VERSION 1
+#define XR_META_RECOMMENDED_LAYER_RESOLUTION_EXTENSION_NAME "XR_META_recommended_layer_resolution"
+#define XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_META ((XrStructureType)1000254000)
+#define XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_GET_INFO_META ((XrStructureType)1000254001)
+typedef struct XrRecommendedLayerResolutionMETA {
+	XrStructureType type;
+	void* XR_MAY_ALIAS next;
+	XrExtent2Di recommendedImageDimensions;
+	XrBool32 isValid;
+} XrRecommendedLayerResolutionMETA;
+typedef struct XrRecommendedLayerResolutionGetInfoMETA {
+	XrStructureType type;
+	const void* XR_MAY_ALIAS next;
+	const XrCompositionLayerBaseHeader* layer;
+	XrTime predictedDisplayTime;
+} XrRecommendedLayerResolutionGetInfoMETA;
+#endif
 #include "mcp_integration.h"
 #include "ui_enhancements.h"
+#include "reprojection.h"
+#include "frame_synthesis.h"
+#include "blit_cache.h"
+#include "image_kernels.h"
+#include "texture_pool.h"
+#include "handle_table.h"
+#include "resolution_governor.h"
+#include "visibility_mask.h"
+#include "proc_dispatch.h"
+#include "runtime_functions.h"
+#include "action_bindings.h"
+#include "action_state.h"
+#include "path_interner.h"
+#include "interaction_profiles.h"
+#include "hand_joints.h"
+#include "udp_packet.h"
+#include "haptics.h"
+#include "event_queue.h"
+#include "readback_ring.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -206,15 +307,41 @@ static bool EnsureGLFramebufferFuncs() {
 	g_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)wglGetProcAddress("glDeleteFramebuffers");
 	g_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)wglGetProcAddress("glBindFramebuffer");
 	g_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)wglGetProcAddress("glFramebufferTexture2D");
+	g_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)wglGetProcAddress("glFramebufferTextureLayer");
 	g_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)wglGetProcAddress("glCheckFramebufferStatus");
 	if (!g_glGenFramebuffers || !g_glDeleteFramebuffers || !g_glBindFramebuffer ||
-		!g_glFramebufferTexture2D || !g_glCheckFramebufferStatus) {
+		!g_glFramebufferTexture2D || !g_glFramebufferTextureLayer || !g_glCheckFramebufferStatus) {
 		Log("[OXRWXR] Failed to load GL framebuffer functions");
 		return false;
 	}
 	return true;
 }
 
+// Pixel buffer objects + fence sync (GL 3.2) for asynchronous preview readback
+static bool EnsureGLPixelBufferFuncs() {
+	static bool tried = false;
+	if (g_glGenBuffers && g_glClientWaitSync) return true;
+	if (tried) return false;
+	tried = true;
+	g_glGenBuffers = (PFNGLGENBUFFERSPROC)wglGetProcAddress("glGenBuffers");
+	g_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)wglGetProcAddress("glDeleteBuffers");
+	g_glBindBuffer = (PFNGLBINDBUFFERPROC)wglGetProcAddress("glBindBuffer");
+	g_glBufferData = (PFNGLBUFFERDATAPROC)wglGetProcAddress("glBufferData");
+	g_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)wglGetProcAddress("glMapBufferRange");
+	g_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)wglGetProcAddress("glUnmapBuffer");
+	g_glFenceSync = (PFNGLFENCESYNCPROC)wglGetProcAddress("glFenceSync");
+	g_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)wglGetProcAddress("glClientWaitSync");
+	g_glDeleteSync = (PFNGLDELETESYNCPROC)wglGetProcAddress("glDeleteSync");
+	if (!g_glGenBuffers || !g_glDeleteBuffers || !g_glBindBuffer || !g_glBufferData || !g_glMapBufferRange ||
+		!g_glUnmapBuffer || !g_glFenceSync || !g_glClientWaitSync || !g_glDeleteSync) {
+		Log("[OXRWXR] GL pixel buffer / sync functions unavailable, using synchronous readback");
+		g_glGenBuffers = nullptr;
+		g_glClientWaitSync = nullptr;
+		return false;
+	}
+	return true;
+}
+
 static XrQuaternionf QuatFromYawPitch(float yaw, float pitch) {
 	const float cy = cosf(yaw * 0.5f);
 	const float sy = sinf(yaw * 0.5f);
@@ -299,6 +426,30 @@ static bool sendHaptics = true;
 static bool bEnableAltEyeRendering = false;
 static bool bAltEyeRender = false;
 
+// Re-project late frames to the newest UDP head pose before they reach the preview
+static bool bEnableReprojection = false;
+
+// Ask the app for every other display frame and synthesize the ones in between
+static bool bEnableHalfRate = false;
+
+// OpenGL preview: read eyes back through a PBO ring and show them one frame later instead of stalling
+static bool bGLAsyncReadback = true;
+
+// D3D12 preview: how many blits may be queued on the GPU before the CPU waits (1 = fully serialized)
+static int iD3D12FramesInFlight = 2;
+
+// Don't recompose or present the preview when a frame resubmits exactly what the last one showed
+static bool bSkipUnchangedFrames = true;
+
+// Preview presents with a waitable flip swapchain (max latency 1, tearing allowed); xrWaitFrame does the waiting
+static bool bPreviewLowLatency = false;
+
+// Offer PRIMARY_MONO first when only one eye is ever shown (left_eye/right_eye display modes, AER)
+static bool bNativeMonoView = true;
+
+// Scale the per-eye resolution recommended through XR_META_recommended_layer_resolution with the measured frame time
+static bool bDynamicResolution = true;
+
 static WinXrApiUDP* udpReader;
 
 static std::string hmdMake;
@@ -399,6 +550,16 @@ static bool parseBool(const std::string str) {
 	return value == "true" || value == "1" || value == "yes" || value == "t";
 }
 
+static int parseInt(const std::string str, int fallback) {
+	size_t pos = str.find('=');
+	if (pos == std::string::npos) return fallback;
+
+	const char* value = str.c_str() + pos + 1;
+	char* end = nullptr;
+	long parsed = strtol(value, &end, 10);
+	return (end == value) ? fallback : (int)parsed;
+}
+
 static bool compareValue(const std::string str, const std::string compareTo) {
 	size_t pos = str.find('=');
 	if (pos == std::string::npos) return false;
@@ -446,9 +607,48 @@ namespace rt {
 		std::vector<std::string> enabledExtensions;
 	};
 
+	// Per-eye reprojection request built from a projection layer view (and its chained
+	// XrCompositionLayerDepthInfoKHR, if any) against a newer head pose
+	struct EyeReprojection {
+		bool active{ false };
+		XrPosef renderPose{};
+		XrFovf renderFov{};
+		XrPosef targetPose{};
+		XrFovf targetFov{};
+		XrPosef contentPose{};      // Synthesized frames: camera pose that block-matched content motion carries the image to
+		XrSwapchain depthSwapchain{ XR_NULL_HANDLE };
+		uint32_t depthArrayIndex{ 0 };
+		XrRect2Di depthRect{};
+		reproj::DepthRange depthRange{ reproj::RotationOnlyDepthRange() };
+		// XR_FB_space_warp motion vectors, applied for synthesized frames only
+		XrSwapchain motionSwapchain{ XR_NULL_HANDLE };
+		uint32_t motionArrayIndex{ 0 };
+		XrRect2Di motionRect{};
+		float motionScale{ 0.0f };  // fraction of one app frame's motion to extrapolate
+	};
+
+	// OpenGL preview readback: frame N is packed into PBOs and copied out at frame N+1
+	static constexpr uint32_t kGLReadbackSlots = 2;
+	struct GLReadbackSlot {
+		GLuint pbo[2]{};              // Per eye, created in the app's context
+		GLuint depthPbo[2]{};         // Per eye DEPTH_COMPONENT floats, created the first time an eye has depth
+		GLsync fence{ nullptr };
+		bool hasEye[2]{};
+		bool hasDepth[2]{};
+		EyeReprojection source[2];    // Pose, FOV and depth range the queued eyes were rendered with
+	};
+	using GLReadbackRing = readback::Ring<GLReadbackSlot, kGLReadbackSlots>;
+
+	// Intermediate copy of one swapchain image slice, reused across frames by blitViewToHalf
+	struct BlitCacheEntry {
+		ComPtr<ID3D11Texture2D> texture;
+		ComPtr<ID3D11ShaderResourceView> srv;
+	};
+
 	struct Session {
 		XrSession handle{ (XrSession)1 };
 		XrSessionState state{ XR_SESSION_STATE_IDLE };
+		XrViewConfigurationType viewConfiguration{ XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO };
 		ComPtr<ID3D11Device> d3d11Device;
 		ComPtr<ID3D11DeviceContext> d3d11Context;
 		// DX12 support
@@ -459,6 +659,12 @@ namespace rt {
 		HDC glDC{ nullptr };
 		HGLRC glRC{ nullptr };
 		bool usesOpenGL{ false };
+		GLReadbackRing glReadback;
+		std::vector<uint8_t> glStaging[2];  // Top-down RGBA per eye, reused every frame
+		std::vector<float> glDepthStaging[2];  // Top-down depth per eye for the CPU warp
+		bool glStagedDepth[2]{};               // glDepthStaging matches glStaging (async readback)
+		EyeReprojection glStagedSource[2];     // What glStaging was rendered with (async readback)
+		GLuint glReadFbo{ 0 };                 // Read framebuffer a single swapchain layer is attached to
 
 		// DX12 preview resources
 		ComPtr<IDXGISwapChain3> previewSwapchain12;
@@ -466,7 +672,8 @@ namespace rt {
 		std::vector<ComPtr<ID3D12Resource>> previewBackbuffers;
 		UINT previewRTVDescriptorSize{ 0 };
 		UINT previewBackbufferCount{ 0 };
-		ComPtr<ID3D12CommandAllocator> previewCmdAlloc;
+		std::vector<ComPtr<ID3D12CommandAllocator>> previewCmdAllocs;  // One per backbuffer
+		std::vector<UINT64> previewAllocFenceValues;                   // Fence value of the last blit recorded with each allocator
 		ComPtr<ID3D12GraphicsCommandList> previewCmdList;
 		ComPtr<ID3D12Fence> previewFence;
 		HANDLE previewFenceEvent{ nullptr };
@@ -483,9 +690,14 @@ namespace rt {
 		ComPtr<ID3D11PixelShader> solidColorPS;
 		ComPtr<ID3D11InputLayout> simpleVertexLayout = nullptr;
 		ComPtr<ID3D11Buffer> colorConstantBuffer;
+		float colorConstants[4]{};          // Last color written to colorConstantBuffer
+		bool colorConstantsValid{ false };
 		ComPtr<ID3D11Buffer> viewportConstantBuffer;
 		ComPtr<ID3DBlob> solidColorVSBlob;
 		ComPtr<ID3DBlob> solidColorPSBlob;
+		// Depth-aware reprojection (grid warp)
+		ComPtr<ID3D11VertexShader> warpVS;
+		ComPtr<ID3D11Buffer> warpConstantBuffer;
 
 
 		// Desktop preview window (no thread - handled on main thread)
@@ -496,10 +708,27 @@ namespace rt {
 		UINT previewHeight{ 540 };
 		DXGI_FORMAT previewFormat{ DXGI_FORMAT_UNKNOWN };  // Track format for matching
 		std::mutex previewMutex;
+		// Low-latency preview: frame latency waitable of whichever preview swapchain is active
+		HANDLE previewLatencyWaitable{ nullptr };
+		bool previewLatencyReady{ false };  // A wait completed in xrWaitFrame and no present has consumed it yet
+		bool previewAllowTearing{ false };
+
+		// Cached blit intermediates and preview backbuffer RTVs ([0] default format, [1] sRGB)
+		blitcache::Cache<BlitCacheEntry> blitCache;
+		ComPtr<ID3D11Texture2D> previewRTVBuffer;
+		ComPtr<ID3D11RenderTargetView> previewRTVs[2];
+
+		// Preview policy: last composed eyes (D3D11 only), shown again with a fresh sync block on held frames
+		ComPtr<ID3D11Texture2D> previewComposite;
+		bool previewCompositeValid{ false };
+		uint32_t previewPassIndex{ 0 };
+		// Where the sync eye's 10x10 block landed in the backbuffer, and whether its values need linearizing for the sRGB RTV
+		D3D11_RECT previewSyncRect{ 0, 0, 10, 10 };
+		bool previewSyncSrgbSource{ true };
 	};
 
 	struct Swapchain {
-		XrSwapchain handle{ (XrSwapchain)1 };
+		XrSwapchain handle{ XR_NULL_HANDLE };
 		DXGI_FORMAT format{ DXGI_FORMAT_R8G8B8A8_UNORM };
 		uint32_t width{ 0 }, height{ 0 }, arraySize{ 2 };
 		uint32_t mipCount{ 1 };
@@ -513,12 +742,265 @@ namespace rt {
 		uint32_t nextIndex{ 0 };
 		uint32_t lastAcquired{ UINT32_MAX };  // Initialize to invalid
 		uint32_t lastReleased{ UINT32_MAX };  // Initialize to invalid
+		uint64_t releaseGeneration{ 0 };      // Bumped on every release, so a re-rendered index still reads as new content
 		uint32_t imageCount{ 3 };
+		// Images go back to g_texturePool under this key when the swapchain is destroyed
+		texpool::Key poolKey;
+		uint64_t poolImageBytes{ 0 };
 	};
 
+	// Copy of the last submitted projection layer, kept so half-rate mode can re-present it
+	// warped to a newer pose. The app's structs are only valid during xrEndFrame.
+	struct SubmittedProjection {
+		bool valid{ false };
+		XrCompositionLayerProjection layer{};
+		XrCompositionLayerProjectionView views[2]{};
+		XrCompositionLayerDepthInfoKHR depth[2]{};
+		XrCompositionLayerSpaceWarpInfoFB spaceWarp[2]{};
+		XrPosef previousPoses[2]{};  // view poses of the submission before this one
+		bool hasPrevious{ false };
+		DWORD threadId{ 0 };
+	};
+
+	static SubmittedProjection g_lastProjection;
+
 	static Instance g_instance{};
 	static Session g_session{};
-	static std::unordered_map<XrSwapchain, Swapchain> g_swapchains;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Generational handle table: lookups are a bounds + generation check, and handles of destroyed swapchains stay invalid
+	static handles::Table<Swapchain, handles::HandleType::Swapchain, XrSwapchain> g_swapchains;
+
+	static XrSwapchain AddSwapchain(Swapchain&& chain) {
+		XrSwapchain handle = g_swapchains.Insert(std::move(chain));
+		g_swapchains.Get(handle)->handle = handle;
+		return handle;
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Single-eye display modes only ever show one eye, so the app can render just that one view
+	static bool MonoViewPreferred() {
+		return bNativeMonoView && ui::g_uiState.viewMode != ui::ViewMode::BothEyes;
+	}
+
+	static uint32_t ViewCountFor(XrViewConfigurationType type) {
+		if (type == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_MONO) return 1;
+		if (type == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO) return 2;
+		return 0;
+	}
+
+	// Symmetric per-view FOV from the UDP feed (same for every view)
+	static XrFovf ViewFov() {
+		float fovTan = tanf(FOVTotal / 2.0f);
+		return XrFovf{ -fovTan, fovTan, fovTan, -fovTan };
+	}
+
+	// The mono view sits at the eye being shown; under AER viewMode flips every frame, so it alternates eyes
+	static float MonoViewEyeOffset(float ipd) {
+		if (ui::g_uiState.viewMode == ui::ViewMode::LeftEyeOnly) return -ipd * 0.5f;
+		if (ui::g_uiState.viewMode == ui::ViewMode::RightEyeOnly) return ipd * 0.5f;
+		return 0.0f;
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// AER eye parity is latched per frame in xrWaitFrame and keyed by its predicted display time. xrLocateViews and
+	// xrEndFrame look it up by the time the app passes them, so the eye the app renders, the eye the preview shows and
+	// the blue sync channel agree even when frames are pipelined across threads or a present is skipped.
+	struct AerFrame {
+		XrTime displayTime{ 0 };
+		bool rightEye{ false };
+	};
+	static constexpr uint32_t kAerFrameHistory = 8;
+	static AerFrame g_aerFrames[kAerFrameHistory];
+	static uint32_t g_aerFrameNext = 0;
+	static bool g_aerNextRightEye = false;
+	static std::mutex g_aerMutex;
+
+	static void LatchAerParity(XrTime displayTime) {
+		std::lock_guard<std::mutex> lock(g_aerMutex);
+		AerFrame& frame = g_aerFrames[g_aerFrameNext % kAerFrameHistory];
+		frame.displayTime = displayTime;
+		frame.rightEye = g_aerNextRightEye;
+		g_aerNextRightEye = !g_aerNextRightEye;
+		++g_aerFrameNext;
+	}
+
+	// Unknown times (app made up its own) get the newest latched frame
+	static bool AerRightEyeFor(XrTime displayTime) {
+		std::lock_guard<std::mutex> lock(g_aerMutex);
+		if (g_aerFrameNext == 0) return false;
+		for (uint32_t i = 0; i < kAerFrameHistory && i < g_aerFrameNext; ++i) {
+			const AerFrame& frame = g_aerFrames[(g_aerFrameNext - 1 - i) % kAerFrameHistory];
+			if (frame.displayTime == displayTime) return frame.rightEye;
+		}
+		return g_aerFrames[(g_aerFrameNext - 1) % kAerFrameHistory].rightEye;
+	}
+
+	// Selects the eye the preview shows and the blue sync channel reports for the frame being ended
+	static void ApplyAerParity(XrTime displayTime) {
+		bAltEyeRender = AerRightEyeFor(displayTime);
+		ui::g_uiState.viewMode = bAltEyeRender ? ui::ViewMode::RightEyeOnly : ui::ViewMode::LeftEyeOnly;
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Dynamic resolution: the app's frame time (xrWaitFrame return to xrEndFrame, matched by display time) is measured
+	// against the pacer's period, and the governor's scale is offered through XR_META_recommended_layer_resolution
+	struct FrameTiming {
+		XrTime displayTime{ 0 };
+		long long startNs{ 0 };
+		long long budgetNs{ 0 };
+	};
+	static constexpr uint32_t kFrameTimingHistory = 8;
+	static FrameTiming g_frameTimings[kFrameTimingHistory];
+	static uint32_t g_frameTimingNext = 0;
+	static std::mutex g_frameTimingMutex;
+	static resgov::Governor g_resolutionGovernor;
+
+	static long long QpcNowNs() {
+		static LARGE_INTEGER freq = []() { LARGE_INTEGER f; QueryPerformanceFrequency(&f); return f; }();
+		LARGE_INTEGER now; QueryPerformanceCounter(&now);
+		return (long long)((double)now.QuadPart * 1000000000.0 / (double)freq.QuadPart);
+	}
+
+	static const resgov::Baseline& EyeBaseline() {
+		return resgov::FindBaseline(hmdMake, hmdModel);
+	}
+
+	static void NoteFrameStart(XrTime displayTime, long long startNs, long long budgetNs) {
+		std::lock_guard<std::mutex> lock(g_frameTimingMutex);
+		FrameTiming& timing = g_frameTimings[g_frameTimingNext++ % kFrameTimingHistory];
+		timing.displayTime = displayTime;
+		timing.startNs = startNs;
+		timing.budgetNs = budgetNs;
+	}
+
+	// A new session starts at full scale, with no frame timings or smoothed load left over from the last one
+	static void ResetDynamicResolution() {
+		std::lock_guard<std::mutex> lock(g_frameTimingMutex);
+		for (FrameTiming& timing : g_frameTimings) timing = FrameTiming{};
+		g_frameTimingNext = 0;
+		g_resolutionGovernor.Reset();
+	}
+
+	static void NoteFrameEnd(XrTime displayTime) {
+		long long endNs = QpcNowNs();
+		FrameTiming timing;
+		{
+			std::lock_guard<std::mutex> lock(g_frameTimingMutex);
+			uint32_t i = 0;
+			for (; i < kFrameTimingHistory && i < g_frameTimingNext; ++i) {
+				FrameTiming& candidate = g_frameTimings[(g_frameTimingNext - 1 - i) % kFrameTimingHistory];
+				if (candidate.displayTime == displayTime && candidate.startNs != 0) {
+					timing = candidate;
+					candidate.startNs = 0;  // Count each frame once
+					break;
+				}
+			}
+			if (timing.startNs == 0) return;
+		}
+		if (g_resolutionGovernor.Update((double)(endNs - timing.startNs), (double)timing.budgetNs)) {
+			uint32_t width, height;
+			const resgov::Baseline& base = EyeBaseline();
+			g_resolutionGovernor.Extent(base.width, base.height, width, height);
+			Logf("[OXRWXR] Dynamic resolution: scale %.2f (%ux%u per eye), frame time %.0f%% of budget",
+				g_resolutionGovernor.Scale(), width, height, g_resolutionGovernor.Utilization() * 100.0);
+		}
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Images of destroyed swapchains, reused by the next matching xrCreateSwapchain. Unity creates and destroys
+	// sessions (and their swapchains) rapidly, and every fresh allocation shows up as a hitch.
+	struct PooledImage {
+		uint64_t device{ 0 };  // Same as the pool key's device; GL names are only deleted in their own context
+		ComPtr<ID3D11Texture2D> d3d11;
+		ComPtr<ID3D12Resource> d3d12;
+		D3D12_RESOURCE_STATES state12{ D3D12_RESOURCE_STATE_COMMON };
+		GLuint gl{ 0 };
+	};
+	static texpool::Pool<PooledImage> g_texturePool;
+
+	static uint64_t CurrentPoolDevice() {
+		if (g_session.usesD3D12) return (uint64_t)(uintptr_t)g_session.d3d12Device.Get();
+		if (g_session.usesOpenGL) return (uint64_t)(uintptr_t)g_session.glRC;
+		return (uint64_t)(uintptr_t)g_session.d3d11Device.Get();
+	}
+
+	static texpool::Key SwapchainPoolKey(const XrSwapchainCreateInfo& ci) {
+		texpool::Key key;
+		key.device = CurrentPoolDevice();
+		key.backend = g_session.usesD3D12 ? (uint32_t)Swapchain::Backend::D3D12
+			: (g_session.usesOpenGL ? (uint32_t)Swapchain::Backend::OpenGL : (uint32_t)Swapchain::Backend::D3D11);
+		key.format = ci.format;
+		key.width = ci.width;
+		key.height = ci.height;
+		key.arraySize = ci.arraySize ? ci.arraySize : 1;
+		key.mipCount = ci.mipCount ? ci.mipCount : 1;
+		key.sampleCount = ci.sampleCount ? ci.sampleCount : 1;
+		key.usageFlags = ci.usageFlags;
+		return key;
+	}
+
+	// Rough footprint of one image, only used against the pool budget
+	static uint64_t EstimateSwapchainImageBytes(const texpool::Key& key) {
+		uint64_t bytesPerPixel = 4;
+		if (key.backend == (uint32_t)Swapchain::Backend::OpenGL) {
+			switch ((GLenum)key.format) {
+			case GL_RGBA16F: bytesPerPixel = 8; break;
+			case GL_RGBA32F: bytesPerPixel = 16; break;
+			case GL_DEPTH_COMPONENT16: bytesPerPixel = 2; break;
+			default: break;
+			}
+		}
+		else {
+			switch ((DXGI_FORMAT)key.format) {
+			case DXGI_FORMAT_R16G16B16A16_FLOAT:
+			case DXGI_FORMAT_R16G16B16A16_UNORM:
+			case DXGI_FORMAT_D32_FLOAT_S8X24_UINT: bytesPerPixel = 8; break;
+			case DXGI_FORMAT_R32G32B32A32_FLOAT: bytesPerPixel = 16; break;
+			case DXGI_FORMAT_D16_UNORM: bytesPerPixel = 2; break;
+			default: break;
+			}
+		}
+		uint64_t bytes = (uint64_t)key.width * key.height * key.arraySize * key.sampleCount * bytesPerPixel;
+		return key.mipCount > 1 ? bytes * 4 / 3 : bytes;
+	}
+
+	// Frees images the pool handed back. GL names of the session's context are deleted with that context made
+	// current (and the caller's restored); names from an older context are just forgotten, that context owns them.
+	static void ReleasePooledImages(std::vector<PooledImage>& images) {
+		const uint64_t sessionGL = (uint64_t)(uintptr_t)g_session.glRC;
+		bool needsSessionContext = false;
+		for (const PooledImage& image : images) {
+			if (image.gl != 0 && sessionGL != 0 && image.device == sessionGL) needsSessionContext = true;
+		}
+		HGLRC prevRC = wglGetCurrentContext();
+		HDC prevDC = wglGetCurrentDC();
+		const bool switched = needsSessionContext && prevRC != g_session.glRC && g_session.glDC &&
+			wglMakeCurrent(g_session.glDC, g_session.glRC);
+		const uint64_t currentGL = (uint64_t)(uintptr_t)wglGetCurrentContext();
+		for (PooledImage& image : images) {
+			if (image.gl != 0 && image.device == currentGL) glDeleteTextures(1, &image.gl);
+		}
+		if (switched) wglMakeCurrent(prevDC, prevRC);
+		images.clear();
+	}
+
+	static void LogTexturePoolStats(const char* when) {
+		const texpool::Stats& st = g_texturePool.GetStats();
+		Logf("[OXRWXR] Swapchain pool (%s): hit rate %.0f%% (%llu hits, %llu misses), resident %.1f MB in %zu images (peak %.1f MB, budget %.0f MB, %llu evicted)",
+			when, st.HitRate() * 100.0, (unsigned long long)st.hits, (unsigned long long)st.misses,
+			(double)st.residentBytes / (1024.0 * 1024.0), g_texturePool.Size(), (double)st.peakBytes / (1024.0 * 1024.0),
+			(double)g_texturePool.Budget() / (1024.0 * 1024.0), (unsigned long long)st.evictions);
+	}
 
 	// Head tracking state for mouse look and WASD movement
 	static XrVector3f g_headPos = { 0.0f, 1.7f, 0.0f };  // Start at standing eye height
@@ -554,6 +1036,13 @@ namespace rt {
 		float prevYaw;              // Previous yaw for angular velocity
 		float prevPitch;            // Previous pitch for angular velocity
 		float prevRoll;				// Previous roll for angular velocity
+
+		// Capacitive touch, only from senders that include the touch section
+		bool triggerTouched;
+		bool thumbstickTouched;
+		bool primaryTouched;
+		bool secondaryTouched;
+		bool thumbrestTouched;
 	};
 	static ControllerState g_leftController = {
 		0.0f, -0.3f, true,  // Position/orientation
@@ -568,17 +1057,256 @@ namespace rt {
 		{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, 0.0f, 0.0f, 0.0f  // Velocity tracking
 	};
 
-	// Map XrSpace handles to controller type (0=none, 1=left grip, 2=left aim, 3=right grip, 4=right aim)
-	static std::unordered_map<XrSpace, int> g_controllerSpaces;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Touch bits per hand; without a touch section a pressed button or a deflected stick counts as touched
+	static void SetTouch(ControllerState& ctrl, const udppkt::Packet& packet, bool right) {
+		if (packet.hasTouch) {
+			const bool* t = packet.touch + (right ? udppkt::kTouchRightTrigger : udppkt::kTouchLeftTrigger);
+			ctrl.triggerTouched = t[0];
+			ctrl.thumbstickTouched = t[1];
+			ctrl.primaryTouched = t[2];
+			ctrl.secondaryTouched = t[3];
+			ctrl.thumbrestTouched = t[4];
+			return;
+		}
+		ctrl.triggerTouched = ctrl.triggerPressed || ctrl.triggerValue > 0.0f;
+		ctrl.thumbstickTouched = ctrl.thumbstickPressed || ctrl.thumbstick.x != 0.0f || ctrl.thumbstick.y != 0.0f;
+		ctrl.primaryTouched = ctrl.primaryPressed;
+		ctrl.secondaryTouched = ctrl.secondaryPressed;
+		ctrl.thumbrestTouched = false;
+	}
+
+	// Digital input from the button string; analog trigger and grip follow the button
+	static void SetButton(ControllerState& ctrl, bindings::Input input, bool pressed) {
+		switch (input) {
+		case bindings::Input::Trigger: ctrl.triggerPressed = pressed; ctrl.triggerValue = pressed ? 1.0f : 0.0f; break;
+		case bindings::Input::Squeeze: ctrl.gripPressed = pressed; ctrl.gripValue = pressed ? 1.0f : 0.0f; break;
+		case bindings::Input::Menu: ctrl.menuPressed = pressed; break;
+		case bindings::Input::Primary: ctrl.primaryPressed = pressed; break;
+		case bindings::Input::Secondary: ctrl.secondaryPressed = pressed; break;
+		case bindings::Input::ThumbstickClick: ctrl.thumbstickPressed = pressed; break;
+		default: break;
+		}
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Spaces, action sets and actions live in generational handle tables, so destroyed or foreign handles are rejected
+	struct SpaceRecord {
+		int controllerType{ 0 };  // 0=none, 1=left, 2=right
+		bool isActionSpace{ false };
+		XrReferenceSpaceType referenceType{ XR_REFERENCE_SPACE_TYPE_LOCAL };
+	};
+	static handles::Table<SpaceRecord, handles::HandleType::Space, XrSpace> g_spaces;
+
+	struct ActionSetRecord {
+		std::string name;
+	};
+	static handles::Table<ActionSetRecord, handles::HandleType::ActionSet, XrActionSet> g_actionSets;
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Every XrPath is an ID into the interner. The top-level user paths are interned first, in this order,
+	// so hand detection is an integer compare against these constants.
+	static constexpr XrPath g_leftHandPath = 1;
+	static constexpr XrPath g_rightHandPath = 2;
+	static paths::Interner g_paths{
+		"/user/hand/left",
+		"/user/hand/right",
+		"/user/head",
+		"/user/gamepad",
+	};
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Interaction profile tables, interned once into per-profile arrays indexed by binding path ID
+	struct CompiledProfile {
+		const profiles::Profile* desc{ nullptr };
+		XrPath path{ XR_NULL_PATH };
+		std::vector<bindings::Binding> byPath;  // hand == kHandAny: not a path of this profile
+	};
+
+	static const std::vector<CompiledProfile>& InteractionProfiles() {
+		static const std::vector<CompiledProfile> compiled = []() {
+			std::vector<CompiledProfile> out;
+			for (const profiles::Profile& desc : profiles::kProfiles) {
+				CompiledProfile cp;
+				cp.desc = &desc;
+				cp.path = g_paths.Intern(desc.path);
+				auto add = [&](const char* side, bindings::Hand hand, const profiles::InputPath* inputs, size_t count) {
+					for (size_t i = 0; i < count; ++i) {
+						XrPath id = g_paths.Intern(std::string("/user/hand/") + side + inputs[i].path);
+						if (cp.byPath.size() <= id) cp.byPath.resize((size_t)id + 1);
+						cp.byPath[(size_t)id] = bindings::Binding{ inputs[i].input, hand };
+					}
+					};
+				add("left", bindings::kHandLeft, desc.left, desc.leftCount);
+				add("right", bindings::kHandRight, desc.right, desc.rightCount);
+				out.push_back(std::move(cp));
+			}
+			return out;
+			}();
+		return compiled;
+	}
+
+	// nullptr for profiles without a table
+	static const CompiledProfile* FindInteractionProfile(XrPath profile) {
+		for (const CompiledProfile& cp : InteractionProfiles()) {
+			if (cp.path == profile) return &cp;
+		}
+		return nullptr;
+	}
+
+	// Resolves a suggested binding through the profile's table, or by parsing the path for profiles without one.
+	// Paths the table doesn't list as is, such as identifier-only ones ("/user/hand/left/input/trigger"), are looked up
+	// again with the component that fits the action type, and parsed if the profile has no such input either.
+	static bool ResolveBinding(const CompiledProfile* profile, XrPath binding, XrActionType type, bindings::Binding& out) {
+		if (profile) {
+			if (binding < profile->byPath.size() && profile->byPath[(size_t)binding].hand != bindings::kHandAny) {
+				out = profile->byPath[(size_t)binding];
+				return out.input != bindings::Input::None;
+			}
+			constexpr std::string_view kLeft = "/user/hand/left", kRight = "/user/hand/right";
+			std::string_view path = g_paths.View(binding);
+			const profiles::InputPath* found = nullptr;
+			bindings::Hand hand = bindings::kHandAny;
+			if (path.substr(0, kLeft.size()) == kLeft) {
+				hand = bindings::kHandLeft;
+				found = profiles::FindInput(profile->desc->left, profile->desc->leftCount, path.substr(kLeft.size()), type);
+			}
+			else if (path.substr(0, kRight.size()) == kRight) {
+				hand = bindings::kHandRight;
+				found = profiles::FindInput(profile->desc->right, profile->desc->rightCount, path.substr(kRight.size()), type);
+			}
+			if (found) {
+				out = bindings::Binding{ found->input, hand };
+				return out.input != bindings::Input::None;
+			}
+		}
+		return bindings::ParseBindingPath(g_paths.View(binding), out);
+	}
+
+	struct ActionRecord {
+		std::string name;         // Action name for input mapping
+		int hand{ 0 };            // Which hand it's bound to (0=both/any, 1=left, 2=right)
+		XrActionType type{ XR_ACTION_TYPE_BOOLEAN_INPUT };
+		XrActionSet set{ XR_NULL_HANDLE };
+
+		//----------------
+		//OXRWXR CHANGE:
+		//---------------- 
+		// Compiled input per hand (left, right), read directly by the state queries
+		bindings::Input input[2]{ bindings::Input::None, bindings::Input::None };
+		bindings::Hand defaultHand{ bindings::kHandRight };  // Used when a query has no subaction path
+		bool fromBindings{ false };
+
+		// State as of the last xrSyncActions: [0] no subaction path, [1] left, [2] right
+		actstate::Channel synced[3];
+		std::vector<XrPath> subactionPaths;  // As given to xrCreateAction; queries may only use these (or XR_NULL_PATH)
+	};
+	static handles::Table<ActionRecord, handles::HandleType::Action, XrAction> g_actions;
+
+	// Whether a query or haptic call may address the action through subactionPath
+	static bool AcceptsSubactionPath(const ActionRecord& rec, XrPath subactionPath) {
+		return subactionPath == XR_NULL_PATH ||
+			std::find(rec.subactionPaths.begin(), rec.subactionPaths.end(), subactionPath) != rec.subactionPaths.end();
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Suggested bindings per interaction profile, compiled into the action records when the app attaches its sets
+	struct SuggestedBinding {
+		XrAction action;
+		XrPath binding;
+	};
+	static std::unordered_map<XrPath, std::vector<SuggestedBinding>> g_suggestedBindings;
+	static XrPath g_boundProfile = XR_NULL_PATH;
+
+	static void GuessActionInputs(ActionRecord& rec) {
+		bindings::Input guess = bindings::GuessInput(rec.name, rec.type);
+		// An action created for one hand only guesses that hand; one created for both or neither guesses both
+		const bool oneHand = rec.hand == 1 || rec.hand == 2;
+		rec.input[0] = (!oneHand || rec.hand == 1) ? guess : bindings::Input::None;
+		rec.input[1] = (!oneHand || rec.hand == 2) ? guess : bindings::Input::None;
+		rec.defaultHand = rec.hand == 1 ? bindings::kHandLeft : bindings::kHandRight;
+		rec.fromBindings = false;
+	}
+
+	// Returns true when the bound profile changed
+	static bool CompileActionBindings() {
+		// Pick the suggested profile closest to the simulated controllers; profiles without a table rank last
+		const XrPath previousProfile = g_boundProfile;
+		const std::vector<SuggestedBinding>* chosen = nullptr;
+		const CompiledProfile* chosenProfile = nullptr;
+		size_t bestRank = SIZE_MAX;
+		g_boundProfile = XR_NULL_PATH;
+		for (const auto& [profile, suggested] : g_suggestedBindings) {
+			const CompiledProfile* cp = FindInteractionProfile(profile);
+			size_t rank = cp ? profiles::Rank((size_t)(cp->desc - profiles::kProfiles), hmdMake) : SIZE_MAX - 1;
+			if (!chosen || rank < bestRank) {
+				chosen = &suggested;
+				chosenProfile = cp;
+				bestRank = rank;
+				g_boundProfile = profile;
+			}
+		}
+
+		// Name guesses first; whatever the chosen profile binds replaces them
+		g_actions.ForEach([](XrAction, ActionRecord& rec) { GuessActionInputs(rec); });
+		if (chosen) {
+			for (const SuggestedBinding& sb : *chosen) {
+				ActionRecord* rec = g_actions.Get(sb.action);
+				bindings::Binding b;
+				if (!rec || !ResolveBinding(chosenProfile, sb.binding, rec->type, b)) continue;
+				if (!rec->fromBindings) {
+					rec->input[0] = rec->input[1] = bindings::Input::None;
+					rec->fromBindings = true;
+				}
+				bindings::Input& slot = rec->input[b.hand - 1];
+				if (slot == bindings::Input::None) slot = b.input;
+			}
+		}
 
-	// Map XrPath to path string for controller detection
-	static std::unordered_map<XrPath, std::string> g_pathStrings;
+		size_t total = 0, bound = 0;
+		g_actions.ForEach([&](XrAction, ActionRecord& rec) {
+			++total;
+			if (!rec.fromBindings) return;
+			++bound;
+			// Bound to one hand only: queries without a subaction path read that hand
+			if (rec.hand == 0 && rec.input[0] != bindings::Input::None && rec.input[1] == bindings::Input::None) {
+				rec.defaultHand = bindings::kHandLeft;
+			}
+			});
+		std::string_view profileName = g_paths.View(g_boundProfile);
+		Logf("[OXRWXR] Compiled action bindings: profile=%.*s, %zu of %zu actions bound, rest guessed from names",
+			profileName.empty() ? 6 : (int)profileName.size(), profileName.empty() ? "(none)" : profileName.data(), bound, total);
+		return g_boundProfile != previousProfile;
+	}
 
-	// Map XrAction to action name for input mapping
-	static std::unordered_map<XrAction, std::string> g_actionNames;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Controller input as of the latest UDP packet, published by xrWaitFrame and taken whole by xrSyncActions
+	struct InputSnapshot {
+		ControllerState left{};
+		ControllerState right{};
+		XrTime time{ 0 };
+	};
+	static actstate::TripleBuffer<InputSnapshot> g_inputSnapshots;
 
-	// Map XrAction to which hand it's bound to (0=both/any, 1=left, 2=right)
-	static std::unordered_map<XrAction, int> g_actionHand;
+	static void PublishInputSnapshot() {
+		InputSnapshot& snap = g_inputSnapshots.Back();
+		snap.left = g_leftController;
+		snap.right = g_rightController;
+		snap.time = QpcNowNs();
+		g_inputSnapshots.Publish();
+	}
 
 	// Time tracking for velocity calculation
 	static XrTime g_lastFrameTime = 0;
@@ -828,13 +1556,287 @@ namespace rt {
 		return true;
 	}
 
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// GPU objects created and constant uploads issued by the preview path. After warm-up every frame
+	// should be served from persistent resources, so allocations per interval are expected to stay at 0.
+	struct PreviewCounters {
+		uint64_t frames{ 0 };
+		uint64_t allocations{ 0 };      // Buffers and views created outside the blit cache
+		uint64_t constantUploads{ 0 };  // Constant buffer writes actually issued
+		uint64_t lastAllocations{ 0 };
+		uint64_t lastUploads{ 0 };
+		uint64_t skippedUnchanged{ 0 };  // xrEndFrame calls that resubmitted the previous frame's content
+		uint64_t blockingPresents{ 0 };  // Low-latency presents that fell back to vsync because the compositor still held every buffer
+	};
+	static PreviewCounters g_previewCounters;
+
+	static void NotePreviewFrame(Session& s) {
+		PreviewCounters& c = g_previewCounters;
+		if (++c.frames % 600 != 0 || !verboseLogging) return;
+		const blitcache::Stats& cache = s.blitCache.GetStats();
+		uint64_t allocations = c.allocations + cache.creates + cache.failures;
+		Logf("[OXRWXR] Preview resources: %llu allocations, %llu constant uploads in the last 600 frames (cache entries=%zu hits=%llu evictions=%llu, unchanged frames skipped=%llu, blocking presents=%llu)",
+			(unsigned long long)(allocations - c.lastAllocations), (unsigned long long)(c.constantUploads - c.lastUploads),
+			s.blitCache.Size(), (unsigned long long)cache.hits, (unsigned long long)cache.evictions, (unsigned long long)c.skippedUnchanged,
+			(unsigned long long)c.blockingPresents);
+		c.lastAllocations = allocations;
+		c.lastUploads = c.constantUploads;
+	}
+
+	// Writes the solid color overlay constants, skipping the upload when the color is unchanged
+	static bool UpdateColorConstants(Session& s, const float color[4]) {
+		if (!s.colorConstantBuffer) {
+			D3D11_BUFFER_DESC cbDesc = {};
+			cbDesc.ByteWidth = sizeof(float) * 4;
+			cbDesc.Usage = D3D11_USAGE_DEFAULT;
+			cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+			HRESULT hr = s.d3d11Device->CreateBuffer(&cbDesc, nullptr, s.colorConstantBuffer.GetAddressOf());
+			if (FAILED(hr)) {
+				Logf("[WinXrApi] Failed to create color constant buffer: 0x%08X", hr);
+				return false;
+			}
+			++g_previewCounters.allocations;
+			s.colorConstantsValid = false;
+		}
+		if (s.colorConstantsValid && memcmp(s.colorConstants, color, sizeof(s.colorConstants)) == 0) return true;
+		s.d3d11Context->UpdateSubresource(s.colorConstantBuffer.Get(), 0, nullptr, color, 0, 0);
+		memcpy(s.colorConstants, color, sizeof(s.colorConstants));
+		s.colorConstantsValid = true;
+		++g_previewCounters.constantUploads;
+		return true;
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Grid warp used for depth-aware reprojection. The vertex shader moves a regular grid over the
+	// rendered eye to where each cell lands for the newer pose; color comes from the regular blitPS.
+	struct WarpConstants {
+		float srcTan[4];     // left, right, up, down tangents the app rendered with
+		float dstTan[4];     // tangents of the target view
+		float row[3][4];     // rendered eye -> target eye (3x4)
+		float depthRange[4]; // minDepth, maxDepth, 1/nearZ, 1/farZ
+		float depthRect[4];  // imageRect of the depth sub-image in texels
+		float motionRect[4]; // imageRect of the motion vector sub-image in texels
+		float gridInfo[4];   // grid cells per side, has depth, motion scale, has motion
+	};
+
+	static const uint32_t kWarpGridSize = 64;
+
+	bool InitWarpResources(Session& s) {
+		if (s.warpVS && s.warpConstantBuffer) {
+			return true;
+		}
+
+		const char* warpShaderSource = R"(
+			cbuffer WarpBuffer : register(b2) {
+				float4 srcTan;
+				float4 dstTan;
+				float4 row0;
+				float4 row1;
+				float4 row2;
+				float4 depthRange;
+				float4 depthRect;
+				float4 motionRect;
+				float4 gridInfo;
+			};
+
+			Texture2D<float> depthTex : register(t1);
+			Texture2D<float4> motionTex : register(t2);
+
+			struct VS_OUTPUT {
+				float4 Pos : SV_POSITION;
+				float2 Tex : TEXCOORD;
+			};
+
+			static const float2 kCorners[6] = {
+				float2(0, 0), float2(1, 0), float2(0, 1),
+				float2(0, 1), float2(1, 0), float2(1, 1)
+			};
+
+			float LinearDistance(float d) {
+				float t = saturate((d - depthRange.x) / (depthRange.y - depthRange.x));
+				float invZ = lerp(depthRange.z, depthRange.w, t);
+				return 1.0 / max(invZ, 1e-4);
+			}
+
+			VS_OUTPUT VSMain(uint vertexId : SV_VertexID) {
+				VS_OUTPUT output;
+				uint grid = (uint)gridInfo.x;
+				uint cell = vertexId / 6;
+				float2 uv = (float2(cell % grid, cell / grid) + kCorners[vertexId % 6]) / gridInfo.x;
+
+				// Nearest of the 2x2 depth texels under this grid vertex, so edges of
+				// foreground objects stretch over the background instead of tearing
+				float dist = 1.0 / 1e-4;
+				if (gridInfo.y > 0.5) {
+					int2 lo = int2(depthRect.xy);
+					int2 hi = int2(depthRect.xy + depthRect.zw) - 1;
+					int2 p0 = clamp(int2(depthRect.xy + uv * depthRect.zw - 0.5), lo, hi);
+					int2 p1 = min(p0 + 1, hi);
+					dist = min(min(LinearDistance(depthTex.Load(int3(p0.x, p0.y, 0))),
+						LinearDistance(depthTex.Load(int3(p1.x, p0.y, 0)))),
+						min(LinearDistance(depthTex.Load(int3(p0.x, p1.y, 0))),
+						LinearDistance(depthTex.Load(int3(p1.x, p1.y, 0)))));
+				}
+
+				float3 p = dist * float3(lerp(srcTan.x, srcTan.y, uv.x), lerp(srcTan.z, srcTan.w, uv.y), -1.0);
+				float3 q = float3(dot(row0.xyz, p) + row0.w, dot(row1.xyz, p) + row1.w, dot(row2.xyz, p) + row2.w);
+				float qd = max(-q.z, 1e-4);
+				float2 dst = float2((q.x / qd - dstTan.x) / (dstTan.y - dstTan.x),
+					(dstTan.z - q.y / qd) / (dstTan.z - dstTan.w));
+
+				// Synthesized frames: continue the app's own motion (XR_FB_space_warp, NDC units, y up)
+				if (gridInfo.w > 0.5) {
+					int2 m = clamp(int2(motionRect.xy + uv * motionRect.zw), int2(motionRect.xy),
+						int2(motionRect.xy + motionRect.zw) - 1);
+					float2 mv = motionTex.Load(int3(m.x, m.y, 0)).xy;
+					dst += float2(mv.x, -mv.y) * 0.5 * gridInfo.z;
+				}
+
+				output.Pos = float4(dst.x * 2.0 - 1.0, 1.0 - dst.y * 2.0, 0.0, 1.0);
+				output.Tex = uv;
+				return output;
+			}
+		)";
+
+		ComPtr<ID3DBlob> vsBlob, errorBlob;
+		HRESULT hr = D3DCompile(warpShaderSource, strlen(warpShaderSource), "WarpShader", nullptr, nullptr,
+			"VSMain", "vs_5_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, vsBlob.GetAddressOf(), errorBlob.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to compile warp VS: %s", errorBlob ? (char*)errorBlob->GetBufferPointer() : "Unknown error");
+			return false;
+		}
+		hr = s.d3d11Device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(),
+			nullptr, s.warpVS.GetAddressOf());
+		if (FAILED(hr)) { Logf("[OXRWXR] Failed to create warp VS: 0x%08X", hr); return false; }
+
+		D3D11_BUFFER_DESC cbDesc = {};
+		cbDesc.ByteWidth = sizeof(WarpConstants);
+		cbDesc.Usage = D3D11_USAGE_DEFAULT;
+		cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		hr = s.d3d11Device->CreateBuffer(&cbDesc, nullptr, s.warpConstantBuffer.GetAddressOf());
+		if (FAILED(hr)) { Logf("[OXRWXR] Failed to create warp constant buffer: 0x%08X", hr); return false; }
+
+		if (verboseLogging) Log("[OXRWXR] Warp resources initialized successfully.");
+		return true;
+	}
+
+	// Shader-readable copy formats for the depth formats xrEnumerateSwapchainFormats advertises
+	static bool GetDepthCopyFormats(DXGI_FORMAT format, DXGI_FORMAT& textureFormat, DXGI_FORMAT& srvFormat) {
+		switch (format) {
+		case DXGI_FORMAT_D32_FLOAT:
+		case DXGI_FORMAT_R32_TYPELESS:
+			textureFormat = DXGI_FORMAT_R32_TYPELESS; srvFormat = DXGI_FORMAT_R32_FLOAT; return true;
+		case DXGI_FORMAT_D24_UNORM_S8_UINT:
+		case DXGI_FORMAT_R24G8_TYPELESS:
+			textureFormat = DXGI_FORMAT_R24G8_TYPELESS; srvFormat = DXGI_FORMAT_R24_UNORM_X8_TYPELESS; return true;
+		case DXGI_FORMAT_D16_UNORM:
+		case DXGI_FORMAT_R16_TYPELESS:
+			textureFormat = DXGI_FORMAT_R16_TYPELESS; srvFormat = DXGI_FORMAT_R16_UNORM; return true;
+		case DXGI_FORMAT_D32_FLOAT_S8X24_UINT:
+		case DXGI_FORMAT_R32G8X24_TYPELESS:
+			textureFormat = DXGI_FORMAT_R32G8X24_TYPELESS; srvFormat = DXGI_FORMAT_R32_FLOAT_X8X24_TYPELESS; return true;
+		default:
+			return false;
+		}
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Low-latency preview presentation. The frame latency wait happens in xrWaitFrame (PollPreviewLatency)
+	// instead of inside Present, so the app thread is never blocked by the desktop compositor.
+	static void ClosePreviewLatencyWaitable(rt::Session& s) {
+		if (s.previewLatencyWaitable) {
+			CloseHandle(s.previewLatencyWaitable);
+			s.previewLatencyWaitable = nullptr;
+		}
+		s.previewLatencyReady = false;
+		s.previewAllowTearing = false;
+	}
+
+	// Creation flags for a preview swapchain: waitable, plus tearing when the OS and driver support it
+	static UINT PreviewSwapchainFlags(IDXGIFactory* factory) {
+		if (!bPreviewLowLatency) return 0;
+		UINT flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+		ComPtr<IDXGIFactory5> factory5;
+		BOOL allowTearing = FALSE;
+		if (factory && SUCCEEDED(factory->QueryInterface(IID_PPV_ARGS(factory5.GetAddressOf()))) &&
+			SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, sizeof(allowTearing))) && allowTearing) {
+			flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+		}
+		return flags;
+	}
+
+	// Picks up the waitable of a (new or reused) preview swapchain created with PreviewSwapchainFlags
+	static void AttachPreviewLatency(rt::Session& s, IDXGISwapChain1* swapchain) {
+		ClosePreviewLatencyWaitable(s);
+		if (!bPreviewLowLatency || !swapchain) return;
+		DXGI_SWAP_CHAIN_DESC1 desc{};
+		ComPtr<IDXGISwapChain2> swapchain2;
+		if (FAILED(swapchain->GetDesc1(&desc)) || !(desc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) ||
+			FAILED(swapchain->QueryInterface(IID_PPV_ARGS(swapchain2.GetAddressOf())))) {
+			return;
+		}
+		swapchain2->SetMaximumFrameLatency(1);
+		s.previewLatencyWaitable = swapchain2->GetFrameLatencyWaitableObject();
+		s.previewAllowTearing = (desc.Flags & DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING) != 0;
+		// The waitable starts signaled, so the first frame doesn't have to wait for xrWaitFrame
+		s.previewLatencyReady = s.previewLatencyWaitable && WaitForSingleObjectEx(s.previewLatencyWaitable, 0, FALSE) == WAIT_OBJECT_0;
+		Logf("[OXRWXR] Low-latency preview: waitable=%p tearing=%d", s.previewLatencyWaitable, (int)s.previewAllowTearing);
+	}
+
+	// Called from the frame pacer: claims a free buffer if the compositor has released one, without blocking
+	static void PollPreviewLatency(rt::Session& s) {
+		if (!s.previewLatencyWaitable || s.previewLatencyReady) return;
+		s.previewLatencyReady = WaitForSingleObjectEx(s.previewLatencyWaitable, 0, FALSE) == WAIT_OBJECT_0;
+	}
+
+	// How long PresentPreview waits for the compositor to release a buffer before presenting with vsync
+	static const DWORD kPreviewLatencyWaitMs = 4;
+
+	// Presents whichever preview swapchain is active. In low-latency mode a present without a claimed
+	// buffer waits briefly for one and otherwise falls back to a blocking vsync present; frames are never
+	// dropped, since each one carries the sync block (AER eye / red-blue channel) the host relies on.
+	static HRESULT PresentPreview(rt::Session& s) {
+		UINT syncInterval = 1;
+		UINT flags = 0;
+		if (s.previewLatencyWaitable) {
+			PollPreviewLatency(s);
+			if (!s.previewLatencyReady) {
+				s.previewLatencyReady = WaitForSingleObjectEx(s.previewLatencyWaitable, kPreviewLatencyWaitMs, FALSE) == WAIT_OBJECT_0;
+			}
+			if (s.previewLatencyReady) {
+				s.previewLatencyReady = false;
+				syncInterval = 0;
+				if (s.previewAllowTearing) flags |= DXGI_PRESENT_ALLOW_TEARING;
+			}
+			else {
+				++g_previewCounters.blockingPresents;
+			}
+		}
+		if (s.usesD3D12 && s.previewSwapchain12) return s.previewSwapchain12->Present(syncInterval, flags);
+		if (s.previewSwapchain) return s.previewSwapchain->Present(syncInterval, flags);
+		return E_FAIL;
+	}
+
 	static void ResetD3D12PreviewResources(rt::Session& s) {
+		// Backbuffers and allocators may still be referenced by queued blits
+		if (s.previewFence && s.previewFenceEvent && s.previewFenceValue > 0 &&
+			s.previewFence->GetCompletedValue() < s.previewFenceValue - 1) {
+			s.previewFence->SetEventOnCompletion(s.previewFenceValue - 1, s.previewFenceEvent);
+			WaitForSingleObject(s.previewFenceEvent, 1000);
+		}
 		s.previewSwapchain12.Reset();
 		s.previewRTVHeap.Reset();
 		s.previewBackbuffers.clear();
 		s.previewBackbufferCount = 0;
 		s.previewRTVDescriptorSize = 0;
-		s.previewCmdAlloc.Reset();
+		s.previewCmdAllocs.clear();
+		s.previewAllocFenceValues.clear();
 		s.previewCmdList.Reset();
 		s.previewFence.Reset();
 		s.previewFenceValue = 0;
@@ -844,6 +1846,104 @@ namespace rt {
 		}
 	}
 
+	// Views on the D3D11 preview backbuffer keep the old swapchain alive, drop them before replacing it
+	static void ResetPreviewViews(rt::Session& s) {
+		s.previewRTVs[0].Reset();
+		s.previewRTVs[1].Reset();
+		s.previewRTVBuffer.Reset();
+		s.previewComposite.Reset();
+		s.previewCompositeValid = false;
+	}
+
+	// Cached RTV on the D3D11 preview backbuffer; srgb picks the explicit sRGB view used by projection blits.
+	// Buffer 0 of a flip-model swapchain is the same object every frame, so the views only change with the swapchain.
+	static ID3D11RenderTargetView* GetPreviewRTV(rt::Session& s, bool srgb) {
+		if (!s.previewSwapchain) return nullptr;
+		ComPtr<ID3D11Texture2D> bb;
+		if (FAILED(s.previewSwapchain->GetBuffer(0, IID_PPV_ARGS(bb.GetAddressOf())))) {
+			Log("[OXRWXR] Failed to get preview swapchain buffer.");
+			return nullptr;
+		}
+		if (bb != s.previewRTVBuffer) {
+			ResetPreviewViews(s);
+			s.previewRTVBuffer = bb;
+		}
+
+		ComPtr<ID3D11RenderTargetView>& rtv = s.previewRTVs[srgb ? 1 : 0];
+		if (rtv) return rtv.Get();
+
+		if (srgb) {
+			// Create explicit sRGB RTV for proper gamma encoding
+			DXGI_FORMAT rtvFmt = s.previewFormat;
+			if (rtvFmt == DXGI_FORMAT_R8G8B8A8_UNORM)       rtvFmt = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+			else if (rtvFmt == DXGI_FORMAT_B8G8R8A8_UNORM)  rtvFmt = DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+
+			D3D11_RENDER_TARGET_VIEW_DESC rtvDesc = {};
+			rtvDesc.Format = rtvFmt;
+			rtvDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
+			rtvDesc.Texture2D.MipSlice = 0;
+
+			HRESULT hr = s.d3d11Device->CreateRenderTargetView(bb.Get(), &rtvDesc, rtv.GetAddressOf());
+			++g_previewCounters.allocations;
+			if (SUCCEEDED(hr)) return rtv.Get();
+			Logf("[OXRWXR] Explicit sRGB RTV failed (0x%08X), falling back to auto format", hr);
+		}
+
+		++g_previewCounters.allocations;
+		if (FAILED(s.d3d11Device->CreateRenderTargetView(bb.Get(), nullptr, rtv.GetAddressOf()))) {
+			Log("[OXRWXR] Failed to create RTV for preview.");
+			return nullptr;
+		}
+		return rtv.Get();
+	}
+
+	// Preview policy: what this frame redraws. Held frames reuse the last composed eyes, so only the D3D11
+	// preview (which keeps a copy of them) can hold; the D3D12 preview's eyes are plain copies anyway.
+	enum class PreviewPass { Compose, Hold, SyncOnly };
+
+	static PreviewPass NextPreviewPass(rt::Session& s) {
+		if (ui::g_uiState.previewSyncOnly) {
+			s.previewCompositeValid = false;
+			return PreviewPass::SyncOnly;
+		}
+		const uint32_t divisor = (uint32_t)std::max(1, ui::g_uiState.previewRateDivisor);
+		if (divisor > 1 && s.previewCompositeValid && ++s.previewPassIndex % divisor != 0) {
+			return PreviewPass::Hold;
+		}
+		s.previewPassIndex = 0;
+		return PreviewPass::Compose;
+	}
+
+	// Keep the eyes just composed into the D3D11 backbuffer (call after GetPreviewRTV) for the held frames that follow
+	static void StorePreviewComposite(rt::Session& s) {
+		if (ui::g_uiState.previewRateDivisor <= 1 || !s.previewRTVBuffer) {
+			s.previewComposite.Reset();
+			s.previewCompositeValid = false;
+			return;
+		}
+		if (!s.previewComposite) {
+			D3D11_TEXTURE2D_DESC desc;
+			s.previewRTVBuffer->GetDesc(&desc);
+			desc.Usage = D3D11_USAGE_DEFAULT;
+			desc.BindFlags = 0;
+			desc.CPUAccessFlags = 0;
+			desc.MiscFlags = 0;
+			++g_previewCounters.allocations;
+			if (FAILED(s.d3d11Device->CreateTexture2D(&desc, nullptr, s.previewComposite.GetAddressOf()))) {
+				Log("[OXRWXR] Failed to create preview composite texture.");
+				return;
+			}
+		}
+		s.d3d11Context->CopyResource(s.previewComposite.Get(), s.previewRTVBuffer.Get());
+		s.previewCompositeValid = true;
+	}
+
+	static bool RestorePreviewComposite(rt::Session& s) {
+		if (!s.previewCompositeValid || !s.previewComposite || !s.previewRTVBuffer) return false;
+		s.d3d11Context->CopyResource(s.previewRTVBuffer.Get(), s.previewComposite.Get());
+		return true;
+	}
+
 	static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 		switch (msg) {
 		case WM_CLOSE:
@@ -1196,6 +2296,10 @@ static const char* kSupportedExtensions[] = {
 	XR_KHR_OPENGL_ENABLE_EXTENSION_NAME,  // OpenGL support
 	XR_KHR_COMPOSITION_LAYER_DEPTH_EXTENSION_NAME,
 	XR_KHR_COMPOSITION_LAYER_CYLINDER_EXTENSION_NAME,  // UEVR uses this for UI layers
+	XR_FB_SPACE_WARP_EXTENSION_NAME,  // App motion vectors for half-rate frame synthesis
+	XR_META_RECOMMENDED_LAYER_RESOLUTION_EXTENSION_NAME,  // Dynamic resolution hints
+	XR_KHR_VISIBILITY_MASK_EXTENSION_NAME,  // Lets apps skip shading pixels the lenses never show
+	XR_EXT_HAND_TRACKING_EXTENSION_NAME,  // Headset hand tracking, or a skeleton posed from the controllers
 	"XR_KHR_win32_convert_performance_counter_time"    // Unity often requires this
 };
 
@@ -1429,6 +2533,57 @@ static XrResult XRAPI_PTR xrCreateInstance_runtime(const XrInstanceCreateInfo* c
 						verboseLogging = parseBool(line);
 					}
 
+					if (compareKey(line, "reprojection")) {
+						bEnableReprojection = parseBool(line);
+					}
+
+					if (compareKey(line, "half_rate")) {
+						bEnableHalfRate = parseBool(line);
+					}
+
+					if (compareKey(line, "gl_async_readback")) {
+						bGLAsyncReadback = parseBool(line);
+					}
+
+					if (compareKey(line, "d3d12_frames_in_flight")) {
+						iD3D12FramesInFlight = std::clamp(parseInt(line, 2), 1, 3);
+					}
+
+					if (compareKey(line, "skip_unchanged_frames")) {
+						bSkipUnchangedFrames = parseBool(line);
+					}
+
+					if (compareKey(line, "native_mono_view")) {
+						bNativeMonoView = parseBool(line);
+					}
+
+					if (compareKey(line, "dynamic_resolution")) {
+						bDynamicResolution = parseBool(line);
+					}
+
+					if (compareKey(line, "preview_low_latency")) {
+						bPreviewLowLatency = parseBool(line);
+					}
+
+					if (compareKey(line, "swapchain_pool_mb")) {
+						std::vector<rt::PooledImage> evicted;
+						rt::g_texturePool.SetBudget((uint64_t)std::clamp(parseInt(line, 256), 0, 4096) << 20, evicted);
+						rt::ReleasePooledImages(evicted);
+					}
+
+					if (compareKey(line, "preview_rate")) {
+						int divisor = parseInt(line, 1);
+						ui::g_uiState.previewRateDivisor = (divisor >= 4) ? 4 : (divisor >= 2 ? 2 : 1);
+					}
+
+					if (compareKey(line, "preview_scale")) {
+						ui::g_uiState.previewScalePercent = std::clamp(parseInt(line, 100), 10, 100);
+					}
+
+					if (compareKey(line, "preview_sync_only")) {
+						ui::g_uiState.previewSyncOnly = parseBool(line);
+					}
+
 					if (compareKey(line, "depth_mode")) {
 						if (compareValue(line, "aer")) {
 							tryAER = true;
@@ -1524,6 +2679,16 @@ static XrResult XRAPI_PTR xrDestroyInstance_runtime(XrInstance instance) {
 		Log("[OXRWXR] xrDestroyInstance: Clearing global instance");
 		rt::g_instance = {};
 
+		//----------------
+		//OXRWXR CHANGE:
+		//---------------- 
+		// Nothing pooled outlives the instance; D3D images are released here, GL names go with their context
+		{
+			std::vector<rt::PooledImage> pooled;
+			rt::g_texturePool.Clear(pooled);
+			rt::ReleasePooledImages(pooled);
+		}
+
 		// MUST destroy the window before DLL unloads!
 		// The OpenXR loader may unload our DLL after this call.
 		// If the window stays alive, its WndProc points to unloaded code = crash.
@@ -1581,7 +2746,6 @@ static XrResult XRAPI_PTR xrGetSystem_runtime(XrInstance, const XrSystemGetInfo*
 static XrResult XRAPI_PTR xrGetSystemProperties_runtime(XrInstance, XrSystemId, XrSystemProperties* props) {
 	if (!props) return XR_ERROR_VALIDATION_FAILURE;
 	props->type = XR_TYPE_SYSTEM_PROPERTIES;
-	props->next = nullptr;
 	strncpy(props->systemName, "OpenXR WXR", XR_MAX_SYSTEM_NAME_SIZE - 1);
 	props->systemName[XR_MAX_SYSTEM_NAME_SIZE - 1] = '\0';
 	props->systemId = 1;
@@ -1591,33 +2755,58 @@ static XrResult XRAPI_PTR xrGetSystemProperties_runtime(XrInstance, XrSystemId,
 	props->graphicsProperties.maxLayerCount = 16;
 	props->trackingProperties.positionTracking = XR_TRUE;
 	props->trackingProperties.orientationTracking = XR_TRUE;
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// XR_FB_space_warp: motion vectors at half the recommended per-eye resolution
+	for (auto* next = reinterpret_cast<XrBaseOutStructure*>(props->next); next; next = next->next) {
+		if (next->type == XR_TYPE_SYSTEM_SPACE_WARP_PROPERTIES_FB) {
+			auto* spaceWarp = reinterpret_cast<XrSystemSpaceWarpPropertiesFB*>(next);
+			spaceWarp->recommendedMotionVectorImageRectWidth = rt::EyeBaseline().width / 2;
+			spaceWarp->recommendedMotionVectorImageRectHeight = rt::EyeBaseline().height / 2;
+		}
+		else if (next->type == XR_TYPE_SYSTEM_HAND_TRACKING_PROPERTIES_EXT) {
+			reinterpret_cast<XrSystemHandTrackingPropertiesEXT*>(next)->supportsHandTracking = XR_TRUE;
+		}
+	}
 	Log("[OXRWXR] xrGetSystemProperties: returning OpenXR WXR");
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrEnumerateViewConfigurations_runtime(XrInstance, XrSystemId, uint32_t capacity, uint32_t* count, XrViewConfigurationType* types) {
 	Logf("[OXRWXR] xrEnumerateViewConfigurations called: capacity=%u", capacity);
-	if (count) *count = 1;
-	if (capacity >= 1 && types) {
-		types[0] = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
-		Log("[OXRWXR] xrEnumerateViewConfigurations: Returning PRIMARY_STEREO");
+	if (count) *count = 2;
+	if (capacity >= 2 && types) {
+		//----------------
+		//OXRWXR CHANGE:
+		//---------------- 
+		// Preferred configuration first: apps pick the first one they support
+		const bool mono = rt::MonoViewPreferred();
+		types[0] = mono ? XR_VIEW_CONFIGURATION_TYPE_PRIMARY_MONO : XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+		types[1] = mono ? XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO : XR_VIEW_CONFIGURATION_TYPE_PRIMARY_MONO;
+		Logf("[OXRWXR] xrEnumerateViewConfigurations: Returning %s first", mono ? "PRIMARY_MONO" : "PRIMARY_STEREO");
 	}
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrEnumerateViewConfigurationViews_runtime(XrInstance, XrSystemId, XrViewConfigurationType viewType, uint32_t capacity, uint32_t* count, XrViewConfigurationView* views) {
 	Logf("[OXRWXR] xrEnumerateViewConfigurationViews called: viewType=%d, capacity=%u", (int)viewType, capacity);
-	if (count) *count = 2;
-	if (capacity >= 2 && views) {
-		for (uint32_t i = 0; i < 2; ++i) {
+	const uint32_t viewCount = rt::ViewCountFor(viewType);
+	if (viewCount == 0) return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+	if (count) *count = viewCount;
+	// Swapchains are sized for the headset's full-scale baseline; dynamic resolution only shrinks the rect inside them
+	const resgov::Baseline& baseline = rt::EyeBaseline();
+	if (capacity >= viewCount && views) {
+		for (uint32_t i = 0; i < viewCount; ++i) {
 			views[i].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
 			views[i].next = nullptr;
-			views[i].recommendedImageRectWidth = 1280;
-			views[i].recommendedImageRectHeight = 720;
+			views[i].recommendedImageRectWidth = baseline.width;
+			views[i].recommendedImageRectHeight = baseline.height;
 			views[i].recommendedSwapchainSampleCount = 1;
 			views[i].maxImageRectWidth = 4096; views[i].maxImageRectHeight = 4096; views[i].maxSwapchainSampleCount = 1;
 		}
-		Log("[OXRWXR] xrEnumerateViewConfigurationViews: Returned 2 views (1280x720 recommended)");
+		Logf("[OXRWXR] xrEnumerateViewConfigurationViews: Returned %u view(s) (%ux%u recommended)", viewCount, baseline.width, baseline.height);
 	}
 	return XR_SUCCESS;
 }
@@ -1647,6 +2836,8 @@ static XrResult XRAPI_PTR xrCreateSession_runtime(XrInstance instance, const XrS
 		rt::g_session.state = XR_SESSION_STATE_IDLE;
 		rt::g_session.d3d11Device.Reset();
 		rt::g_session.d3d11Context.Reset();
+		rt::ResetPreviewViews(rt::g_session);
+		rt::g_session.blitCache.Clear();
 		rt::g_session.previewSwapchain.Reset();
 		rt::g_session.usesD3D12 = false;
 		rt::g_session.d3d12Device.Reset();
@@ -1698,6 +2889,8 @@ static XrResult XRAPI_PTR xrCreateSession_runtime(XrInstance instance, const XrS
 			rt::g_session.d3d12Queue = b12->queue;
 			rt::g_session.d3d11Device.Reset();
 			rt::g_session.d3d11Context.Reset();
+			rt::ResetPreviewViews(rt::g_session);
+			rt::g_session.blitCache.Clear();
 			rt::g_session.previewSwapchain.Reset();
 			rt::g_session.handle = (XrSession)(uintptr_t)(0x1000 + sessionCount);
 			*session = rt::g_session.handle;
@@ -1715,6 +2908,8 @@ static XrResult XRAPI_PTR xrCreateSession_runtime(XrInstance instance, const XrS
 			rt::g_session.d3d11Context.Reset();
 			rt::g_session.d3d12Device.Reset();
 			rt::g_session.d3d12Queue.Reset();
+			rt::ResetPreviewViews(rt::g_session);
+			rt::g_session.blitCache.Clear();
 			rt::g_session.previewSwapchain.Reset();
 			rt::g_session.handle = (XrSession)(uintptr_t)(0x1000 + sessionCount);
 			*session = rt::g_session.handle;
@@ -1729,6 +2924,7 @@ static XrResult XRAPI_PTR xrCreateSession_runtime(XrInstance instance, const XrS
 	return XR_ERROR_GRAPHICS_DEVICE_INVALID;
 }
 
+static void DestroyGLReadback(rt::Session& s);
 
 static XrResult XRAPI_PTR xrDestroySession_runtime(XrSession s) {
 	Logf("[OXRWXR] xrDestroySession called (handle=%llu)", (unsigned long long)s);
@@ -1758,6 +2954,21 @@ static XrResult XRAPI_PTR xrDestroySession_runtime(XrSession s) {
 		}
 	}
 
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Pooled images of this session's device or GL context can never be reused once it is gone; free them
+	// now, while the GL context is still known
+	{
+		std::vector<rt::PooledImage> stale;
+		const uint64_t device = rt::CurrentPoolDevice();
+		rt::g_texturePool.EvictIf([device](const texpool::Key& key) { return key.device == device; }, stale);
+		if (!stale.empty()) {
+			rt::ReleasePooledImages(stale);
+			rt::LogTexturePoolStats("session destroyed");
+		}
+	}
+
 	// Reset session but don't destroy the window
 	rt::g_session.handle = XR_NULL_HANDLE;
 	rt::g_session.state = XR_SESSION_STATE_IDLE;
@@ -1767,7 +2978,24 @@ static XrResult XRAPI_PTR xrDestroySession_runtime(XrSession s) {
 	rt::g_session.d3d12Device.Reset();
 	rt::g_session.d3d12Queue.Reset();
 	rt::ResetD3D12PreviewResources(rt::g_session);
-	// Reset OpenGL state
+	// Reset OpenGL state (PBOs and the read framebuffer belong to the app's context)
+	if ((rt::g_session.glReadback.Width() != 0 || rt::g_session.glReadFbo != 0) && rt::g_session.glDC && rt::g_session.glRC) {
+		HGLRC prevRC = wglGetCurrentContext();
+		HDC prevDC = wglGetCurrentDC();
+		if (wglMakeCurrent(rt::g_session.glDC, rt::g_session.glRC)) {
+			if (rt::g_session.glReadback.Width() != 0 && g_glDeleteBuffers) DestroyGLReadback(rt::g_session);
+			if (rt::g_session.glReadFbo != 0 && g_glDeleteFramebuffers) g_glDeleteFramebuffers(1, &rt::g_session.glReadFbo);
+		}
+		wglMakeCurrent(prevDC, prevRC);
+	}
+	rt::g_session.glReadback.Reset();
+	rt::g_session.glReadFbo = 0;
+	for (uint32_t eye = 0; eye < 2; eye++) {
+		rt::g_session.glStaging[eye].clear();
+		rt::g_session.glDepthStaging[eye].clear();
+		rt::g_session.glStagedDepth[eye] = false;
+		rt::g_session.glStagedSource[eye] = rt::EyeReprojection{};
+	}
 	rt::g_session.usesOpenGL = false;
 	rt::g_session.glDC = nullptr;
 	rt::g_session.glRC = nullptr;
@@ -1775,6 +3003,11 @@ static XrResult XRAPI_PTR xrDestroySession_runtime(XrSession s) {
 	rt::g_session.previewWidth = 1920;
 	rt::g_session.previewHeight = 540;
 	rt::g_session.isFocused = false;
+	// Reprojection / half-rate state belongs to the old device
+	rt::g_session.warpVS.Reset();
+	rt::g_session.warpConstantBuffer.Reset();
+	rt::g_session.blitCache.Clear();
+	rt::g_lastProjection = rt::SubmittedProjection{};
 	Log("[OXRWXR] xrDestroySession: SUCCESS");
 	return XR_SUCCESS;
 }
@@ -1864,13 +3097,28 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 	Log("[OXRWXR] ============================================");
 	if (!ci || !sc) return XR_ERROR_VALIDATION_FAILURE;
 	rt::Swapchain chain{};
-	chain.handle = (XrSwapchain)(uintptr_t)(rt::g_swapchains.size() + 2);
 	chain.format = (DXGI_FORMAT)ci->format;  // Store the original requested format
 	chain.width = ci->width;
 	chain.height = ci->height;
 	chain.arraySize = ci->arraySize ? ci->arraySize : 1;
 	chain.lastAcquired = UINT32_MAX;  // No image acquired yet
 	chain.lastReleased = UINT32_MAX;  // No image released yet
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Matching images from destroyed swapchains are reused before anything new is allocated.
+	// Images of a previous session's device can never match again.
+	chain.poolKey = rt::SwapchainPoolKey(*ci);
+	chain.poolImageBytes = rt::EstimateSwapchainImageBytes(chain.poolKey);
+	{
+		std::vector<rt::PooledImage> stale;
+		const uint64_t device = chain.poolKey.device;
+		rt::g_texturePool.EvictIf([device](const texpool::Key& key) { return key.device != device; }, stale);
+		rt::ReleasePooledImages(stale);
+	}
+	rt::PooledImage pooled;
+
 	// Create textures on appropriate backend
 	if (rt::g_session.usesD3D12) {
 		chain.backend = rt::Swapchain::Backend::D3D12;
@@ -1900,6 +3148,11 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 				(rd.Flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET)
 				? D3D12_RESOURCE_STATE_RENDER_TARGET
 				: D3D12_RESOURCE_STATE_COMMON;
+			if (rt::g_texturePool.Take(chain.poolKey, pooled) && pooled.d3d12) {
+				chain.images12.push_back(std::move(pooled.d3d12));
+				chain.imageStates12.push_back(pooled.state12);
+				continue;
+			}
 			ComPtr<ID3D12Resource> res;
 			HRESULT hr = rt::g_session.d3d12Device->CreateCommittedResource(&hp, D3D12_HEAP_FLAG_NONE, &rd, init, nullptr, IID_PPV_ARGS(res.GetAddressOf()));
 			if (FAILED(hr)) {
@@ -1909,8 +3162,8 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 			chain.images12.push_back(res);
 			chain.imageStates12.push_back(init);
 		}
-		rt::g_swapchains.emplace(chain.handle, std::move(chain));
-		*sc = chain.handle;
+		*sc = rt::AddSwapchain(std::move(chain));
+		rt::LogTexturePoolStats("create");
 		Logf("[OXRWXR] xrCreateSwapchain(D3D12): sc=%p fmt=%d %ux%u array=%u samples=%u", *sc, (int)ci->format, ci->width, ci->height, ci->arraySize, ci->sampleCount);
 		return XR_SUCCESS;
 	}
@@ -1988,15 +3241,23 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 
 		// Create OpenGL textures
 		for (uint32_t i = 0; i < chain.imageCount; ++i) {
+			if (rt::g_texturePool.Take(chain.poolKey, pooled) && pooled.gl != 0) {
+				chain.imagesGL.push_back(pooled.gl);
+				Logf("[OXRWXR] Reused pooled GL texture[%u]: %u", i, pooled.gl);
+				continue;
+			}
+
 			GLuint tex;
 			glGenTextures(1, &tex);
 
 			if (chain.arraySize > 1) {
 				// Use texture array
 				glBindTexture(GL_TEXTURE_2D_ARRAY, tex);
+				GLenum type = (glInternalFormat == GL_DEPTH24_STENCIL8) ? GL_UNSIGNED_INT_24_8 :
+					isDepthFormat ? GL_FLOAT : GL_UNSIGNED_BYTE;
 				g_glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, glInternalFormat,
 					chain.width, chain.height, chain.arraySize,
-					0, glFormat, GL_UNSIGNED_BYTE, nullptr);
+					0, glFormat, type, nullptr);
 				glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 				glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 				glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
@@ -2069,8 +3330,8 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 			wglMakeCurrent(prevDC, prevRC);
 		}
 
-		rt::g_swapchains.emplace(chain.handle, std::move(chain));
-		*sc = chain.handle;
+		*sc = rt::AddSwapchain(std::move(chain));
+		rt::LogTexturePoolStats("create");
 		Logf("[OXRWXR] xrCreateSwapchain(OpenGL): sc=%p fmt=%d %ux%u array=%u imageCount=%u",
 			*sc, (int)ci->format, ci->width, ci->height, ci->arraySize, chain.imageCount);
 		return XR_SUCCESS;
@@ -2143,6 +3404,11 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 		td.Format, td.Width, td.Height, td.ArraySize, td.MipLevels, td.SampleDesc.Count);
 	chain.imageCount = 3;
 	for (uint32_t i = 0; i < chain.imageCount; ++i) {
+		if (rt::g_texturePool.Take(chain.poolKey, pooled) && pooled.d3d11) {
+			Logf("[OXRWXR] Reused pooled swapchain texture[%u]: %p", i, pooled.d3d11.Get());
+			chain.images.push_back(std::move(pooled.d3d11));
+			continue;
+		}
 		ComPtr<ID3D11Texture2D> tex;
 		HRESULT hr = rt::g_session.d3d11Device->CreateTexture2D(&td, nullptr, tex.GetAddressOf());
 		if (FAILED(hr)) {
@@ -2163,32 +3429,32 @@ static XrResult XRAPI_PTR xrCreateSwapchain_runtime(XrSession, const XrSwapchain
 		Logf("[OXRWXR] Created swapchain texture[%u]: %p", i, tex.Get());
 		chain.images.push_back(std::move(tex));
 	}
-	rt::g_swapchains.emplace(chain.handle, std::move(chain));
-	*sc = chain.handle;
+	*sc = rt::AddSwapchain(std::move(chain));
+	rt::LogTexturePoolStats("create");
 	Logf("[OXRWXR] xrCreateSwapchain: sc=%p fmt=%d %ux%u array=%u samples=%u", *sc, (int)ci->format, ci->width, ci->height, ci->arraySize, ci->sampleCount);
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrEnumerateSwapchainImages_runtime(XrSwapchain sc, uint32_t capacity, uint32_t* count, XrSwapchainImageBaseHeader* images) {
-	auto it = rt::g_swapchains.find(sc); if (it == rt::g_swapchains.end()) return XR_ERROR_HANDLE_INVALID;
-	if (it->second.backend == rt::Swapchain::Backend::D3D12) {
-		const uint32_t n = (uint32_t)it->second.images12.size();
+	rt::Swapchain* ch = rt::g_swapchains.Get(sc); if (!ch) return XR_ERROR_HANDLE_INVALID;
+	if (ch->backend == rt::Swapchain::Backend::D3D12) {
+		const uint32_t n = (uint32_t)ch->images12.size();
 		if (count) *count = n;
 		if (capacity >= n && images) {
 			auto* arr = reinterpret_cast<XrSwapchainImageD3D12KHR*>(images);
-			for (uint32_t i = 0; i < n; ++i) { arr[i].type = XR_TYPE_SWAPCHAIN_IMAGE_D3D12_KHR; arr[i].texture = it->second.images12[i].Get(); }
+			for (uint32_t i = 0; i < n; ++i) { arr[i].type = XR_TYPE_SWAPCHAIN_IMAGE_D3D12_KHR; arr[i].texture = ch->images12[i].Get(); }
 		}
 		if (verboseLogging) Logf("[OXRWXR] xrEnumerateSwapchainImages(D3D12): sc=%p count=%u", sc, n);
 		return XR_SUCCESS;
 	}
-	else if (it->second.backend == rt::Swapchain::Backend::OpenGL) {
-		const uint32_t n = (uint32_t)it->second.imagesGL.size();
+	else if (ch->backend == rt::Swapchain::Backend::OpenGL) {
+		const uint32_t n = (uint32_t)ch->imagesGL.size();
 		if (count) *count = n;
 		if (capacity >= n && images) {
 			auto* arr = reinterpret_cast<XrSwapchainImageOpenGLKHR*>(images);
 			for (uint32_t i = 0; i < n; ++i) {
 				arr[i].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
-				arr[i].image = it->second.imagesGL[i];
+				arr[i].image = ch->imagesGL[i];
 			}
 			// DEBUG: Log the texture IDs being returned AND verify content still matches
 			Logf("[OXRWXR] xrEnumerateSwapchainImages(OpenGL): sc=%p texIDs=[%u,%u,%u]",
@@ -2217,11 +3483,11 @@ static XrResult XRAPI_PTR xrEnumerateSwapchainImages_runtime(XrSwapchain sc, uin
 		return XR_SUCCESS;
 	}
 	else {
-		const uint32_t n = (uint32_t)it->second.images.size();
+		const uint32_t n = (uint32_t)ch->images.size();
 		if (count) *count = n;
 		if (capacity >= n && images) {
 			auto* arr = reinterpret_cast<XrSwapchainImageD3D11KHR*>(images);
-			for (uint32_t i = 0; i < n; ++i) { arr[i].type = XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR; arr[i].texture = it->second.images[i].Get(); }
+			for (uint32_t i = 0; i < n; ++i) { arr[i].type = XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR; arr[i].texture = ch->images[i].Get(); }
 		}
 		Logf("[OXRWXR] xrEnumerateSwapchainImages(D3D11): sc=%p count=%u", sc, n);
 		return XR_SUCCESS;
@@ -2229,8 +3495,8 @@ static XrResult XRAPI_PTR xrEnumerateSwapchainImages_runtime(XrSwapchain sc, uin
 }
 
 static XrResult XRAPI_PTR xrAcquireSwapchainImage_runtime(XrSwapchain sc, const XrSwapchainImageAcquireInfo*, uint32_t* index) {
-	auto it = rt::g_swapchains.find(sc); if (it == rt::g_swapchains.end()) return XR_ERROR_HANDLE_INVALID;
-	auto& ch = it->second;
+	rt::Swapchain* chain = rt::g_swapchains.Get(sc); if (!chain) return XR_ERROR_HANDLE_INVALID;
+	auto& ch = *chain;
 	uint32_t i = ch.nextIndex;
 	ch.nextIndex = (ch.nextIndex + 1) % ch.imageCount;
 	ch.lastAcquired = i;  // Track what we just gave to the app
@@ -2245,11 +3511,12 @@ static XrResult XRAPI_PTR xrAcquireSwapchainImage_runtime(XrSwapchain sc, const
 }
 static XrResult XRAPI_PTR xrWaitSwapchainImage_runtime(XrSwapchain, const XrSwapchainImageWaitInfo*) { return XR_SUCCESS; }
 static XrResult XRAPI_PTR xrReleaseSwapchainImage_runtime(XrSwapchain sc, const XrSwapchainImageReleaseInfo*) {
-	auto it = rt::g_swapchains.find(sc);
-	if (it == rt::g_swapchains.end()) return XR_ERROR_HANDLE_INVALID;
-	auto& ch = it->second;
+	rt::Swapchain* chain = rt::g_swapchains.Get(sc);
+	if (!chain) return XR_ERROR_HANDLE_INVALID;
+	auto& ch = *chain;
 	// The app just released the image it acquired earlier
 	ch.lastReleased = ch.lastAcquired;
+	++ch.releaseGeneration;
 
 	static int releaseCount = 0;
 	bool shouldLog = (++releaseCount <= 10);
@@ -2387,6 +3654,8 @@ struct D3D11StateBackup {
 		ctx_->PSGetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, ps_srvs);
 		vs_num_class_instances = 256;  // Initialize to array capacity
 		ctx_->VSGetShader(&vs_shader, vs_class_instances, &vs_num_class_instances);
+		ctx_->VSGetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, vs_constant_buffers);
+		ctx_->VSGetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, vs_srvs);
 	}
 
 	~D3D11StateBackup() {
@@ -2403,6 +3672,8 @@ struct D3D11StateBackup {
 		ctx_->PSSetSamplers(0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, ps_samplers);
 		ctx_->PSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, ps_srvs);
 		ctx_->VSSetShader(vs_shader, vs_class_instances, vs_num_class_instances);
+		ctx_->VSSetConstantBuffers(0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, vs_constant_buffers);
+		ctx_->VSSetShaderResources(0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, vs_srvs);
 
 		// Release COM references
 		if (ia_input_layout) ia_input_layout->Release();
@@ -2417,6 +3688,8 @@ struct D3D11StateBackup {
 		for (UINT i = 0; i < D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT; ++i) if (ps_srvs[i]) ps_srvs[i]->Release();
 		if (vs_shader) vs_shader->Release();
 		for (UINT i = 0; i < vs_num_class_instances; ++i) if (vs_class_instances[i]) vs_class_instances[i]->Release();
+		for (UINT i = 0; i < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; ++i) if (vs_constant_buffers[i]) vs_constant_buffers[i]->Release();
+		for (UINT i = 0; i < D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT; ++i) if (vs_srvs[i]) vs_srvs[i]->Release();
 	}
 
 private:
@@ -2447,35 +3720,143 @@ private:
 	ID3D11VertexShader* vs_shader = nullptr;
 	ID3D11ClassInstance* vs_class_instances[256] = { nullptr };
 	UINT vs_num_class_instances = 0;
+	ID3D11Buffer* vs_constant_buffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT] = { nullptr };
+	ID3D11ShaderResourceView* vs_srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = { nullptr };
 };
 
-namespace rt {
-	static XrSessionState g_state = XR_SESSION_STATE_IDLE;
-	static std::vector<XrEventDataBuffer> g_eventQueue;
-	void PushState(XrSession s, XrSessionState ns) {
-		g_state = ns;
-		g_session.state = ns;
-		const char* stateName = "UNKNOWN";
-		switch (ns) {
-		case XR_SESSION_STATE_IDLE: stateName = "IDLE"; break;
-		case XR_SESSION_STATE_READY: stateName = "READY"; break;
-		case XR_SESSION_STATE_SYNCHRONIZED: stateName = "SYNCHRONIZED"; break;
-		case XR_SESSION_STATE_VISIBLE: stateName = "VISIBLE"; break;
-		case XR_SESSION_STATE_FOCUSED: stateName = "FOCUSED"; break;
-		case XR_SESSION_STATE_STOPPING: stateName = "STOPPING"; break;
-		case XR_SESSION_STATE_LOSS_PENDING: stateName = "LOSS_PENDING"; break;
-		case XR_SESSION_STATE_EXITING: stateName = "EXITING"; break;
+namespace rt {
+	static XrSessionState g_state = XR_SESSION_STATE_IDLE;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Pushed from the app thread and from WndProc; compact records, expanded only when xrPollEvent hands them out
+	static events::Ring<64> g_eventQueue;
+	void PushState(XrSession s, XrSessionState ns) {
+		g_state = ns;
+		g_session.state = ns;
+		const char* stateName = "UNKNOWN";
+		switch (ns) {
+		case XR_SESSION_STATE_IDLE: stateName = "IDLE"; break;
+		case XR_SESSION_STATE_READY: stateName = "READY"; break;
+		case XR_SESSION_STATE_SYNCHRONIZED: stateName = "SYNCHRONIZED"; break;
+		case XR_SESSION_STATE_VISIBLE: stateName = "VISIBLE"; break;
+		case XR_SESSION_STATE_FOCUSED: stateName = "FOCUSED"; break;
+		case XR_SESSION_STATE_STOPPING: stateName = "STOPPING"; break;
+		case XR_SESSION_STATE_LOSS_PENDING: stateName = "LOSS_PENDING"; break;
+		case XR_SESSION_STATE_EXITING: stateName = "EXITING"; break;
+		}
+		if (verboseLogging) Logf("[OXRWXR] PushState: Session %llu -> %s", (unsigned long long)s, stateName);
+
+		if (!g_eventQueue.Push(events::SessionStateChanged(s, ns, QpcNowNs()))) {
+			Logf("[OXRWXR] PushState: event queue full, %s dropped", stateName);
+		}
+		if (verboseLogging) Logf("[OXRWXR] Event queue now has %zu events", g_eventQueue.Size());
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// XR_KHR_visibility_mask: meshes come from the headset's lens profile and are regenerated only when the FOV moves
+	static vismask::Cache g_visibilityMasks;
+	static XrFovf g_visibilityMaskFov{};
+	static bool g_visibilityMaskFovSet = false;
+
+	static bool VisibilityMaskEnabled() {
+		const auto& exts = g_instance.enabledExtensions;
+		return std::find(exts.begin(), exts.end(), XR_KHR_VISIBILITY_MASK_EXTENSION_NAME) != exts.end();
+	}
+
+	// Called once per frame after the UDP feed updates the FOV; small jitter in the feed doesn't count as a change
+	static void CheckVisibilityMaskFov() {
+		if (!VisibilityMaskEnabled() || g_session.handle == XR_NULL_HANDLE) return;
+		XrFovf fov = ViewFov();
+		if (!g_visibilityMaskFovSet) {
+			g_visibilityMaskFov = fov;
+			g_visibilityMaskFovSet = true;
+			return;
+		}
+		const float kThreshold = 0.005f;  // ~0.3 degrees
+		if (std::fabs(fov.angleRight - g_visibilityMaskFov.angleRight) < kThreshold &&
+			std::fabs(fov.angleUp - g_visibilityMaskFov.angleUp) < kThreshold) return;
+		g_visibilityMaskFov = fov;
+
+		const uint32_t viewCount = ViewCountFor(g_session.viewConfiguration);
+		for (uint32_t i = 0; i < viewCount; ++i) {
+			g_eventQueue.Push(events::VisibilityMaskChanged(g_session.handle, g_session.viewConfiguration, i));
+		}
+		if (verboseLogging) Logf("[OXRWXR] Visibility mask changed: FOV %.3f x %.3f", fov.angleRight * 2.0f, fov.angleUp * 2.0f);
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// XR_EXT_hand_tracking: each hand's joints in its controller's frame, refreshed by xrWaitFrame. Hands the headset
+	// tracks come from the UDP feed; otherwise the model hand is posed from the trigger, grip and touch state.
+	struct HandTrackerRecord {
+		XrHandEXT hand{ XR_HAND_LEFT_EXT };
+	};
+	static handles::Table<HandTrackerRecord, handles::HandleType::HandTracker, XrHandTrackerEXT> g_handTrackers;
+
+	struct HandJoints {
+		handjoints::Skeleton local;
+		bool fromHeadset{ false };
+	};
+	static HandJoints g_handJoints[2];  // Left, right
+	static std::mutex g_handJointsMutex;
+
+	static bool HandTrackingEnabled() {
+		const auto& exts = g_instance.enabledExtensions;
+		return std::find(exts.begin(), exts.end(), XR_EXT_HAND_TRACKING_EXTENSION_NAME) != exts.end();
+	}
+
+	static handjoints::Curls FingerCurls(const ControllerState& ctrl) {
+		handjoints::Curls c;
+		c.index = std::max(ctrl.triggerValue, ctrl.triggerTouched ? 0.25f : 0.0f);
+		c.middle = c.ring = c.little = ctrl.gripValue;
+		if (ctrl.primaryPressed || ctrl.secondaryPressed || ctrl.thumbstickPressed) c.thumb = 1.0f;
+		else if (ctrl.primaryTouched || ctrl.secondaryTouched || ctrl.thumbstickTouched || ctrl.thumbrestTouched) c.thumb = 0.6f;
+		return c;
+	}
+
+	static void UpdateHandJoints(const udppkt::Packet& packet) {
+		if (!HandTrackingEnabled()) return;
+		std::lock_guard<std::mutex> lock(g_handJointsMutex);
+		for (int h = 0; h < 2; ++h) {
+			HandJoints& joints = g_handJoints[h];
+			joints.fromHeadset = packet.hasHand[h];
+			if (joints.fromHeadset) joints.local = packet.hands[h];
+			else handjoints::Synthesize(h == 1, FingerCurls(h == 1 ? g_rightController : g_leftController), joints.local);
 		}
-		if (verboseLogging) Logf("[OXRWXR] PushState: Session %llu -> %s", (unsigned long long)s, stateName);
+	}
 
-		XrEventDataSessionStateChanged e{ XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED };
-		e.session = s; e.state = ns; e.time = 0;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Haptics: xrApplyHapticFeedback / xrStopHapticFeedback only update the scheduler and xrWaitFrame flushes it,
+	// so the headset gets at most one message per frame, and only when a hand's vibration changed
+	static haptics::Scheduler g_haptics;
+	static std::mutex g_hapticsMutex;
+
+	static void FlushHaptics() {
+		haptics::Output out[haptics::kHandCount];
+		bool changed[haptics::kHandCount];
+		{
+			std::lock_guard<std::mutex> lock(g_hapticsMutex);
+			if (!g_haptics.Flush(QpcNowNs(), out, changed)) return;
+		}
+		if (!udpReader) return;
 
-		XrEventDataBuffer buf{};
-		buf.type = XR_TYPE_EVENT_DATA_BUFFER;  // Set the base type
-		std::memcpy(&buf, &e, sizeof(e));
-		g_eventQueue.push_back(buf);
-		if (verboseLogging) Logf("[OXRWXR] Event queue now has %zu events", g_eventQueue.size());
+		// The leading on/off pair is what older WinlatorXR builds read; amplitude, duration (ms, -1 until stopped) and
+		// frequency per hand follow
+		auto durationMs = [](const haptics::Output& o) {
+			return o.remainingNs == haptics::kInfiniteNs ? -1ll : (long long)(o.remainingNs / 1000000);
+			};
+		char tail[96];
+		snprintf(tail, sizeof(tail), " %.2f %lld %.0f %.2f %lld %.0f",
+			out[0].amplitude, durationMs(out[0]), out[0].frequency,
+			out[1].amplitude, durationMs(out[1]), out[1].frequency);
+		udpReader->SendData(std::string(out[0].active ? "1 " : "0 ") + (out[1].active ? "1" : "0") + " 1 " + aerMode + " " +
+			std::to_string(fovVarE) + " " + std::to_string(fovVarF) + tail);
 	}
 }
 static XrResult XRAPI_PTR xrPollEvent_runtime(XrInstance, XrEventDataBuffer* b) {
@@ -2483,18 +3864,16 @@ static XrResult XRAPI_PTR xrPollEvent_runtime(XrInstance, XrEventDataBuffer* b)
 	pollCount++;
 
 	if (pollCount <= 5 && verboseLogging) {  // Log first few polls
-		Logf("[OXRWXR] xrPollEvent called (#%d), queue size=%zu", pollCount, rt::g_eventQueue.size());
+		Logf("[OXRWXR] xrPollEvent called (#%d), queue size=%zu", pollCount, rt::g_eventQueue.Size());
 	}
 
 	if (!b) return XR_ERROR_VALIDATION_FAILURE;
-	if (rt::g_eventQueue.empty()) {
+	if (!rt::g_eventQueue.Deliver(*b)) {
 		if (pollCount <= 5) {
 			Log("[OXRWXR] xrPollEvent: No events available (XR_EVENT_UNAVAILABLE)");
 		}
 		return XR_EVENT_UNAVAILABLE;
 	}
-	*b = rt::g_eventQueue.front();
-	rt::g_eventQueue.erase(rt::g_eventQueue.begin());
 
 	// Log what event we're delivering
 	const XrEventDataBaseHeader* header = reinterpret_cast<const XrEventDataBaseHeader*>(b);
@@ -2512,18 +3891,25 @@ static XrResult XRAPI_PTR xrPollEvent_runtime(XrInstance, XrEventDataBuffer* b)
 		case XR_SESSION_STATE_EXITING: stateName = "EXITING"; break;
 		}
 		if (verboseLogging) Logf("[OXRWXR] xrPollEvent: Delivering SESSION_STATE_CHANGED -> %s (session=%llu, %zu events left)",
-			stateName, (unsigned long long)stateEvent->session, rt::g_eventQueue.size());
+			stateName, (unsigned long long)stateEvent->session, rt::g_eventQueue.Size());
+	}
+	else if (header->type == XR_TYPE_EVENT_DATA_EVENTS_LOST) {
+		Logf("[OXRWXR] xrPollEvent: %u events lost to a full queue", reinterpret_cast<const XrEventDataEventsLost*>(b)->lostEventCount);
 	}
 	else {
-		if (verboseLogging) Logf("[OXRWXR] xrPollEvent: Delivering event type %d (%zu events left)", header->type, rt::g_eventQueue.size());
+		if (verboseLogging) Logf("[OXRWXR] xrPollEvent: Delivering event type %d (%zu events left)", header->type, rt::g_eventQueue.Size());
 	}
 	return XR_SUCCESS;
 }
-static XrResult XRAPI_PTR xrBeginSession_runtime(XrSession s, const XrSessionBeginInfo*) {
+static XrResult XRAPI_PTR xrBeginSession_runtime(XrSession s, const XrSessionBeginInfo* info) {
+	if (info && rt::ViewCountFor(info->primaryViewConfigurationType) == 0) return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+	if (info) rt::g_session.viewConfiguration = info->primaryViewConfigurationType;
 	Log("[OXRWXR] ============================================");
-	Logf("[OXRWXR] xrBeginSession called (session=%llu)", (unsigned long long)s);
+	Logf("[OXRWXR] xrBeginSession called (session=%llu, views=%u)", (unsigned long long)s,
+		rt::ViewCountFor(rt::g_session.viewConfiguration));
 	Log("[OXRWXR] Session started - moving to SYNCHRONIZED/VISIBLE states");
 	Log("[OXRWXR] ============================================");
+	rt::ResetDynamicResolution();
 	rt::PushState(s, XR_SESSION_STATE_SYNCHRONIZED);
 	rt::PushState(s, XR_SESSION_STATE_VISIBLE);
 	// Only push FOCUSED if window is actually active/focused
@@ -2534,6 +3920,8 @@ static XrResult XRAPI_PTR xrBeginSession_runtime(XrSession s, const XrSessionBeg
 }
 static XrResult XRAPI_PTR xrEndSession_runtime(XrSession s) { Log("[OXRWXR] xrEndSession"); rt::PushState(s, XR_SESSION_STATE_STOPPING); rt::PushState(s, XR_SESSION_STATE_IDLE); return XR_SUCCESS; }
 static XrResult XRAPI_PTR xrRequestExitSession_runtime(XrSession s) { rt::PushState(s, XR_SESSION_STATE_EXITING); return XR_SUCCESS; }
+static void PresentSynthesizedFrame();
+
 static XrResult XRAPI_PTR xrWaitFrame_runtime(XrSession, const XrFrameWaitInfo*, XrFrameState* s) {
 	if (!s) return XR_ERROR_VALIDATION_FAILURE;
 	// Message pump so the preview window stays responsive
@@ -2543,56 +3931,59 @@ static XrResult XRAPI_PTR xrWaitFrame_runtime(XrSession, const XrFrameWaitInfo*,
 	static long long periodNs = (long long)(periodSec * 1e9);
 	static double nextTick = []() { LARGE_INTEGER t; QueryPerformanceCounter(&t); return (double)t.QuadPart; }();
 
+	auto waitForNextTick = [&]() {
+		for (;;) {
+			LARGE_INTEGER now; QueryPerformanceCounter(&now);
+			double dt = (nextTick - (double)now.QuadPart) / (double)freq.QuadPart;
+			if (dt <= 0.0) break;
+			double ms = dt * 1000.0;
+			if (ms > 5.0) ms = 5.0;
+			if (ms < 0.0) ms = 0.0;
+			Sleep((DWORD)ms);
+		}
+		nextTick += periodSec * (double)freq.QuadPart;
+		};
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Half-rate mode: the app only gets every other display tick. The tick in between shows the last
+	// submitted frame warped to the pose at that time, before the new pose is handed to the app below.
+	if (bEnableHalfRate) {
+		waitForNextTick();
+		PresentSynthesizedFrame();
+	}
+
 	//----------------
 	//OXRWXR CHANGE:
 	//---------------- 
 	// Now we pass 6DOF data always
 	std::string txt = udpReader->GetRetData();
 
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Low-latency preview: claim the next preview buffer here, after the pose wait, rather than in Present
+	rt::PollPreviewLatency(rt::g_session);
+
 	//Example return data:
 	//client0 0.213 0.287 -0.933 0.035 0.0 0.0 -0.008 -0.229 -0.173 0.095 -0.296 0.947 -0.077 0.0 0.0 0.154 -0.240 -0.140 0.146 -0.072 0.048 0.985 0.037 0.006 -0.017 0.0678 99.00 103.40 224 TFFFFFFFFFTTTFFFFFT
 
-	std::istringstream iss(txt);
-	std::string client;
-	std::vector<float> floats(28);
-	int openXRFrameID;
-	std::string buttonString;
-
-	std::locale c_locale("C");
-	iss.imbue(c_locale);
-
-	// Parse client string
-	iss >> client;
-
-	// Parse float values
-	for (auto& f : floats) {
-		iss >> f;
-	}
-
-	// Parse integer value and last string
-	iss >> openXRFrameID >> buttonString; //>> hmdString;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Fixed-layout parse; optional analog and touch sections follow the buttons (see udp_packet.h)
+	udppkt::Packet packet;
+	udppkt::Parse(txt, packet);
+	const float* floats = packet.floats;
+	const bool* buttonBools = packet.buttons;
 
-	OpenXRFrameID = openXRFrameID;
+	OpenXRFrameID = packet.frameID;
 
 	udpReader->LastOpenXRFrameID = OpenXRFrameID;
 
 	//Logf("UDP string: %s", txt.c_str());
 
-	std::vector<bool> buttonBools;
-
-	if (buttonString.empty()) {
-		buttonString = "FFFFFFFFFFFFFFFFFFF";
-	}
-
-	for (char c : buttonString) {
-		if (c == 'F') {
-			buttonBools.push_back(false);
-		}
-		else if (c == 'T') {
-			buttonBools.push_back(true);
-		}
-	}
-
 	//FLOATS:
 	//Left Hand Quaternion X, Left Hand Quaternion Y, Left Hand Quaternion Z, Left Hand Quaternion W, Left Hand Thumbstick X, Left Hand Thumbstick Y, 
 	//Left Hand X Position, Left Hand Y Position, Left Hand Z Position,
@@ -2677,28 +4068,35 @@ static XrResult XRAPI_PTR xrWaitFrame_runtime(XrSession, const XrFrameWaitInfo*,
 
 	rt::g_headPos = HMDPos;
 
-	float deltaTime = (float)periodSec;
+	// Poses are sampled once per app frame, which spans two display periods in half-rate mode (the same period
+	// the app is given as predictedDisplayPeriod below)
+	float deltaTime = (float)(bEnableHalfRate ? periodSec * 2.0 : periodSec);
 
-	rt::g_rightController.triggerPressed = RTrigger;
-	rt::g_rightController.triggerValue = rt::g_rightController.triggerPressed ? 1.0f : 0.0f;
-	rt::g_rightController.gripPressed = RGrip;
-	rt::g_rightController.gripValue = rt::g_rightController.gripPressed ? 1.0f : 0.0f;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Button channels follow the button string layout table
+	for (size_t i = 0; i < profiles::kButtonCount; ++i) {
+		const profiles::ButtonSlot& slot = profiles::kButtonString[i];
+		rt::ControllerState& ctrl = slot.hand == bindings::kHandLeft ? rt::g_leftController : rt::g_rightController;
+		rt::SetButton(ctrl, slot.input, buttonBools[i]);
+	}
 	rt::g_rightController.menuPressed = (RGrip && L_Menu); //Right grip + L Menu to trigger the OpenXR menu
-	rt::g_rightController.primaryPressed = R_A;
-	rt::g_rightController.secondaryPressed = R_B;
-	rt::g_rightController.thumbstickPressed = RClick;
-
-	rt::g_leftController.triggerPressed = LTrigger;
-	rt::g_leftController.triggerValue = rt::g_leftController.triggerPressed ? 1.0f : 0.0f;
-	rt::g_leftController.gripPressed = LGrip;
-	rt::g_leftController.gripValue = rt::g_leftController.gripPressed ? 1.0f : 0.0f;
-	rt::g_leftController.menuPressed = L_Menu;
-	rt::g_leftController.primaryPressed = L_X;
-	rt::g_leftController.secondaryPressed = L_Y;
-	rt::g_leftController.thumbstickPressed = LClick;
+
+	// Senders with analog triggers and grips replace the 0/1 values derived from the buttons
+	if (packet.hasAnalog) {
+		rt::g_leftController.triggerValue = packet.analog[udppkt::kAnalogLeftTrigger];
+		rt::g_leftController.gripValue = packet.analog[udppkt::kAnalogLeftGrip];
+		rt::g_rightController.triggerValue = packet.analog[udppkt::kAnalogRightTrigger];
+		rt::g_rightController.gripValue = packet.analog[udppkt::kAnalogRightGrip];
+	}
 
 	rt::g_rightController.thumbstick = RThumbstick;
 	rt::g_leftController.thumbstick = LThumbstick;
+	rt::SetTouch(rt::g_leftController, packet, false);
+	rt::SetTouch(rt::g_rightController, packet, true);
+	rt::PublishInputSnapshot();
+	rt::UpdateHandJoints(packet);
 
 	// ========================================
 	// Velocity Tracking for Motion Controls
@@ -2758,25 +4156,34 @@ static XrResult XRAPI_PTR xrWaitFrame_runtime(XrSession, const XrFrameWaitInfo*,
 	}*/
 	//}
 
-	for (;;) {
-		LARGE_INTEGER now; QueryPerformanceCounter(&now);
-		double dt = (nextTick - (double)now.QuadPart) / (double)freq.QuadPart;
-		if (dt <= 0.0) break;
-		double ms = dt * 1000.0;
-		if (ms > 5.0) ms = 5.0;
-		if (ms < 0.0) ms = 0.0;
-		Sleep((DWORD)ms);
-	}
-	nextTick += periodSec * (double)freq.QuadPart;
+	waitForNextTick();
 	LARGE_INTEGER now; QueryPerformanceCounter(&now);
 	// Convert QPC to nanoseconds using double to avoid overflow on MSVC
 	XrTime nowTime = (XrTime)((double)now.QuadPart * 1000000000.0 / (double)freq.QuadPart);
-	s->type = XR_TYPE_FRAME_STATE; s->shouldRender = XR_TRUE; s->predictedDisplayPeriod = periodNs; s->predictedDisplayTime = nowTime + periodNs;
+	// In half-rate mode each app frame covers two display periods. The frame is first shown at the tick after
+	// this one (the synthesized copy follows a period later); taking that from the tick schedule rather than
+	// the wake-up time keeps consecutive display times exactly predictedDisplayPeriod apart.
+	long long framePeriodNs = bEnableHalfRate ? periodNs * 2 : periodNs;
+	XrTime displayTime = (XrTime)(nextTick * 1000000000.0 / (double)freq.QuadPart);
+	if (displayTime <= nowTime) displayTime = nowTime + periodNs;  // Running behind the schedule
+	s->type = XR_TYPE_FRAME_STATE; s->shouldRender = XR_TRUE; s->predictedDisplayPeriod = framePeriodNs; s->predictedDisplayTime = displayTime;
+	if (bEnableAltEyeRendering) rt::LatchAerParity(s->predictedDisplayTime);
+	rt::CheckVisibilityMaskFov();
+	rt::FlushHaptics();
+	if (bDynamicResolution) rt::NoteFrameStart(s->predictedDisplayTime, nowTime, framePeriodNs);
 	return XR_SUCCESS;
 }
 static XrResult XRAPI_PTR xrBeginFrame_runtime(XrSession, const XrFrameBeginInfo*) { return XR_SUCCESS; }
 
-static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FORMAT format) {
+static void ensurePreviewSized(rt::Session& s, UINT windowWidth, UINT windowHeight, DXGI_FORMAT format) {
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Preview policy: the backbuffer can be smaller than the window, DXGI stretches it on present
+	const UINT scale = (UINT)std::clamp(ui::g_uiState.previewScalePercent, 10, 100);
+	const UINT width = std::max(1u, windowWidth * scale / 100);
+	const UINT height = std::max(1u, windowHeight * scale / 100);
+
 	if (!s.usesD3D12) {
 		if (s.previewSwapchain && s.previewWidth == width && s.previewHeight == height && s.previewFormat == format) return;
 	}
@@ -2786,6 +4193,8 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 
 	// IMPORTANT: Release ALL swapchain references before creating a new one
 	// DXGI only allows one swapchain per window
+	rt::ResetPreviewViews(s);
+	rt::ClosePreviewLatencyWaitable(s);
 	s.previewSwapchain.Reset();
 	rt::ResetD3D12PreviewResources(s);
 	{
@@ -2828,6 +4237,7 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 					s.previewWidth = rt::g_persistentWidth;
 					s.previewHeight = rt::g_persistentHeight;
 					s.previewFormat = format;
+					rt::AttachPreviewLatency(s, s.previewSwapchain.Get());
 					Log("[OXRWXR] Reusing existing window AND swapchain from previous session");
 					return;  // Everything is already set up
 				}
@@ -2842,7 +4252,7 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 				ui::ApplyDarkTheme(s.hwnd);
 
 				// Just resize the existing window if needed
-				RECT rc = { 0, 0, (LONG)width, (LONG)height };
+				RECT rc = { 0, 0, (LONG)windowWidth, (LONG)windowHeight };
 				AdjustWindowRect(&rc, WS_OVERLAPPEDWINDOW, FALSE);
 				SetWindowPos(s.hwnd, nullptr, 0, 0, rc.right - rc.left, rc.bottom - rc.top, SWP_NOMOVE | SWP_NOZORDER | SWP_SHOWWINDOW);
 
@@ -2854,7 +4264,7 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 
 		// Create new window if we don't have one
 		if (!s.hwnd) {
-			RECT rc = { 0, 0, (LONG)width, (LONG)height };
+			RECT rc = { 0, 0, (LONG)windowWidth, (LONG)windowHeight };
 			AdjustWindowRect(&rc, WS_OVERLAPPEDWINDOW, FALSE);
 			s.hwnd = CreateWindowExW(0, L"OpenXR WXR", L"OpenXR WXR (Mouse Look + WASD)", WS_OVERLAPPEDWINDOW,
 				100, 100, rc.right - rc.left, rc.bottom - rc.top, nullptr, nullptr, GetModuleHandleW(nullptr), nullptr);
@@ -2866,12 +4276,12 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 			UpdateWindow(s.hwnd);
 			SetForegroundWindow(s.hwnd);
 			SetWindowPos(s.hwnd, HWND_TOP, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_SHOWWINDOW);
-			if (verboseLogging) Logf("[OXRWXR] Created new preview window: hwnd=%p size=%ux%u", s.hwnd, width, height);
+			if (verboseLogging) Logf("[OXRWXR] Created new preview window: hwnd=%p size=%ux%u", s.hwnd, windowWidth, windowHeight);
 
 			// Apply dark theme and menu
 			ui::ApplyDarkTheme(s.hwnd);
-			ui::g_uiState.windowWidth = width;
-			ui::g_uiState.windowHeight = height;
+			ui::g_uiState.windowWidth = windowWidth;
+			ui::g_uiState.windowHeight = windowHeight;
 
 
 
@@ -2919,10 +4329,10 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 	}
 	else {
 		// Resize existing window
-		RECT rc = { 0, 0, (LONG)width, (LONG)height };
+		RECT rc = { 0, 0, (LONG)windowWidth, (LONG)windowHeight };
 		AdjustWindowRect(&rc, WS_OVERLAPPEDWINDOW, FALSE);
 		SetWindowPos(s.hwnd, nullptr, 0, 0, rc.right - rc.left, rc.bottom - rc.top, SWP_NOMOVE | SWP_NOZORDER | SWP_SHOWWINDOW);
-		Logf("[OXRWXR] Resized preview window: hwnd=%p size=%ux%u", s.hwnd, width, height);
+		Logf("[OXRWXR] Resized preview window: hwnd=%p size=%ux%u (backbuffer %ux%u)", s.hwnd, windowWidth, windowHeight, width, height);
 	}
 	if (!s.usesD3D12) {
 		ComPtr<IDXGIDevice> dxgiDev; s.d3d11Device.As(&dxgiDev);
@@ -2936,11 +4346,13 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 		desc.BufferCount = 2;
 		desc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
 		desc.SampleDesc.Count = 1;
+		desc.Flags = rt::PreviewSwapchainFlags(factory.Get());
 		HRESULT hr = factory->CreateSwapChainForHwnd(s.d3d11Device.Get(), s.hwnd, &desc, nullptr, nullptr, s.previewSwapchain.GetAddressOf());
 		if (verboseLogging) Logf("[OXRWXR] ensurePreviewSized(DX11): hr=0x%08X swapchain=%p format=%d", (unsigned)hr, s.previewSwapchain.Get(), format);
 		if (FAILED(hr)) {
 			Logf("[OXRWXR] ERROR: Failed to create DX11 preview swapchain with format %d", format);
 		}
+		rt::AttachPreviewLatency(s, s.previewSwapchain.Get());
 		return;
 	}
 	else {
@@ -2956,8 +4368,9 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 		desc.Format = format;
 		desc.SampleDesc.Count = 1;
 		desc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-		desc.BufferCount = 2;
+		desc.BufferCount = (UINT)std::max(2, iD3D12FramesInFlight + 1);
 		desc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+		desc.Flags = rt::PreviewSwapchainFlags(factory.Get());
 		ComPtr<IDXGISwapChain1> sc1;
 		HRESULT hr = factory->CreateSwapChainForHwnd(s.d3d12Queue.Get(), s.hwnd, &desc, nullptr, nullptr, sc1.GetAddressOf());
 		if (FAILED(hr)) {
@@ -2965,6 +4378,7 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 			return;
 		}
 		sc1.As(&s.previewSwapchain12);
+		rt::AttachPreviewLatency(s, sc1.Get());
 		s.previewBackbufferCount = desc.BufferCount;
 		s.previewBackbuffers.clear();
 		s.previewBackbuffers.resize(desc.BufferCount);
@@ -2983,22 +4397,598 @@ static void ensurePreviewSized(rt::Session& s, UINT width, UINT height, DXGI_FOR
 			s.d3d12Device->CreateRenderTargetView(s.previewBackbuffers[i].Get(), nullptr, rtvHandle);
 			rtvHandle.ptr += s.previewRTVDescriptorSize;
 		}
-		// Command allocator/list
-		s.d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(s.previewCmdAlloc.GetAddressOf()));
-		s.d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, s.previewCmdAlloc.Get(), nullptr, IID_PPV_ARGS(s.previewCmdList.GetAddressOf()));
+		// Command allocator per backbuffer, one shared list
+		s.previewCmdAllocs.resize(desc.BufferCount);
+		s.previewAllocFenceValues.assign(desc.BufferCount, 0);
+		for (UINT i = 0; i < desc.BufferCount; ++i) {
+			if (FAILED(s.d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(s.previewCmdAllocs[i].GetAddressOf())))) {
+				Logf("[OXRWXR] DX12 preview: CreateCommandAllocator %u failed", i); return;
+			}
+		}
+		s.d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, s.previewCmdAllocs[0].Get(), nullptr, IID_PPV_ARGS(s.previewCmdList.GetAddressOf()));
 		s.previewCmdList->Close();
 		// Fence
 		s.d3d12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(s.previewFence.GetAddressOf()));
 		s.previewFenceValue = 1;
 		s.previewFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-		Log("[OXRWXR] DX12 preview swapchain initialized");
+		Logf("[OXRWXR] DX12 preview swapchain initialized (%u buffers, %d frames in flight)", desc.BufferCount, iD3D12FramesInFlight);
 		return;
 	}
 }
 
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Depth-aware reprojection (XR_KHR_composition_layer_depth)
+// Latest head pose from WinlatorXR, which may be newer than the one the app rendered with
+static bool ReadLatestHeadPose(XrPosef& head, float& ipd, int& frameID) {
+	if (!udpReader) return false;
+
+	std::string txt = udpReader->GetRetData();
+	udppkt::Packet packet;
+	if (!udppkt::Parse(txt, packet)) return false;
+	const float* floats = packet.floats;
+	frameID = packet.frameID;
+
+	head.orientation = { floats[18], floats[19], floats[20], floats[21] };
+	head.position = { floats[22], floats[23], floats[24] };
+	ipd = floats[25];
+	return true;
+}
+
+static const XrCompositionLayerDepthInfoKHR* FindDepthInfo(const XrCompositionLayerProjectionView& view) {
+	for (auto* next = reinterpret_cast<const XrBaseInStructure*>(view.next); next; next = next->next) {
+		if (next->type == XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR) {
+			return reinterpret_cast<const XrCompositionLayerDepthInfoKHR*>(next);
+		}
+	}
+	return nullptr;
+}
+
+static const XrCompositionLayerSpaceWarpInfoFB* FindSpaceWarpInfo(const XrCompositionLayerProjectionView& view) {
+	for (auto* next = reinterpret_cast<const XrBaseInStructure*>(view.next); next; next = next->next) {
+		if (next->type == XR_TYPE_COMPOSITION_LAYER_SPACE_WARP_INFO_FB) {
+			return reinterpret_cast<const XrCompositionLayerSpaceWarpInfoFB*>(next);
+		}
+	}
+	return nullptr;
+}
+
+static bool IsValidDepthRange(float minDepth, float maxDepth, float nearZ, float farZ) {
+	return minDepth >= 0.0f && maxDepth <= 1.0f && minDepth < maxDepth && nearZ != farZ;
+}
+
+// What a view was rendered with, plus its depth sub-image (XR_KHR_composition_layer_depth, or the one
+// XR_FB_space_warp chains) when the range is usable. The target starts out as the render pose.
+static void FillEyeSource(const XrCompositionLayerProjectionView& view, rt::EyeReprojection& eye) {
+	eye.renderPose = view.pose;
+	eye.renderFov = view.fov;
+	eye.targetPose = view.pose;
+	eye.targetFov = view.fov;
+	eye.contentPose = view.pose;
+
+	// Without a (valid) depth sub-image we still correct rotation, treating the scene as distant
+	const XrCompositionLayerDepthInfoKHR* depth = FindDepthInfo(view);
+	const XrCompositionLayerSpaceWarpInfoFB* spaceWarp = FindSpaceWarpInfo(view);
+	if (depth && depth->subImage.swapchain != XR_NULL_HANDLE &&
+		IsValidDepthRange(depth->minDepth, depth->maxDepth, depth->nearZ, depth->farZ)) {
+		eye.depthSwapchain = depth->subImage.swapchain;
+		eye.depthArrayIndex = depth->subImage.imageArrayIndex;
+		eye.depthRect = depth->subImage.imageRect;
+		eye.depthRange = reproj::MakeDepthRange(depth->minDepth, depth->maxDepth, depth->nearZ, depth->farZ);
+	}
+	else if (spaceWarp && spaceWarp->depthSubImage.swapchain != XR_NULL_HANDLE &&
+		IsValidDepthRange(spaceWarp->minDepth, spaceWarp->maxDepth, spaceWarp->nearZ, spaceWarp->farZ)) {
+		eye.depthSwapchain = spaceWarp->depthSubImage.swapchain;
+		eye.depthArrayIndex = spaceWarp->depthSubImage.imageArrayIndex;
+		eye.depthRect = spaceWarp->depthSubImage.imageRect;
+		eye.depthRange = reproj::MakeDepthRange(spaceWarp->minDepth, spaceWarp->maxDepth, spaceWarp->nearZ, spaceWarp->farZ);
+	}
+}
+
+// Fills one request per view; returns false when reprojection is off or the frame is already current.
+// When it returns true the sync pixel is moved to the newer packet's frame ID.
+// Synthesized (half-rate) frames are always warped: to the newest pose if one arrived, otherwise to a
+// pose extrapolated from the last two submissions, plus half of the app's motion vectors if it sent any.
+static bool PrepareReprojection(const XrCompositionLayerProjection& proj, rt::EyeReprojection (&out)[2], bool synthesized = false) {
+	out[0] = rt::EyeReprojection{};
+	out[1] = rt::EyeReprojection{};
+	if ((!bEnableReprojection && !synthesized) || proj.viewCount < 1) return false;
+
+	XrPosef head;
+	float ipd = 0.0f;
+	int frameID = 0;
+	bool newPose = ReadLatestHeadPose(head, ipd, frameID) && frameID != OpenXRFrameID;
+	if (!newPose && !synthesized) return false;
+
+	const uint32_t viewCount = std::min(proj.viewCount, 2u);
+	bool moved = false;
+	for (uint32_t i = 0; i < viewCount; ++i) {
+		const XrCompositionLayerProjectionView& view = proj.views[i];
+		rt::EyeReprojection& eye = out[i];
+		float eyeOffset = (viewCount == 1) ? rt::MonoViewEyeOffset(ipd) : (i == 0 ? -ipd * 0.5f : ipd * 0.5f);
+
+		FillEyeSource(view, eye);
+		if (newPose) {
+			eye.targetPose = reproj::EyePoseFromHead(head, eyeOffset);
+		}
+		if (synthesized && rt::g_lastProjection.hasPrevious) {
+			// Submissions are two display periods apart, the synthesized frame is one period after the last.
+			// Block matching moves the image by the same half interval of camera motion.
+			eye.contentPose = synth::ExtrapolatePose(rt::g_lastProjection.previousPoses[i], view.pose, 1.5f);
+			if (!newPose) eye.targetPose = eye.contentPose;
+		}
+
+		const XrCompositionLayerSpaceWarpInfoFB* spaceWarp = FindSpaceWarpInfo(view);
+		if (synthesized && spaceWarp && spaceWarp->motionVectorSubImage.swapchain != XR_NULL_HANDLE &&
+			!(spaceWarp->layerFlags & XR_COMPOSITION_LAYER_SPACE_WARP_INFO_FRAME_SKIP_BIT_FB)) {
+			eye.motionSwapchain = spaceWarp->motionVectorSubImage.swapchain;
+			eye.motionArrayIndex = spaceWarp->motionVectorSubImage.imageArrayIndex;
+			eye.motionRect = spaceWarp->motionVectorSubImage.imageRect;
+			eye.motionScale = 0.5f;
+		}
+
+		moved = moved || reproj::NeedsReprojection(eye.renderPose, eye.targetPose);
+	}
+	if (!moved && !synthesized) return false;
+
+	for (uint32_t i = 0; i < viewCount; ++i) {
+		out[i].active = true;
+	}
+
+	static int reprojCount = 0;
+	if (++reprojCount % 60 == 1 && verboseLogging) {
+		Logf("[OXRWXR] Reprojecting frame %d -> %d (depth L=%d R=%d, synthesized=%d)", OpenXRFrameID, newPose ? frameID : OpenXRFrameID,
+			out[0].depthSwapchain != XR_NULL_HANDLE, out[1].depthSwapchain != XR_NULL_HANDLE, (int)synthesized);
+	}
+
+	if (newPose) {
+		OpenXRFrameID = frameID;
+		udpReader->LastOpenXRFrameID = frameID;
+	}
+	return true;
+}
+
+static bool RectCoversImage(const XrRect2Di& rect, uint32_t width, uint32_t height) {
+	return rect.offset.x == 0 && rect.offset.y == 0 &&
+		(uint32_t)rect.extent.width == width && (uint32_t)rect.extent.height == height;
+}
+
+static XrRect2Di ClampImageRect(const XrRect2Di& rect, uint32_t width, uint32_t height) {
+	XrRect2Di r = rect;
+	if (r.extent.width <= 0 || r.extent.height <= 0) {
+		r.offset = { 0, 0 };
+		r.extent = { (int32_t)width, (int32_t)height };
+	}
+	r.offset.x = std::min(std::max(r.offset.x, 0), (int32_t)width - 1);
+	r.offset.y = std::min(std::max(r.offset.y, 0), (int32_t)height - 1);
+	r.extent.width = std::min(r.extent.width, (int32_t)width - r.offset.x);
+	r.extent.height = std::min(r.extent.height, (int32_t)height - r.offset.y);
+	return r;
+}
+
+// Copies the released depth image into a shader-readable texture (depth resources can't be sampled directly)
+static ComPtr<ID3D11ShaderResourceView> CreateReprojectionDepthSRV(rt::Session& s, const rt::EyeReprojection& warp, float outRect[4]) {
+	rt::Swapchain* depthChainPtr = rt::g_swapchains.Get(warp.depthSwapchain);
+	if (!depthChainPtr) return nullptr;
+	rt::Swapchain& depthChain = *depthChainPtr;
+	uint32_t idx = depthChain.lastReleased;
+	if (idx == UINT32_MAX || idx >= depthChain.images.size() || !depthChain.images[idx]) return nullptr;
+
+	ID3D11Texture2D* depthTexture = depthChain.images[idx].Get();
+	D3D11_TEXTURE2D_DESC depthDesc;
+	depthTexture->GetDesc(&depthDesc);
+
+	DXGI_FORMAT copyFormat, srvFormat;
+	if (depthDesc.SampleDesc.Count != 1 || warp.depthArrayIndex >= depthDesc.ArraySize ||
+		!rt::GetDepthCopyFormats(depthDesc.Format, copyFormat, srvFormat)) {
+		return nullptr;
+	}
+
+	D3D11_TEXTURE2D_DESC copyDesc = {};
+	copyDesc.Width = depthDesc.Width;
+	copyDesc.Height = depthDesc.Height;
+	copyDesc.MipLevels = 1;
+	copyDesc.ArraySize = 1;
+	copyDesc.Format = copyFormat;
+	copyDesc.SampleDesc.Count = 1;
+	copyDesc.Usage = D3D11_USAGE_DEFAULT;
+	copyDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	// Copy texture and SRV are cached per depth image, like the color blit intermediates
+	blitcache::Key key;
+	key.swapchain = handles::ToBits(warp.depthSwapchain);
+	key.imageIndex = idx;
+	key.arraySlice = warp.depthArrayIndex;
+	key.width = copyDesc.Width;
+	key.height = copyDesc.Height;
+	key.format = copyFormat;
+	rt::BlitCacheEntry* entry = s.blitCache.GetOrCreate(key, [&](rt::BlitCacheEntry& e) {
+		HRESULT hr = s.d3d11Device->CreateTexture2D(&copyDesc, nullptr, e.texture.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to create depth copy texture: 0x%08X", hr);
+			return false;
+		}
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = srvFormat;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = 1;
+
+		hr = s.d3d11Device->CreateShaderResourceView(e.texture.Get(), &srvDesc, e.srv.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to create depth SRV: 0x%08X", hr);
+			return false;
+		}
+		return true;
+		});
+	if (!entry) return nullptr;
+
+	// Depth-stencil copies must cover the whole subresource
+	UINT srcSubresource = D3D11CalcSubresource(0, warp.depthArrayIndex, depthDesc.MipLevels);
+	s.d3d11Context->CopySubresourceRegion(entry->texture.Get(), 0, 0, 0, 0, depthTexture, srcSubresource, nullptr);
+	ComPtr<ID3D11ShaderResourceView> srv = entry->srv;
+
+	XrRect2Di r = ClampImageRect(warp.depthRect, depthDesc.Width, depthDesc.Height);
+	outRect[0] = (float)r.offset.x;
+	outRect[1] = (float)r.offset.y;
+	outRect[2] = (float)r.extent.width;
+	outRect[3] = (float)r.extent.height;
+	return srv;
+}
+
+// Snapshot of the released XR_FB_space_warp motion vector image (float RGBA, xy used)
+static ComPtr<ID3D11ShaderResourceView> CreateMotionVectorSRV(rt::Session& s, const rt::EyeReprojection& warp, float outRect[4]) {
+	rt::Swapchain* motionChainPtr = rt::g_swapchains.Get(warp.motionSwapchain);
+	if (!motionChainPtr) return nullptr;
+	rt::Swapchain& motionChain = *motionChainPtr;
+	uint32_t idx = motionChain.lastReleased;
+	if (idx == UINT32_MAX || idx >= motionChain.images.size() || !motionChain.images[idx]) return nullptr;
+
+	ID3D11Texture2D* motionTexture = motionChain.images[idx].Get();
+	D3D11_TEXTURE2D_DESC motionDesc;
+	motionTexture->GetDesc(&motionDesc);
+
+	DXGI_FORMAT srvFormat;
+	switch (motionDesc.Format) {
+	case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+	case DXGI_FORMAT_R16G16B16A16_FLOAT:
+		srvFormat = DXGI_FORMAT_R16G16B16A16_FLOAT; break;
+	case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+	case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		srvFormat = DXGI_FORMAT_R32G32B32A32_FLOAT; break;
+	default:
+		return nullptr;
+	}
+	if (motionDesc.SampleDesc.Count != 1 || warp.motionArrayIndex >= motionDesc.ArraySize) return nullptr;
+
+	D3D11_TEXTURE2D_DESC copyDesc = {};
+	copyDesc.Width = motionDesc.Width;
+	copyDesc.Height = motionDesc.Height;
+	copyDesc.MipLevels = 1;
+	copyDesc.ArraySize = 1;
+	copyDesc.Format = srvFormat;
+	copyDesc.SampleDesc.Count = 1;
+	copyDesc.Usage = D3D11_USAGE_DEFAULT;
+	copyDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	blitcache::Key key;
+	key.swapchain = handles::ToBits(warp.motionSwapchain);
+	key.imageIndex = idx;
+	key.arraySlice = warp.motionArrayIndex;
+	key.width = copyDesc.Width;
+	key.height = copyDesc.Height;
+	key.format = srvFormat;
+	rt::BlitCacheEntry* entry = s.blitCache.GetOrCreate(key, [&](rt::BlitCacheEntry& e) {
+		HRESULT hr = s.d3d11Device->CreateTexture2D(&copyDesc, nullptr, e.texture.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to create motion vector copy texture: 0x%08X", hr);
+			return false;
+		}
+		hr = s.d3d11Device->CreateShaderResourceView(e.texture.Get(), nullptr, e.srv.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to create motion vector SRV: 0x%08X", hr);
+			return false;
+		}
+		return true;
+		});
+	if (!entry) return nullptr;
+
+	UINT srcSubresource = D3D11CalcSubresource(0, warp.motionArrayIndex, motionDesc.MipLevels);
+	s.d3d11Context->CopySubresourceRegion(entry->texture.Get(), 0, 0, 0, 0, motionTexture, srcSubresource, nullptr);
+	ComPtr<ID3D11ShaderResourceView> srv = entry->srv;
+
+	XrRect2Di r = ClampImageRect(warp.motionRect, motionDesc.Width, motionDesc.Height);
+	outRect[0] = (float)r.offset.x;
+	outRect[1] = (float)r.offset.y;
+	outRect[2] = (float)r.extent.width;
+	outRect[3] = (float)r.extent.height;
+	return srv;
+}
+
+// The depth swapchain image for a view, if it lines up texel-for-texel with the color readback
+static const rt::Swapchain* ReadableGLDepth(const rt::EyeReprojection& warp, uint32_t width, uint32_t height) {
+	const rt::Swapchain* chain = rt::g_swapchains.Get(warp.depthSwapchain);
+	if (!chain || chain->lastReleased >= chain->imagesGL.size() || warp.depthArrayIndex >= chain->arraySize ||
+		chain->width != width || chain->height != height) {
+		return nullptr;
+	}
+	return chain;
+}
+
+// Reads one layer of a swapchain's last released image as bottom-up rows: into dst, or with dst == nullptr
+// into the PIXEL_PACK_BUFFER the caller bound. The layer is attached to a read framebuffer because
+// glGetTexImage can only return a whole array texture. The app's read framebuffer is restored.
+static bool ReadGLLayer(rt::Session& s, const rt::Swapchain& chain, uint32_t layer, GLenum attachment,
+	GLenum format, GLenum type, void* dst) {
+	if (!EnsureGLFramebufferFuncs()) return false;
+	if (!s.glReadFbo) g_glGenFramebuffers(1, &s.glReadFbo);
+
+	GLint prevRead = 0;
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prevRead);
+	g_glBindFramebuffer(GL_READ_FRAMEBUFFER, s.glReadFbo);
+	const GLuint tex = chain.imagesGL[chain.lastReleased];
+	if (chain.arraySize > 1) g_glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, attachment, tex, 0, (GLint)layer);
+	else g_glFramebufferTexture2D(GL_READ_FRAMEBUFFER, attachment, GL_TEXTURE_2D, tex, 0);
+	glReadBuffer(attachment == GL_DEPTH_ATTACHMENT ? GL_NONE : attachment);
+
+	const bool complete = g_glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+	if (complete) glReadPixels(0, 0, (GLsizei)chain.width, (GLsizei)chain.height, format, type, dst);
+
+	if (chain.arraySize > 1) g_glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, attachment, 0, 0, 0);
+	else g_glFramebufferTexture2D(GL_READ_FRAMEBUFFER, attachment, GL_TEXTURE_2D, 0, 0);
+	g_glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)prevRead);
+	return complete;
+}
+
+// ReadGLLayer straight into client memory
+static bool ReadGLLayerSync(rt::Session& s, const rt::Swapchain& chain, uint32_t layer, GLenum attachment,
+	GLenum format, GLenum type, void* dst) {
+	// A pack buffer the app left bound would turn the destination pointer into an offset
+	GLint prevPack = 0;
+	if (g_glBindBuffer) {
+		glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &prevPack);
+		g_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+	const bool ok = ReadGLLayer(s, chain, layer, attachment, format, type, dst);
+	if (g_glBindBuffer) g_glBindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)prevPack);
+	return ok;
+}
+
+// Synchronous depth for the half-rate and synchronous preview paths, top-down; nullptr without usable depth
+static const float* ReadGLDepthSync(rt::Session& s, const rt::EyeReprojection& warp, uint32_t eye, uint32_t width, uint32_t height) {
+	const rt::Swapchain* chain = ReadableGLDepth(warp, width, height);
+	if (!chain || eye > 1) return nullptr;
+	std::vector<float>& depth = s.glDepthStaging[eye];
+	depth.resize((size_t)width * height);
+	if (!ReadGLLayerSync(s, *chain, warp.depthArrayIndex, GL_DEPTH_ATTACHMENT, GL_DEPTH_COMPONENT, GL_FLOAT, depth.data())) return nullptr;
+	imgk::FlipRowsInPlace(depth.data(), (size_t)width * sizeof(float), height);
+	return depth.data();
+}
+
+// CPU reprojection for the OpenGL preview path, on top-down pixels. depth is top-down and matches the
+// pixels, or nullptr for a rotation-only warp.
+static void ReprojectGLView(const rt::EyeReprojection& warp, std::vector<uint8_t>& pixels, uint32_t width, uint32_t height,
+	const float* depth) {
+	if (!warp.active || pixels.size() < (size_t)width * height * 4) return;
+
+	static std::vector<uint8_t> warped;
+	static std::vector<float> zbuf;
+
+	warped.resize(pixels.size());
+	reproj::ReprojectImage(reinterpret_cast<const uint32_t*>(pixels.data()), depth, width, height,
+		reproj::TangentsFromFov(warp.renderFov), reproj::TangentsFromFov(warp.targetFov),
+		reproj::ComputeEyeDelta(warp.renderPose, warp.targetPose), depth ? warp.depthRange : reproj::RotationOnlyDepthRange(),
+		reinterpret_cast<uint32_t*>(warped.data()), zbuf);
+	pixels.swap(warped);
+}
+
+// Half-rate content motion for the OpenGL preview path (CPU reference kernels). Real frames only record
+// a downsampled luma image; synthesized frames move the last frame forward by half an app frame, using
+// XR_FB_space_warp motion vectors when the app provides them and block matching against the frame
+// before otherwise. Needs the app's GL context current and top-down pixels, before ReprojectGLView.
+// Returns true when block matching moved the image: that motion includes the camera's, so the pose warp
+// afterwards must start from warp.contentPose. App motion vectors carry object motion only.
+static bool SynthesizeGLView(rt::Session& s, const rt::EyeReprojection& warp, uint32_t eye, std::vector<uint8_t>& pixels,
+	uint32_t width, uint32_t height, bool synthesized) {
+	if (eye > 1 || pixels.size() < (size_t)width * height * 4) return false;
+
+	static std::vector<uint8_t> prevLuma[2], curLuma[2];
+	static uint32_t lumaWidth[2] = {}, lumaHeight[2] = {};
+	static bool hasPrev[2] = {}, hasCur[2] = {};
+	static synth::MotionField field;
+	static std::vector<float> motion;
+	static std::vector<uint8_t> moved;
+
+	const uint32_t* src = reinterpret_cast<const uint32_t*>(pixels.data());
+	if (!synthesized) {
+		uint32_t lw = 0, lh = 0;
+		prevLuma[eye].swap(curLuma[eye]);
+		hasPrev[eye] = hasCur[eye] && lumaWidth[eye] == width / synth::kLumaDownsample &&
+			lumaHeight[eye] == height / synth::kLumaDownsample;
+		synth::DownsampleLuma(src, width, height, synth::kLumaDownsample, curLuma[eye], lw, lh);
+		lumaWidth[eye] = lw;
+		lumaHeight[eye] = lh;
+		hasCur[eye] = true;
+		return false;
+	}
+
+	moved.resize(pixels.size());
+	uint32_t* dst = reinterpret_cast<uint32_t*>(moved.data());
+
+	// Motion vectors are usually at a lower resolution than the color (half size is the recommendation);
+	// the kernel samples them scaled to the color image
+	const rt::Swapchain* motionChain = rt::g_swapchains.Get(warp.motionSwapchain);
+	bool haveMotion = false;
+	if (warp.motionScale != 0.0f && motionChain && motionChain->lastReleased < motionChain->imagesGL.size() &&
+		warp.motionArrayIndex < motionChain->arraySize && motionChain->width > 0 && motionChain->height > 0) {
+		motion.resize((size_t)motionChain->width * motionChain->height * 4);
+		haveMotion = ReadGLLayerSync(s, *motionChain, warp.motionArrayIndex, GL_COLOR_ATTACHMENT0, GL_RGBA, GL_FLOAT, motion.data());
+	}
+	bool blockMatched = false;
+	if (haveMotion) {
+		imgk::FlipRowsInPlace(motion.data(), (size_t)motionChain->width * 4 * sizeof(float), motionChain->height);
+		synth::ExtrapolateWithMotionVectors(src, width, height, motion.data(), motionChain->width, motionChain->height, 4,
+			warp.motionScale, dst);
+	}
+	else if (hasPrev[eye] && hasCur[eye]) {
+		synth::EstimateMotion(prevLuma[eye].data(), curLuma[eye].data(), lumaWidth[eye], lumaHeight[eye],
+			synth::kLumaDownsample, field);
+		synth::ExtrapolateWithField(src, width, height, field, 0.5f, dst);
+		blockMatched = true;
+	}
+	else {
+		return false;
+	}
+	pixels.swap(moved);
+	return blockMatched;
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Asynchronous OpenGL preview readback through a PBO ring. All of these need the app's GL context current.
+static void DestroyGLReadback(rt::Session& s) {
+	for (auto& slot : s.glReadback) {
+		if (slot.fence) g_glDeleteSync(slot.fence);
+		if (slot.pbo[0] || slot.pbo[1]) g_glDeleteBuffers(2, slot.pbo);
+		if (slot.depthPbo[0] || slot.depthPbo[1]) g_glDeleteBuffers(2, slot.depthPbo);
+	}
+	s.glReadback.Reset();
+}
+
+// Copies a finished slot into the staging buffers, flipping to top-down rows on the way. Depth and the
+// poses the eyes were rendered with come along, so the warp starts from that frame rather than this one.
+static bool ConsumeGLReadback(rt::Session& s, rt::GLReadbackSlot& slot, GLuint64 timeoutNs) {
+	if (!slot.fence) return false;
+	GLenum waitResult = g_glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+	if (waitResult != GL_ALREADY_SIGNALED && waitResult != GL_CONDITION_SATISFIED) return false;
+	g_glDeleteSync(slot.fence);
+	slot.fence = nullptr;
+
+	const uint32_t width = s.glReadback.Width(), height = s.glReadback.Height();
+	const size_t rowSize = (size_t)width * 4;
+	for (uint32_t eye = 0; eye < 2; eye++) {
+		s.glStagedSource[eye] = slot.hasEye[eye] ? slot.source[eye] : rt::EyeReprojection{};
+		s.glStagedDepth[eye] = false;
+		if (!slot.hasEye[eye]) {
+			std::fill(s.glStaging[eye].begin(), s.glStaging[eye].end(), (uint8_t)0);
+			continue;
+		}
+		g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo[eye]);
+		const uint8_t* src = (const uint8_t*)g_glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)(rowSize * height), GL_MAP_READ_BIT);
+		if (!src) continue;
+		imgk::CopyFlipped(s.glStaging[eye].data(), rowSize, src, rowSize, rowSize, height);
+		g_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+		if (!slot.hasDepth[eye]) continue;
+		g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.depthPbo[eye]);
+		const uint8_t* depth = (const uint8_t*)g_glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)(rowSize * height), GL_MAP_READ_BIT);
+		if (!depth) continue;
+		s.glDepthStaging[eye].resize((size_t)width * height);
+		imgk::CopyFlipped(s.glDepthStaging[eye].data(), rowSize, depth, rowSize, rowSize, height);  // One float per texel
+		g_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		s.glStagedDepth[eye] = true;
+	}
+	g_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	return true;
+}
+
+// Queues this frame's readback and copies out the previous one. Returns false if the staging
+// buffers still hold an older image because the previous readback had not finished. sources says what
+// each eye was rendered with; active ones also have their depth layer queued when it is readable.
+static bool ReadbackGLEyesAsync(rt::Session& s, const GLuint tex[2], uint32_t width, uint32_t height,
+	const rt::EyeReprojection (&sources)[2]) {
+	rt::GLReadbackRing& ring = s.glReadback;
+	const size_t bytes = (size_t)width * height * 4;  // RGBA8 color, or one float of depth, per texel
+	GLint prevPack = 0;
+	glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &prevPack);
+	if (ring.Width() != width || ring.Height() != height) {
+		DestroyGLReadback(s);
+		ring.Configure(width, height);
+		for (auto& slot : ring) {
+			g_glGenBuffers(2, slot.pbo);
+			for (uint32_t eye = 0; eye < 2; eye++) {
+				g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo[eye]);
+				g_glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_READ);
+			}
+		}
+		for (uint32_t eye = 0; eye < 2; eye++) {
+			s.glStagedSource[eye] = rt::EyeReprojection{};
+			s.glStagedDepth[eye] = false;
+		}
+		if (verboseLogging) Logf("[OXRWXR] GL PREVIEW: PBO readback ring %ux%u x%u", width, height, rt::kGLReadbackSlots);
+	}
+
+	// A slot that was never consumed is simply superseded
+	bool superseded = false;
+	rt::GLReadbackSlot& slot = ring.Queue(superseded);
+	if (superseded && slot.fence) {
+		g_glDeleteSync(slot.fence);
+		slot.fence = nullptr;
+	}
+	for (uint32_t eye = 0; eye < 2; eye++) {
+		slot.hasEye[eye] = tex[eye] != 0;
+		slot.hasDepth[eye] = false;
+		slot.source[eye] = sources[eye];
+		if (!slot.hasEye[eye]) continue;
+		g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo[eye]);
+		glBindTexture(GL_TEXTURE_2D, tex[eye]);
+		glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);  // Into the PBO, returns immediately
+
+		// Depth rides along under the same fence
+		const rt::Swapchain* depthChain = sources[eye].active ? ReadableGLDepth(sources[eye], width, height) : nullptr;
+		if (!depthChain) continue;
+		if (!slot.depthPbo[eye]) {
+			g_glGenBuffers(1, &slot.depthPbo[eye]);
+			g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.depthPbo[eye]);
+			g_glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_READ);
+		}
+		g_glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.depthPbo[eye]);
+		slot.hasDepth[eye] = ReadGLLayer(s, *depthChain, sources[eye].depthArrayIndex, GL_DEPTH_ATTACHMENT,
+			GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+	}
+	slot.fence = g_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	glFlush();
+
+	// Nothing is queued on the first frame after a resize, the preview shows the staging contents once
+	bool fresh = false;
+	if (rt::GLReadbackSlot* previous = ring.Previous()) {
+		fresh = ConsumeGLReadback(s, *previous, 0);
+		if (fresh) ring.Consumed(*previous);
+		else ring.Late();
+	}
+	g_glBindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)prevPack);
+	return fresh;
+}
+
+static float SrgbToLinear(float c) {
+	return (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Red sync pixel (DX11) cleared straight into the preview at the footprint recorded by the last sync-eye blit,
+// with the value the unwarped path would have sampled from the temp texture
+static void ClearSyncBlockD3D11(rt::Session& s, ID3D11RenderTargetView* rtv) {
+	ComPtr<ID3D11DeviceContext1> context1;
+	if (!rtv || FAILED(s.d3d11Context.As(&context1))) return;
+	float red = (float)(OpenXRFrameID & 0xFF) / 255.0f;
+	float blue = (bEnableAltEyeRendering && bAltEyeRender) ? 1.0f : 0.0f;
+	const float syncColor[4] = {
+		s.previewSyncSrgbSource ? SrgbToLinear(red) : red,
+		0.0f,
+		s.previewSyncSrgbSource ? SrgbToLinear(blue) : blue,
+		1.0f
+	};
+	context1->ClearView(rtv, syncColor, &s.previewSyncRect, 1);
+}
+
 static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcIndex, uint32_t arraySlice,
 	const XrRect2Di& rect, ID3D11RenderTargetView* rtv,
-	const D3D11_VIEWPORT& vp, ID3D11BlendState* blendState, bool isSyncEye = false) {
+	const D3D11_VIEWPORT& vp, ID3D11BlendState* blendState, bool isSyncEye = false,
+	const rt::EyeReprojection* warp = nullptr) {
 
 	//----------------
 	//OXRWXR CHANGE:
@@ -3083,10 +5073,8 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 	}
 
 
-	// ALWAYS create a temp texture to avoid SRV/RTV binding conflicts
+	// ALWAYS copy into a temp texture to avoid SRV/RTV binding conflicts
 	// The app may still have this texture bound as an RTV, and D3D11 will null the SRV if we try to use it directly
-	ComPtr<ID3D11Texture2D> viewTexture;
-
 	// Always make an SRV-only single-slice, single-sample texture
 	// Use the typed format to avoid CreateShaderResourceView failures
 	D3D11_TEXTURE2D_DESC tempDesc = {};
@@ -3102,12 +5090,6 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 	tempDesc.CPUAccessFlags = 0;
 	tempDesc.MiscFlags = 0;
 
-	HRESULT hr = s.d3d11Device->CreateTexture2D(&tempDesc, nullptr, viewTexture.GetAddressOf());
-	if (FAILED(hr)) {
-		Logf("[OXRWXR] Failed to create temp texture for blit: 0x%08X", hr);
-		return;
-	}
-
 	// Copy the correct subresource (handles array slice)
 	UINT srcSubresource = D3D11CalcSubresource(0, arraySlice, chain.mipCount);
 
@@ -3141,19 +5123,56 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 		srcDesc.SampleDesc.Count == 1 &&
 		rectValid &&
 		(rectW < srcW || rectH < srcH || rectX != 0 || rectY != 0);
-	if (shouldCrop) {
 
-		// Recreate temp texture with rect size for cropped copying
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Reprojection needs the temp texture to hold exactly the submitted imageRect, since that is what the view's FOV spans
+	bool useWarp = warp && warp->active && !blendState && !ui::g_uiState.showFullRender && rectValid &&
+		(shouldCrop || (srcDesc.SampleDesc.Count == 1 && rectW == srcW && rectH == srcH)) &&
+		rt::InitWarpResources(s);
+
+	if (shouldCrop) {
+		// Temp texture with rect size for cropped copying
 		tempDesc.Width = rectW;
 		tempDesc.Height = rectH;
-		tempDesc.Format = typedFormat;  // Ensure format stays correct
-		viewTexture.Reset();
-		HRESULT hr = s.d3d11Device->CreateTexture2D(&tempDesc, nullptr, viewTexture.GetAddressOf());
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Temp texture and SRV are cached per (swapchain, image, slice, size, format) instead of created every frame
+	blitcache::Key cacheKey;
+	cacheKey.swapchain = handles::ToBits(chain.handle);
+	cacheKey.imageIndex = srcIndex;
+	cacheKey.arraySlice = arraySlice;
+	cacheKey.width = tempDesc.Width;
+	cacheKey.height = tempDesc.Height;
+	cacheKey.format = typedFormat;
+	rt::BlitCacheEntry* cached = s.blitCache.GetOrCreate(cacheKey, [&](rt::BlitCacheEntry& entry) {
+		HRESULT hr = s.d3d11Device->CreateTexture2D(&tempDesc, nullptr, entry.texture.GetAddressOf());
 		if (FAILED(hr)) {
-			Logf("[OXRWXR] Failed to create cropped temp texture: 0x%08X", hr);
-			return;
+			Logf("[OXRWXR] Failed to create temp texture for blit: 0x%08X", hr);
+			return false;
+		}
+
+		// Create Shader Resource View
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+		srvDesc.Format = typedFormat; // Use the proper typed format
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = 1;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+		hr = s.d3d11Device->CreateShaderResourceView(entry.texture.Get(), &srvDesc, entry.srv.GetAddressOf());
+		if (FAILED(hr)) {
+			Logf("[OXRWXR] Failed to create SRV: 0x%08X", hr);
+			return false;
 		}
+		return true;
+		});
+	if (!cached) return;
+	ID3D11Texture2D* viewTexture = cached->texture.Get();
 
+	if (shouldCrop) {
 		// Copy only the specified rect
 		D3D11_BOX box{};
 		box.left = rectX;
@@ -3163,7 +5182,7 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 		box.front = 0;
 		box.back = 1;
 
-		s.d3d11Context->CopySubresourceRegion(viewTexture.Get(), 0, 0, 0, 0, sourceTexture.Get(), srcSubresource, &box);
+		s.d3d11Context->CopySubresourceRegion(viewTexture, 0, 0, 0, 0, sourceTexture.Get(), srcSubresource, &box);
 
 		if (rectClamped) {
 			Logf("[OXRWXR] Applied clamped imageRect: %dx%d from (%d,%d)",
@@ -3178,19 +5197,19 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 		// Copy full texture or handle MSAA
 		if (srcDesc.SampleDesc.Count > 1) {
 			// If app used MSAA, resolve it first using the typed format
-			s.d3d11Context->ResolveSubresource(viewTexture.Get(), 0, sourceTexture.Get(), srcSubresource, typedFormat);
+			s.d3d11Context->ResolveSubresource(viewTexture, 0, sourceTexture.Get(), srcSubresource, typedFormat);
 		}
 		else {
 			// Otherwise just copy the full texture
-			s.d3d11Context->CopySubresourceRegion(viewTexture.Get(), 0, 0, 0, 0, sourceTexture.Get(), srcSubresource, nullptr);
+			s.d3d11Context->CopySubresourceRegion(viewTexture, 0, 0, 0, 0, sourceTexture.Get(), srcSubresource, nullptr);
 		}
 	}
 
 	//----------------
 	//OXRWXR CHANGE:
 	//---------------- 
-	// Red sync pixel (DX11)
-	if (isSyncEye) {
+	// Red sync pixel (DX11), drawn after the warp instead when reprojecting so it stays in the corner
+	if (isSyncEye && !useWarp) {
 		D3D11_BOX redBox;
 		redBox.left = 0;
 		redBox.top = 0;
@@ -3200,56 +5219,75 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 		redBox.back = 1;
 
 		UINT pitch = 40; // 10 * 4
-		BYTE data[10 * 10 * 4];
+		alignas(16) BYTE data[10 * 10 * 4];
 
-		if (flipColorOrder) {
-			for (int i = 0; i < 10 * 10; i++) {
-				data[i * 4 + 0] = (bEnableAltEyeRendering && bAltEyeRender) ? 255 : 0; // B
-				data[i * 4 + 1] = 0;   // G
-				data[i * 4 + 2] = OpenXRFrameID;   // R
-				data[i * 4 + 3] = 255; // A
-			}
+		for (int i = 0; i < 10 * 10; i++) {
+			data[i * 4 + 0] = OpenXRFrameID; // R
+			data[i * 4 + 1] = 0;   // G
+			data[i * 4 + 2] = (bEnableAltEyeRendering && bAltEyeRender) ? 255 : 0;   // B
+			data[i * 4 + 3] = 255; // A
 		}
-		else {
-			for (int i = 0; i < 10 * 10; i++) {
-				data[i * 4 + 0] = OpenXRFrameID; // R
-				data[i * 4 + 1] = 0;   // G
-				data[i * 4 + 2] = (bEnableAltEyeRendering && bAltEyeRender) ? 255 : 0;   // B
-				data[i * 4 + 3] = 255; // A
-			}
+		if (flipColorOrder) {
+			imgk::SwizzleRB((uint32_t*)data, (const uint32_t*)data, 10 * 10);
 		}
 
-		s.d3d11Context->UpdateSubresource(viewTexture.Get(), 0, &redBox, data, pitch, 0);
+		s.d3d11Context->UpdateSubresource(viewTexture, 0, &redBox, data, pitch, 0);
 	}
 
-	// Create Shader Resource View
-	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-	srvDesc.Format = typedFormat; // Use the proper typed format
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-	srvDesc.Texture2D.MipLevels = 1;
-	srvDesc.Texture2D.MostDetailedMip = 0;
+	s.d3d11Context->RSSetViewports(1, &vp);
 
-	ComPtr<ID3D11ShaderResourceView> srv;
-	hr = s.d3d11Device->CreateShaderResourceView(viewTexture.Get(), &srvDesc, srv.GetAddressOf());
-	if (FAILED(hr)) {
-		Logf("[OXRWXR] Failed to create SRV: 0x%08X", hr);
-		return;
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Reprojection constants and the copied depth image for the grid warp
+	if (useWarp) {
+		rt::WarpConstants wc = {};
+		reproj::FovTangents srcTan = reproj::TangentsFromFov(warp->renderFov);
+		reproj::FovTangents dstTan = reproj::TangentsFromFov(warp->targetFov);
+		reproj::EyeDelta delta = reproj::ComputeEyeDelta(warp->renderPose, warp->targetPose);
+		const float src[4] = { srcTan.left, srcTan.right, srcTan.up, srcTan.down };
+		const float dst[4] = { dstTan.left, dstTan.right, dstTan.up, dstTan.down };
+		memcpy(wc.srcTan, src, sizeof(src));
+		memcpy(wc.dstTan, dst, sizeof(dst));
+		memcpy(wc.row, delta.m, sizeof(delta.m));
+
+		ComPtr<ID3D11ShaderResourceView> depthSrv;
+		if (warp->depthSwapchain != XR_NULL_HANDLE) {
+			depthSrv = CreateReprojectionDepthSRV(s, *warp, wc.depthRect);
+		}
+		reproj::DepthRange range = depthSrv ? warp->depthRange : reproj::RotationOnlyDepthRange();
+		wc.depthRange[0] = range.minDepth;
+		wc.depthRange[1] = range.maxDepth;
+		wc.depthRange[2] = range.invNear;
+		wc.depthRange[3] = range.invFar;
+		ComPtr<ID3D11ShaderResourceView> motionSrv;
+		if (warp->motionSwapchain != XR_NULL_HANDLE && warp->motionScale != 0.0f) {
+			motionSrv = CreateMotionVectorSRV(s, *warp, wc.motionRect);
+		}
+		wc.gridInfo[0] = (float)rt::kWarpGridSize;
+		wc.gridInfo[1] = depthSrv ? 1.0f : 0.0f;
+		wc.gridInfo[2] = warp->motionScale;
+		wc.gridInfo[3] = motionSrv ? 1.0f : 0.0f;
+
+		s.d3d11Context->UpdateSubresource(s.warpConstantBuffer.Get(), 0, nullptr, &wc, 0, 0);
+		++rt::g_previewCounters.constantUploads;
+		s.d3d11Context->VSSetConstantBuffers(2, 1, s.warpConstantBuffer.GetAddressOf());
+		ID3D11ShaderResourceView* warpSrvs[] = { depthSrv.Get(), motionSrv.Get() };
+		s.d3d11Context->VSSetShaderResources(1, 2, warpSrvs);
 	}
 
-	s.d3d11Context->RSSetViewports(1, &vp);
-
 	// Set shaders and resources
-	s.d3d11Context->VSSetShader(s.blitVS.Get(), nullptr, 0);
+	s.d3d11Context->VSSetShader(useWarp ? s.warpVS.Get() : s.blitVS.Get(), nullptr, 0);
 	s.d3d11Context->PSSetShader(s.blitPS.Get(), nullptr, 0);
 
-	ID3D11ShaderResourceView* srvs[] = { srv.Get() };
+	ID3D11ShaderResourceView* srvs[] = { cached->srv.Get() };
 	s.d3d11Context->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* samplers[] = { s.samplerState.Get() };
 	s.d3d11Context->PSSetSamplers(0, 1, samplers);
 
 	// Set pipeline state
 	s.d3d11Context->IASetInputLayout(nullptr);
-	s.d3d11Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+	s.d3d11Context->IASetPrimitiveTopology(useWarp ? D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST : D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 	s.d3d11Context->OMSetBlendState(blendState, nullptr, 0xFFFFFFFF);
 	s.d3d11Context->OMSetDepthStencilState(nullptr, 0);
 	s.d3d11Context->RSSetState(s.noCullRS.Get());  // Use no-cull rasterizer state to prevent triangle culling
@@ -3258,13 +5296,38 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 	ID3D11RenderTargetView* rtvs[1] = { rtv };
 	s.d3d11Context->OMSetRenderTargets(1, rtvs, nullptr);
 
-	// Draw fullscreen quad
-	s.d3d11Context->Draw(4, 0);
+	if (useWarp) {
+		// Warped grid, 2 triangles per cell
+		s.d3d11Context->Draw(rt::kWarpGridSize * rt::kWarpGridSize * 6, 0);
+	}
+	else {
+		// Draw fullscreen quad
+		s.d3d11Context->Draw(4, 0);
+	}
 
 	// Unbind SRV to avoid conflicts with future RTV usage
 	ID3D11ShaderResourceView* nullSRV[1] = { nullptr };
 	s.d3d11Context->PSSetShaderResources(0, 1, nullSRV);
 
+	if (useWarp) {
+		ID3D11ShaderResourceView* nullWarpSrvs[2] = { nullptr, nullptr };
+		s.d3d11Context->VSSetShaderResources(1, 2, nullWarpSrvs);
+	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Remember the 10x10 source texels' footprint in the preview, so reprojected frames (and frames held by the
+	// preview policy) can clear the sync block there instead of sampling it from the temp texture
+	if (isSyncEye) {
+		s.previewSyncRect.left = (LONG)vp.TopLeftX;
+		s.previewSyncRect.top = (LONG)vp.TopLeftY;
+		s.previewSyncRect.right = s.previewSyncRect.left + (LONG)ceilf(10.0f * vp.Width / (float)tempDesc.Width);
+		s.previewSyncRect.bottom = s.previewSyncRect.top + (LONG)ceilf(10.0f * vp.Height / (float)tempDesc.Height);
+		s.previewSyncSrgbSource = (typedFormat == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB || typedFormat == DXGI_FORMAT_B8G8R8A8_UNORM_SRGB);
+		if (useWarp) ClearSyncBlockD3D11(s, rtv);
+	}
+
 	static int debugCount = 0;
 	if (++debugCount % 120 == 1 && verboseLogging) {
 		Logf("[OXRWXR] blitViewToHalf: srcIdx=%u slice=%u typedFmt=%d srcFmt=%d",
@@ -3278,8 +5341,9 @@ static void blitViewToHalf(rt::Session& s, rt::Swapchain& chain, uint32_t srcInd
 static void blitD3D12ToPreview(rt::Session& s,
 	rt::Swapchain& chainL, uint32_t leftIdx, uint32_t leftSlice,
 	rt::Swapchain* chainR, uint32_t rightIdx, uint32_t rightSlice,
-	ui::DisplayLayout layout, ui::ViewMode viewMode) {
-	if (!s.previewSwapchain12 || !s.previewCmdList || !s.previewCmdAlloc) {
+	ui::DisplayLayout layout, ui::ViewMode viewMode, bool syncOnly = false,
+	const XrRect2Di* leftRect = nullptr, const XrRect2Di* rightRect = nullptr) {
+	if (!s.previewSwapchain12 || !s.previewCmdList || s.previewCmdAllocs.empty()) {
 		Log("[OXRWXR] blitD3D12ToPreview: Missing D3D12 preview resources");
 		return;
 	}
@@ -3292,40 +5356,43 @@ static void blitD3D12ToPreview(rt::Session& s,
 		return;
 	}
 
-	// Wait for previous frame to finish
-	if (s.previewFence->GetCompletedValue() < s.previewFenceValue - 1) {
-		s.previewFence->SetEventOnCompletion(s.previewFenceValue - 1, s.previewFenceEvent);
-		WaitForSingleObject(s.previewFenceEvent, 1000);
-	}
-
 	// Get current backbuffer index
 	UINT bbIndex = s.previewSwapchain12->GetCurrentBackBufferIndex();
+	if (bbIndex >= s.previewBackbuffers.size() || bbIndex >= s.previewCmdAllocs.size()) {
+		Log("[OXRWXR] blitD3D12ToPreview: Backbuffer index out of range");
+		return;
+	}
 	ID3D12Resource* backbuffer = s.previewBackbuffers[bbIndex].Get();
 	if (!backbuffer) {
 		Log("[OXRWXR] blitD3D12ToPreview: No backbuffer");
 		return;
 	}
 
-	// Create a render target view descriptor heap
-	D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
-	rtvHeapDesc.NumDescriptors = 1;
-	rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
-	rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-	s.d3d12Device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&s.previewRTVHeap));
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Only wait when this backbuffer's allocator is still in use, or more than d3d12_frames_in_flight blits are queued
+	UINT64 lastSignaled = s.previewFenceValue - 1;
+	UINT64 waitValue = s.previewAllocFenceValues[bbIndex];
+	UINT64 inFlight = (UINT64)iD3D12FramesInFlight;
+	if (lastSignaled >= inFlight) waitValue = std::max(waitValue, lastSignaled - (inFlight - 1));
+	if (waitValue > 0 && s.previewFence->GetCompletedValue() < waitValue) {
+		s.previewFence->SetEventOnCompletion(waitValue, s.previewFenceEvent);
+		WaitForSingleObject(s.previewFenceEvent, 1000);
+	}
 
-	// Create a render target view descriptor for backbuffer
-	D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
-	rtvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-	rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
-	s.d3d12Device->CreateRenderTargetView(backbuffer, &rtvDesc, s.previewRTVHeap->GetCPUDescriptorHandleForHeapStart());
+	// RTVs were created per backbuffer in ensurePreviewSized
+	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = s.previewRTVHeap->GetCPUDescriptorHandleForHeapStart();
+	rtvHandle.ptr += (SIZE_T)bbIndex * s.previewRTVDescriptorSize;
 
 	// Reset command allocator and list
-	HRESULT hr = s.previewCmdAlloc->Reset();
+	ID3D12CommandAllocator* cmdAlloc = s.previewCmdAllocs[bbIndex].Get();
+	HRESULT hr = cmdAlloc->Reset();
 	if (FAILED(hr)) {
 		Logf("[OXRWXR] blitD3D12ToPreview: CmdAlloc Reset failed 0x%08X", hr);
 		return;
 	}
-	hr = s.previewCmdList->Reset(s.previewCmdAlloc.Get(), nullptr);
+	hr = s.previewCmdList->Reset(cmdAlloc, nullptr);
 	if (FAILED(hr)) {
 		Logf("[OXRWXR] blitD3D12ToPreview: CmdList Reset failed 0x%08X", hr);
 		return;
@@ -3362,7 +5429,7 @@ static void blitD3D12ToPreview(rt::Session& s,
 		return D3D12CalcSubresource(0, slice, 0, mipLevels, arraySize);
 		};
 
-	auto copyEye = [&](rt::Swapchain& chain, uint32_t idx, uint32_t slice,
+	auto copyEye = [&](rt::Swapchain& chain, uint32_t idx, uint32_t slice, const XrRect2Di* rect,
 		UINT dstX, UINT dstY, const char* label, bool isSyncEye = false) -> bool {
 			//----------------
 			//OXRWXR CHANGE:
@@ -3395,27 +5462,37 @@ static void blitD3D12ToPreview(rt::Session& s,
 			src.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
 			src.SubresourceIndex = subresource;
 
+			// Copies can't scale, so clamp to what fits the (possibly reduced-resolution) backbuffer.
+			// Only the submitted imageRect is copied, which may be smaller than the image under dynamic resolution.
+			if (dstX >= s.previewWidth || dstY >= s.previewHeight) return false;
+			UINT rectX = 0, rectY = 0, rectW = chain.width, rectH = chain.height;
+			if (rect && rect->offset.x >= 0 && rect->offset.y >= 0 && rect->extent.width > 0 && rect->extent.height > 0 &&
+				(uint32_t)(rect->offset.x + rect->extent.width) <= chain.width &&
+				(uint32_t)(rect->offset.y + rect->extent.height) <= chain.height) {
+				rectX = (UINT)rect->offset.x; rectY = (UINT)rect->offset.y;
+				rectW = (UINT)rect->extent.width; rectH = (UINT)rect->extent.height;
+			}
 			D3D12_BOX srcBox = {};
-			srcBox.left = 0;
-			srcBox.top = 0;
+			srcBox.left = rectX;
+			srcBox.top = rectY;
 			srcBox.front = 0;
-			srcBox.right = chain.width;
-			srcBox.bottom = chain.height;
+			srcBox.right = rectX + std::min(rectW, s.previewWidth - dstX);
+			srcBox.bottom = rectY + std::min(rectH, s.previewHeight - dstY);
 			srcBox.back = 1;
 
 			s.previewCmdList->CopyTextureRegion(&dst, dstX, dstY, 0, &src, &srcBox);
 
 			if (isSyncEye) {
-				D3D12_RESOURCE_STATES backbufferState = D3D12_RESOURCE_STATE_PRESENT;
+				// The backbuffer is in COPY_DEST here and must be back there for the other eye's copy
+				D3D12_RESOURCE_STATES backbufferState = D3D12_RESOURCE_STATE_COPY_DEST;
 				transition(backbuffer, backbufferState, D3D12_RESOURCE_STATE_RENDER_TARGET);
 
 				float red[4] = { redIntensity, 0.0f, blueIntensity, 1.0f };
 				D3D12_RECT rect = { 0, 0, 10, 10 };
-				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = s.previewRTVHeap->GetCPUDescriptorHandleForHeapStart();
 				s.previewCmdList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
 				s.previewCmdList->ClearRenderTargetView(rtvHandle, red, 1, &rect);
 
-				transition(backbuffer, backbufferState, D3D12_RESOURCE_STATE_PRESENT);
+				transition(backbuffer, backbufferState, D3D12_RESOURCE_STATE_COPY_DEST);
 			}
 
 			transition(srcTex, chain.imageStates12[idx], prevState);
@@ -3440,16 +5517,33 @@ static void blitD3D12ToPreview(rt::Session& s,
 	const bool hasLeft = leftIdx < chainL.images12.size() && chainL.images12[leftIdx];
 	const bool hasRight = chainR && rightIdx < chainR->images12.size() && chainR->images12[rightIdx];
 
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Preview policy: sync-only frames skip the eye copies and draw just the red sync block (DX12)
+	if (syncOnly) {
+		D3D12_RESOURCE_STATES backbufferState = D3D12_RESOURCE_STATE_COPY_DEST;
+		transition(backbuffer, backbufferState, D3D12_RESOURCE_STATE_RENDER_TARGET);
+
+		const float clearColor[4] = { 0.1f, 0.1f, 0.2f, 1.0f };
+		const float red[4] = { OpenXRFrameID / 255.0f, 0.0f, (bEnableAltEyeRendering && bAltEyeRender) ? 1.0f : 0.0f, 1.0f };
+		D3D12_RECT rect = { 0, 0, 10, 10 };
+		s.previewCmdList->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
+		s.previewCmdList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
+		s.previewCmdList->ClearRenderTargetView(rtvHandle, red, 1, &rect);
+
+		transition(backbuffer, backbufferState, D3D12_RESOURCE_STATE_COPY_DEST);
+	}
 	// Single-eye mode: render selected eye full-screen
-	if (singleEye || forceSingleEye) {
+	else if (singleEye || forceSingleEye) {
 		if (viewMode == ui::ViewMode::RightEyeOnly && hasRight) {
-			copyEye(*chainR, rightIdx, rightSlice, 0, 0, "R", true);
+			copyEye(*chainR, rightIdx, rightSlice, rightRect, 0, 0, "R", true);
 		}
 		else if (hasLeft) {
-			copyEye(chainL, leftIdx, leftSlice, 0, 0, "L", true);
+			copyEye(chainL, leftIdx, leftSlice, leftRect, 0, 0, "L", true);
 		}
 		else if (hasRight) {
-			copyEye(*chainR, rightIdx, rightSlice, 0, 0, "R", true);
+			copyEye(*chainR, rightIdx, rightSlice, rightRect, 0, 0, "R", true);
 		}
 	}
 	else {
@@ -3457,13 +5551,13 @@ static void blitD3D12ToPreview(rt::Session& s,
 		UINT rightY = (effectiveLayout == ui::DisplayLayout::OverUnder) ? (UINT)(s.previewHeight / 2) : 0;
 
 		if (hasLeft) {
-			copyEye(chainL, leftIdx, leftSlice, 0, 0, "L", true);
+			copyEye(chainL, leftIdx, leftSlice, leftRect, 0, 0, "L", true);
 		}
 		if (hasRight) {
-			copyEye(*chainR, rightIdx, rightSlice, rightX, rightY, "R", false);
+			copyEye(*chainR, rightIdx, rightSlice, rightRect, rightX, rightY, "R", false);
 		}
 		else if (hasLeft) {
-			copyEye(chainL, leftIdx, leftSlice, rightX, rightY, "L", false);
+			copyEye(chainL, leftIdx, leftSlice, leftRect, rightX, rightY, "L", false);
 		}
 	}
 
@@ -3477,7 +5571,8 @@ static void blitD3D12ToPreview(rt::Session& s,
 	ID3D12CommandList* cmdLists[] = { s.previewCmdList.Get() };
 	s.d3d12Queue->ExecuteCommandLists(1, cmdLists);
 
-	// Signal fence
+	// Signal fence; the allocator can be reset once this value completes
+	s.previewAllocFenceValues[bbIndex] = s.previewFenceValue;
 	s.d3d12Queue->Signal(s.previewFence.Get(), s.previewFenceValue++);
 
 	static int blitCount = 0;
@@ -3489,7 +5584,7 @@ static void blitD3D12ToPreview(rt::Session& s,
 // Flag to track if Present should be called (deferred until all layers rendered)
 static bool g_presentPending = false;
 
-static void presentProjection(rt::Session& s, const XrCompositionLayerProjection& proj, bool skipPresent = false) {
+static void presentProjection(rt::Session& s, const XrCompositionLayerProjection& proj, bool skipPresent = false, bool synthesized = false) {
 	ShowCursor(FALSE);
 
 	if (verboseLogging) Log("[OXRWXR] ============================================");
@@ -3501,23 +5596,36 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 		return;
 	}
 	const auto& vL = proj.views[0];
-	auto itL = rt::g_swapchains.find(vL.subImage.swapchain);
-	if (itL == rt::g_swapchains.end()) {
+	rt::Swapchain* chLPtr = rt::g_swapchains.Get(vL.subImage.swapchain);
+	if (!chLPtr) {
 		Log("[OXRWXR] presentProjection: Left swapchain not found");
 		return;
 	}
-	auto& chL = itL->second;
+	auto& chL = *chLPtr;
 	uint32_t width = chL.width, height = chL.height;
 	const rt::Swapchain* chRPtr = &chL;
 	if (proj.viewCount > 1) {
 		const auto& vR = proj.views[1];
-		auto itR = rt::g_swapchains.find(vR.subImage.swapchain);
-		if (itR != rt::g_swapchains.end()) {
-			chRPtr = &itR->second;
-			if (itR->second.width > width) width = itR->second.width;
-			if (itR->second.height > height) height = itR->second.height;
+		if (const rt::Swapchain* chR = rt::g_swapchains.Get(vR.subImage.swapchain)) {
+			chRPtr = chR;
+			if (chR->width > width) width = chR->width;
+			if (chR->height > height) height = chR->height;
 		}
 	}
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Late frame: warp each view to the newest head pose (D3D11 on the GPU, OpenGL on the CPU)
+	rt::EyeReprojection warps[2];
+	if (!s.usesD3D12) {
+		PrepareReprojection(proj, warps, synthesized);
+	}
+
+	rt::NotePreviewFrame(s);
+	const rt::PreviewPass pass = rt::NextPreviewPass(s);
+	const bool composeEyes = (pass == rt::PreviewPass::Compose);
+
 	{
 		std::lock_guard<std::mutex> lock(s.previewMutex);
 
@@ -3551,9 +5659,11 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				}
 			}
 
-			// Read pixel data from GL textures into CPU buffers
-			std::vector<uint8_t> leftPixels(width * height * 4);
-			std::vector<uint8_t> rightPixels(width * height * 4);
+			// Read pixel data from GL textures into the session's staging buffers
+			std::vector<uint8_t>& leftPixels = s.glStaging[0];
+			std::vector<uint8_t>& rightPixels = s.glStaging[1];
+			leftPixels.resize((size_t)width * height * 4);
+			rightPixels.resize((size_t)width * height * 4);
 
 			// Get left eye texture
 			GLuint leftTex = 0;
@@ -3565,9 +5675,9 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				}
 			}
 
-			// Get right eye texture
+			// Get right eye texture (a mono layer has none: the left one is mirrored instead of read back twice)
 			GLuint rightTex = 0;
-			if (chRPtr && chRPtr->imagesGL.size() > 0) {
+			if (proj.viewCount > 1 && chRPtr && chRPtr->imagesGL.size() > 0) {
 				uint32_t idx = chRPtr->lastReleased;
 				if (idx == UINT32_MAX || idx >= chRPtr->imageCount) idx = chRPtr->lastAcquired;
 				if (idx != UINT32_MAX && idx < chRPtr->imagesGL.size()) {
@@ -3575,32 +5685,85 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				}
 			}
 
-			// Read left eye pixels using glGetTexImage
-			if (leftTex != 0) {
-				glBindTexture(GL_TEXTURE_2D, leftTex);
-				glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, leftPixels.data());
+			//----------------
+			//OXRWXR CHANGE:
+			//---------------- 
+			// PBO ring: this frame's eyes and depth layers are queued and last frame's are shown, so the app's
+			// pipeline never stalls; the warp then starts from the pose that older frame was rendered with.
+			// Half-rate synthesis compares consecutive app frames, so it keeps the synchronous readback.
+			// Held and sync-only preview frames don't show new eyes, so they skip the readback entirely.
+			const bool warpEye[2] = {
+				leftTex != 0 && chL.width == width && chL.height == height && RectCoversImage(vL.subImage.imageRect, width, height),
+				rightTex != 0 && proj.viewCount > 1 && chRPtr->width == width && chRPtr->height == height &&
+					RectCoversImage(proj.views[1].subImage.imageRect, width, height),
+			};
+			bool asyncReadback = bGLAsyncReadback && !bEnableHalfRate && EnsureGLPixelBufferFuncs();
+			if (!composeEyes) {
+				// Nothing to read back
 			}
+			else if (asyncReadback) {
+				const GLuint eyeTex[2] = { leftTex, rightTex };
+				rt::EyeReprojection sources[2];
+				for (uint32_t i = 0; i < 2; i++) {
+					if (!bEnableReprojection || !warpEye[i]) continue;
+					FillEyeSource(proj.views[i], sources[i]);
+					sources[i].active = true;
+				}
+				bool fresh = ReadbackGLEyesAsync(s, eyeTex, width, height, sources);
+				if (!fresh && glFrameCount % 60 == 1) {
+					Logf("[OXRWXR] GL PREVIEW: readback not ready, showing previous image (late=%llu)",
+						(unsigned long long)s.glReadback.LateFrames());
+				}
 
-			// Read right eye pixels
-			if (rightTex != 0) {
-				glBindTexture(GL_TEXTURE_2D, rightTex);
-				glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, rightPixels.data());
+				// The shown eyes are at least a frame old: warp them to the newest pose, or to this frame's
+				for (uint32_t i = 0; i < 2; i++) {
+					rt::EyeReprojection& staged = s.glStagedSource[i];
+					if (!staged.active || i >= proj.viewCount) continue;
+					staged.targetPose = warps[i].active ? warps[i].targetPose : proj.views[i].pose;
+					staged.targetFov = proj.views[i].fov;
+					if (!reproj::NeedsReprojection(staged.renderPose, staged.targetPose)) continue;
+					ReprojectGLView(staged, s.glStaging[i], width, height, s.glStagedDepth[i] ? s.glDepthStaging[i].data() : nullptr);
+					// Staging now holds the warped image; if the next readback is late it is warped on from here
+					staged.renderPose = staged.targetPose;
+					staged.renderFov = staged.targetFov;
+					s.glStagedDepth[i] = false;
+				}
 			}
+			else {
+				if (s.glReadback.Width() != 0 && g_glDeleteBuffers) DestroyGLReadback(s);
 
-			// Flip images vertically - OpenGL has Y=0 at bottom, D3D expects Y=0 at top
-			auto flipImageVertically = [](std::vector<uint8_t>& pixels, uint32_t width, uint32_t height) {
-				const uint32_t rowSize = width * 4;
-				std::vector<uint8_t> tempRow(rowSize);
-				for (uint32_t y = 0; y < height / 2; y++) {
-					uint8_t* topRow = pixels.data() + y * rowSize;
-					uint8_t* bottomRow = pixels.data() + (height - 1 - y) * rowSize;
-					memcpy(tempRow.data(), topRow, rowSize);
-					memcpy(topRow, bottomRow, rowSize);
-					memcpy(bottomRow, tempRow.data(), rowSize);
+				// Read left eye pixels using glGetTexImage
+				if (leftTex != 0) {
+					glBindTexture(GL_TEXTURE_2D, leftTex);
+					glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, leftPixels.data());
 				}
-				};
-			if (leftTex != 0) flipImageVertically(leftPixels, width, height);
-			if (rightTex != 0) flipImageVertically(rightPixels, width, height);
+
+				// Read right eye pixels
+				if (rightTex != 0) {
+					glBindTexture(GL_TEXTURE_2D, rightTex);
+					glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, rightPixels.data());
+				}
+
+				// Flip images vertically - OpenGL has Y=0 at bottom, D3D expects Y=0 at top
+				if (leftTex != 0) imgk::FlipRowsInPlace(leftPixels.data(), (size_t)width * 4, height);
+				if (rightTex != 0) imgk::FlipRowsInPlace(rightPixels.data(), (size_t)width * 4, height);
+			}
+
+			//----------------
+			//OXRWXR CHANGE:
+			//---------------- 
+			// Synchronous path: reproject on the CPU while the app's context is still current, reading this
+			// frame's depth layer only when the eye is actually warped. Block-matched synthesis already moved
+			// the image by the extrapolated camera motion, so only the rest of the way to the target is warped.
+			for (uint32_t i = 0; composeEyes && !asyncReadback && i < 2; i++) {
+				if (!warpEye[i]) continue;
+				if (bEnableHalfRate && SynthesizeGLView(s, warps[i], i, s.glStaging[i], width, height, synthesized)) {
+					warps[i].renderPose = warps[i].contentPose;
+				}
+				if (warps[i].active && reproj::NeedsReprojection(warps[i].renderPose, warps[i].targetPose)) {
+					ReprojectGLView(warps[i], s.glStaging[i], width, height, ReadGLDepthSync(s, warps[i], i, width, height));
+				}
+			}
 
 			// MCP Integration - check for screenshot requests and capture (OpenGL path)
 			//mcp::CheckScreenshotRequest();
@@ -3715,13 +5878,6 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				return;
 			}
 
-			// Get the backbuffer
-			ComPtr<ID3D11Texture2D> bb;
-			if (FAILED(s.previewSwapchain->GetBuffer(0, IID_PPV_ARGS(bb.GetAddressOf())))) {
-				Log("[OXRWXR] Failed to get preview swapchain buffer for GL preview");
-				return;
-			}
-
 			// Create staging textures to upload GL pixel data
 			D3D11_TEXTURE2D_DESC texDesc = {};
 			texDesc.Width = width;
@@ -3733,16 +5889,48 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 			texDesc.Usage = D3D11_USAGE_DEFAULT;
 			texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 
-			D3D11_SUBRESOURCE_DATA initData = {};
-			initData.pSysMem = leftPixels.data();
-			initData.SysMemPitch = width * 4;
-
-			ComPtr<ID3D11Texture2D> leftTex2D;
-			s.d3d11Device->CreateTexture2D(&texDesc, &initData, &leftTex2D);
-
-			initData.pSysMem = rightPixels.data();
-			ComPtr<ID3D11Texture2D> rightTex2D;
-			s.d3d11Device->CreateTexture2D(&texDesc, &initData, &rightTex2D);
+			//----------------
+			//OXRWXR CHANGE:
+			//---------------- 
+			// Upload textures are cached per eye (keyed on the left swapchain), only their contents change per frame.
+			// Only the eye's imageRect is uploaded, so a dynamic-resolution rect fills the viewport like a full image.
+			auto uploadEye = [&](uint32_t eye, const std::vector<uint8_t>& pixels) -> rt::BlitCacheEntry* {
+				const XrRect2Di& rect = proj.views[eye < proj.viewCount ? eye : 0].subImage.imageRect;
+				uint32_t rectX = 0, rectY = 0, rectW = width, rectH = height;
+				if (rect.offset.x >= 0 && rect.offset.y >= 0 && rect.extent.width > 0 && rect.extent.height > 0 &&
+					(uint32_t)(rect.offset.x + rect.extent.width) <= width &&
+					(uint32_t)(rect.offset.y + rect.extent.height) <= height) {
+					rectX = (uint32_t)rect.offset.x;
+					rectW = (uint32_t)rect.extent.width;
+					rectH = (uint32_t)rect.extent.height;
+					rectY = height - (uint32_t)rect.offset.y - rectH;  // GL rects start at the bottom, the pixels were flipped
+				}
+				D3D11_TEXTURE2D_DESC rectDesc = texDesc;
+				rectDesc.Width = rectW;
+				rectDesc.Height = rectH;
+
+				blitcache::Key key;
+				key.swapchain = handles::ToBits(chL.handle);
+				key.arraySlice = eye;
+				key.width = rectW;
+				key.height = rectH;
+				key.format = texDesc.Format;
+				rt::BlitCacheEntry* entry = s.blitCache.GetOrCreate(key, [&](rt::BlitCacheEntry& e) {
+					if (FAILED(s.d3d11Device->CreateTexture2D(&rectDesc, nullptr, e.texture.GetAddressOf()))) return false;
+					HRESULT hr = s.d3d11Device->CreateShaderResourceView(e.texture.Get(), nullptr, e.srv.GetAddressOf());
+					if (FAILED(hr) && glFrameCount % 60 == 1) {
+						Logf("[OXRWXR] GL PREVIEW: CreateSRV for eye %u failed: 0x%08X", eye, hr);
+					}
+					return SUCCEEDED(hr);
+					});
+				if (entry) {
+					const uint8_t* src = pixels.data() + ((size_t)rectY * width + rectX) * 4;
+					s.d3d11Context->UpdateSubresource(entry->texture.Get(), 0, nullptr, src, width * 4, 0);
+				}
+				return entry;
+				};
+			rt::BlitCacheEntry* leftUpload = composeEyes ? uploadEye(0, leftPixels) : nullptr;
+			rt::BlitCacheEntry* rightUpload = (composeEyes && rightTex != 0) ? uploadEye(1, rightPixels) : nullptr;
 
 			// Use shader-based rendering for proper side-by-side display
 			bool singleEye = (viewMode != ui::ViewMode::BothEyes);
@@ -3755,38 +5943,28 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				return;
 			}
 
-			// Create render target view for the backbuffer
-			ComPtr<ID3D11RenderTargetView> rtv;
-			if (FAILED(s.d3d11Device->CreateRenderTargetView(bb.Get(), nullptr, rtv.GetAddressOf()))) {
+			// Cached render target view for the backbuffer
+			ID3D11RenderTargetView* rtv = rt::GetPreviewRTV(s, false);
+			if (!rtv) {
 				Log("[OXRWXR] OpenGL preview: Failed to create RTV");
 				return;
 			}
 
-			// Create SRVs for the uploaded textures
-			ComPtr<ID3D11ShaderResourceView> leftSRV, rightSRV;
-			if (leftTex2D) {
-				HRESULT hr = s.d3d11Device->CreateShaderResourceView(leftTex2D.Get(), nullptr, leftSRV.GetAddressOf());
-				if (FAILED(hr) && glFrameCount % 60 == 1) {
-					Logf("[OXRWXR] GL PREVIEW: CreateSRV for left failed: 0x%08X", hr);
-				}
-			}
-			if (rightTex2D) {
-				HRESULT hr = s.d3d11Device->CreateShaderResourceView(rightTex2D.Get(), nullptr, rightSRV.GetAddressOf());
-				if (FAILED(hr) && glFrameCount % 60 == 1) {
-					Logf("[OXRWXR] GL PREVIEW: CreateSRV for right failed: 0x%08X", hr);
-				}
-			}
+			// SRVs for the uploaded textures
+			ID3D11ShaderResourceView* leftSRV = leftUpload ? leftUpload->srv.Get() : nullptr;
+			ID3D11ShaderResourceView* rightSRV = rightUpload ? rightUpload->srv.Get() : nullptr;
 
 			if (glFrameCount % 60 == 1) {
 				Logf("[OXRWXR] GL PREVIEW: leftTex2D=%p rightTex2D=%p leftSRV=%p rightSRV=%p",
-					leftTex2D.Get(), rightTex2D.Get(), leftSRV.Get(), rightSRV.Get());
+					leftUpload ? leftUpload->texture.Get() : nullptr, rightUpload ? rightUpload->texture.Get() : nullptr,
+					leftSRV, rightSRV);
 			}
 
 			// Clear the render target
-			ID3D11RenderTargetView* rtvs[1] = { rtv.Get() };
+			ID3D11RenderTargetView* rtvs[1] = { rtv };
 			s.d3d11Context->OMSetRenderTargets(1, rtvs, nullptr);
 			const float clearColor[4] = { 0.1f, 0.1f, 0.2f, 1.0f };  // Dark blue
-			s.d3d11Context->ClearRenderTargetView(rtv.Get(), clearColor);
+			s.d3d11Context->ClearRenderTargetView(rtv, clearColor);
 
 			// Setup viewports for left and right eyes
 			D3D11_VIEWPORT fullVp = {};
@@ -3825,7 +6003,7 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				}
 
 				// Ensure render target is bound
-				ID3D11RenderTargetView* currentRTVs[1] = { rtv.Get() };
+				ID3D11RenderTargetView* currentRTVs[1] = { rtv };
 				s.d3d11Context->OMSetRenderTargets(1, currentRTVs, nullptr);
 
 				s.d3d11Context->RSSetViewports(1, &vp);
@@ -3854,72 +6032,27 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 			//OXRWXR CHANGE:
 			//---------------- 
 			// Helper lambda to blit a solid red quad (OPENGL)
+			// The quad comes from blitVS (SV_VertexID) filling the viewport, so no vertex buffer is needed,
+			// and the persistent color constant buffer is only rewritten when the color changes
 			auto blitRedQuad = [&](const D3D11_VIEWPORT& vp, int redIntensity = 255) {
-				// Define a simple red pixel shader
-				struct Vertex {
-					float x, y, z;
-				};
-				Vertex vertices[] = {
-					{ 0.0f, 0.0f, 0.0f },
-					{ 10.0f, 0.0f, 0.0f },
-					{ 0.0f, 10.0f, 0.0f },
-					{ 10.0f, 10.0f, 0.0f }
-				};
-
-				// Create a vertex buffer
-				ID3D11Buffer* vertexBuffer = nullptr;
-				D3D11_BUFFER_DESC bd = {};
-				bd.ByteWidth = sizeof(vertices);
-				bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-				bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-				bd.Usage = D3D11_USAGE_DYNAMIC;
-				D3D11_SUBRESOURCE_DATA initData = { vertices, 0, 0 };
-				s.d3d11Device->CreateBuffer(&bd, &initData, &vertexBuffer);
-
-				// Map vertex buffer
-				D3D11_MAPPED_SUBRESOURCE mappedResource;
-				s.d3d11Context->Map(vertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-				memcpy(mappedResource.pData, vertices, sizeof(vertices));
-				s.d3d11Context->Unmap(vertexBuffer, 0);
-
 				// Ensure render target is bound
-				ID3D11RenderTargetView* currentRTVs[1] = { rtv.Get() };
+				ID3D11RenderTargetView* currentRTVs[1] = { rtv };
 				s.d3d11Context->OMSetRenderTargets(1, currentRTVs, nullptr);
 
 				s.d3d11Context->RSSetViewports(1, &vp);
 				s.d3d11Context->VSSetShader(s.blitVS.Get(), nullptr, 0);
 				s.d3d11Context->PSSetShader(s.solidColorPS.Get(), nullptr, 0);
 
-				if (!s.colorConstantBuffer) {
-					D3D11_BUFFER_DESC cbDesc = {};
-					cbDesc.ByteWidth = sizeof(float) * 4;
-					cbDesc.Usage = D3D11_USAGE_DEFAULT;
-					cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-					HRESULT hr = s.d3d11Device->CreateBuffer(&cbDesc, nullptr, s.colorConstantBuffer.GetAddressOf());
-					if (FAILED(hr)) {
-						Logf("[WinXrApi] Failed to create color constant buffer: 0x%08X", hr);
-						// Release resources
-						vertexBuffer->Release();
-						return;
-					}
-				}
-
-				// Update color constant buffer
-				struct ColorConstantBuffer {
-					float color[4];
-				} colorBuffer;
-				colorBuffer.color[0] = redIntensity;
-				colorBuffer.color[1] = 0;
-				colorBuffer.color[2] = (bEnableAltEyeRendering && bAltEyeRender) ? 255 : 0;
-				colorBuffer.color[3] = 255;
-				s.d3d11Context->UpdateSubresource(s.colorConstantBuffer.Get(), 0, nullptr, &colorBuffer, 0, 0);
+				const float color[4] = {
+					(float)redIntensity,
+					0.0f,
+					(bEnableAltEyeRendering && bAltEyeRender) ? 255.0f : 0.0f,
+					255.0f
+				};
+				if (!rt::UpdateColorConstants(s, color)) return;
 				s.d3d11Context->PSSetConstantBuffers(0, 1, s.colorConstantBuffer.GetAddressOf());
 
-				// Set vertex buffer
-				UINT stride = sizeof(Vertex);
-				UINT offset = 0;
-				s.d3d11Context->IASetVertexBuffers(0, 1, &vertexBuffer, &stride, &offset);
-				s.d3d11Context->IASetInputLayout(s.simpleVertexLayout.Get());
+				s.d3d11Context->IASetInputLayout(nullptr);
 				s.d3d11Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 				s.d3d11Context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
 				s.d3d11Context->OMSetDepthStencilState(nullptr, 0);
@@ -3927,33 +6060,34 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 
 				// Draw the quad
 				s.d3d11Context->Draw(4, 0);
-
-				// Clean up
-				vertexBuffer->Release();
 				};
 
-			// Render the eyes
-			if (singleEye) {
+			// Render the eyes (held preview frames show the last composed ones, sync-only frames none)
+			if (pass == rt::PreviewPass::Hold) {
+				rt::RestorePreviewComposite(s);
+			}
+			else if (singleEye) {
 				if (showLeft && leftSRV) {
-					blitTexture(leftSRV.Get(), fullVp);
+					blitTexture(leftSRV, fullVp);
 				}
-				else if (showRight && rightSRV) {
-					blitTexture(rightSRV.Get(), fullVp);
+				else if (showRight && (rightSRV || leftSRV)) {
+					blitTexture(rightSRV ? rightSRV : leftSRV, fullVp);
 				}
 			}
 			else {
 				// Side by side (or over/under)
 				if (showLeft && leftSRV) {
-					blitTexture(leftSRV.Get(), leftVp);
+					blitTexture(leftSRV, leftVp);
 				}
 				if (showRight && rightSRV) {
-					blitTexture(rightSRV.Get(), rightVp);
+					blitTexture(rightSRV, rightVp);
 				}
 				else if (showRight && leftSRV) {
 					// Mirror left eye if no right eye available
-					blitTexture(leftSRV.Get(), rightVp);
+					blitTexture(leftSRV, rightVp);
 				}
 			}
+			if (composeEyes) rt::StorePreviewComposite(s);
 
 			//----------------
 			//OXRWXR CHANGE:
@@ -3993,7 +6127,7 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 					Logf("[OXRWXR] GL PREVIEW: About to Present - hwnd=%p, swapchain=%p", s.hwnd, s.previewSwapchain.Get());
 				}
 
-				HRESULT presentHr = s.previewSwapchain->Present(1, 0);
+				HRESULT presentHr = rt::PresentPreview(s);
 				if (FAILED(presentHr) && glFrameCount % 60 == 1) {
 					Logf("[OXRWXR] GL PREVIEW: Present FAILED with hr=0x%08X", presentHr);
 				}
@@ -4040,41 +6174,17 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 			// Save D3D11 context state - will auto-restore when stateBackup goes out of scope
 			D3D11StateBackup stateBackup(s.d3d11Context.Get());
 
-			// Get the backbuffer and create RTV
-			ComPtr<ID3D11Texture2D> bb;
-			if (FAILED(s.previewSwapchain->GetBuffer(0, IID_PPV_ARGS(bb.GetAddressOf())))) {
-				Log("[OXRWXR] Failed to get preview swapchain buffer.");
-				return;
-			}
-
-			// Create explicit sRGB RTV for proper gamma encoding
-			DXGI_FORMAT bbFmt = s.previewFormat;
-			DXGI_FORMAT rtvFmt = bbFmt;
-			if (bbFmt == DXGI_FORMAT_R8G8B8A8_UNORM)       rtvFmt = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-			else if (bbFmt == DXGI_FORMAT_B8G8R8A8_UNORM)  rtvFmt = DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
-
-			D3D11_RENDER_TARGET_VIEW_DESC rtvDesc = {};
-			rtvDesc.Format = rtvFmt;
-			rtvDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
-			rtvDesc.Texture2D.MipSlice = 0;
-
-			ComPtr<ID3D11RenderTargetView> rtv;
-			HRESULT hr = s.d3d11Device->CreateRenderTargetView(bb.Get(), &rtvDesc, rtv.GetAddressOf());
-			if (FAILED(hr)) {
-				Logf("[OXRWXR] Explicit sRGB RTV failed (0x%08X), falling back to auto format", hr);
-				if (FAILED(s.d3d11Device->CreateRenderTargetView(bb.Get(), nullptr, rtv.GetAddressOf()))) {
-					Log("[OXRWXR] Failed to create RTV for preview.");
-					return;
-				}
-			}
+			// Cached sRGB RTV on the backbuffer (recreated only when the preview swapchain changes)
+			ID3D11RenderTargetView* rtv = rt::GetPreviewRTV(s, true);
+			if (!rtv) return;
 
 			// Bind RTV and clear
-			ID3D11RenderTargetView* rtvs[1] = { rtv.Get() };
+			ID3D11RenderTargetView* rtvs[1] = { rtv };
 			s.d3d11Context->OMSetRenderTargets(1, rtvs, nullptr);
 			const float clearColorDefault[4] = { 0.1f, 0.1f, 0.2f, 1.0f };
 			const float clearColorAnaglyph[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
 			const float* clearColor = (layout == ui::DisplayLayout::Anaglyph) ? clearColorAnaglyph : clearColorDefault;
-			s.d3d11Context->ClearRenderTargetView(rtv.Get(), clearColor);
+			s.d3d11Context->ClearRenderTargetView(rtv, clearColor);
 
 			D3D11_VIEWPORT fullVp = {};
 			fullVp.TopLeftX = 0.0f;
@@ -4106,36 +6216,44 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				rightBlend = s.anaglyphCyanBS.Get();
 			}
 
-			if (showLeft) {
-				blitViewToHalf(s, chL, leftIdx, vL.subImage.imageArrayIndex, vL.subImage.imageRect,
-					rtv.Get(), leftVp, leftBlend, true);
-			}
+			if (composeEyes) {
+				if (showLeft) {
+					blitViewToHalf(s, chL, leftIdx, vL.subImage.imageArrayIndex, vL.subImage.imageRect,
+						rtv, leftVp, leftBlend, true, &warps[0]);
+				}
 
-			// Blit right eye
-			if (showRight && proj.viewCount > 1) {
-				const auto& vR = proj.views[1];
-				auto& chR = const_cast<rt::Swapchain&>(*chRPtr);
-				uint32_t rightIdx = 0;
-				if (chR.lastReleased != UINT32_MAX && chR.lastReleased < chR.imageCount) {
-					rightIdx = chR.lastReleased;
+				// Blit right eye
+				if (showRight && proj.viewCount > 1) {
+					const auto& vR = proj.views[1];
+					auto& chR = const_cast<rt::Swapchain&>(*chRPtr);
+					uint32_t rightIdx = 0;
+					if (chR.lastReleased != UINT32_MAX && chR.lastReleased < chR.imageCount) {
+						rightIdx = chR.lastReleased;
+					}
+					else if (chR.lastAcquired != UINT32_MAX && chR.lastAcquired < chR.imageCount) {
+						rightIdx = chR.lastAcquired;
+					}
+					blitViewToHalf(s, chR, rightIdx, vR.subImage.imageArrayIndex, vR.subImage.imageRect,
+						rtv, rightVp, rightBlend, !showLeft, &warps[1]);
 				}
-				else if (chR.lastAcquired != UINT32_MAX && chR.lastAcquired < chR.imageCount) {
-					rightIdx = chR.lastAcquired;
+				else if (showRight && !showLeft) {
+					// Mirror left eye if right-only mode but only one view
+					blitViewToHalf(s, chL, leftIdx, vL.subImage.imageArrayIndex, vL.subImage.imageRect,
+						rtv, rightVp, rightBlend, true, &warps[0]);
 				}
-				blitViewToHalf(s, chR, rightIdx, vR.subImage.imageArrayIndex, vR.subImage.imageRect,
-					rtv.Get(), rightVp, rightBlend, !showLeft);
+				rt::StorePreviewComposite(s);
 			}
-			else if (showRight && !showLeft) {
-				// Mirror left eye if right-only mode but only one view
-				blitViewToHalf(s, chL, leftIdx, vL.subImage.imageArrayIndex, vL.subImage.imageRect,
-					rtv.Get(), rightVp, rightBlend, true);
+			else {
+				// Preview policy: held frames show the last composed eyes, sync-only frames none; the sync block is always fresh
+				if (pass == rt::PreviewPass::Hold) rt::RestorePreviewComposite(s);
+				ClearSyncBlockD3D11(s, rtv);
 			}
 
 			// Present D3D11 (may be deferred if overlays are pending)
 			if (!skipPresent) {
 				MSG msg;
 				while (PeekMessageW(&msg, s.hwnd, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessageW(&msg); }
-				s.previewSwapchain->Present(1, 0);
+				rt::PresentPreview(s);
 			}
 			else {
 				g_presentPending = true;
@@ -4179,34 +6297,78 @@ static void presentProjection(rt::Session& s, const XrCompositionLayerProjection
 				}
 				blitD3D12ToPreview(s, chL, leftIdx, vL.subImage.imageArrayIndex,
 					&chR, rightIdx, vR.subImage.imageArrayIndex,
-					layout, viewMode);
+					layout, viewMode, pass == rt::PreviewPass::SyncOnly, &vL.subImage.imageRect, &vR.subImage.imageRect);
 			}
 			else {
 				blitD3D12ToPreview(s, chL, leftIdx, vL.subImage.imageArrayIndex,
-					nullptr, 0, 0, layout, viewMode);
+					nullptr, 0, 0, layout, viewMode, pass == rt::PreviewPass::SyncOnly, &vL.subImage.imageRect);
 			}
 
 			// Present D3D12 (may be deferred if overlays are pending)
 			if (!skipPresent) {
 				MSG msg;
 				while (PeekMessageW(&msg, s.hwnd, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessageW(&msg); }
-				s.previewSwapchain12->Present(1, 0);
+				rt::PresentPreview(s);
 			}
 			else {
 				g_presentPending = true;
 			}
 		}
 	}
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Half-rate frame synthesis: remember the last projection layer (with its depth / space warp chains)
+static void StoreSubmittedProjection(const XrCompositionLayerProjection& proj) {
+	rt::SubmittedProjection& last = rt::g_lastProjection;
+	const uint32_t viewCount = std::min(proj.viewCount, 2u);
+	if (viewCount == 0) return;
+
+	last.hasPrevious = last.valid && last.layer.viewCount == viewCount;
+	for (uint32_t i = 0; i < viewCount && last.hasPrevious; ++i) {
+		last.previousPoses[i] = last.views[i].pose;
+	}
+
+	last.layer = proj;
+	last.layer.next = nullptr;
+	last.layer.viewCount = viewCount;
+	last.layer.views = last.views;
+	for (uint32_t i = 0; i < viewCount; ++i) {
+		last.views[i] = proj.views[i];
+		last.views[i].next = nullptr;
+
+		const void* chain = nullptr;
+		if (const XrCompositionLayerSpaceWarpInfoFB* spaceWarp = FindSpaceWarpInfo(proj.views[i])) {
+			last.spaceWarp[i] = *spaceWarp;
+			last.spaceWarp[i].next = nullptr;
+			chain = &last.spaceWarp[i];
+		}
+		if (const XrCompositionLayerDepthInfoKHR* depth = FindDepthInfo(proj.views[i])) {
+			last.depth[i] = *depth;
+			last.depth[i].next = chain;
+			chain = &last.depth[i];
+		}
+		last.views[i].next = chain;
+	}
+	last.threadId = GetCurrentThreadId();
+	last.valid = true;
+}
 
-	if (bEnableAltEyeRendering) {
-		bAltEyeRender = !bAltEyeRender;
+// Presents the last submission again, warped to the current pose. Only done on the thread that
+// submitted it, since it uses the app's D3D11 immediate context / GL context.
+static void PresentSynthesizedFrame() {
+	rt::SubmittedProjection& last = rt::g_lastProjection;
+	rt::Session& s = rt::g_session;
+	if (!last.valid || s.usesD3D12 || last.threadId != GetCurrentThreadId()) return;
 
-		if (bAltEyeRender) {
-			ui::g_uiState.viewMode = ui::ViewMode::RightEyeOnly;
-		}
-		else {
-			ui::g_uiState.viewMode = ui::ViewMode::LeftEyeOnly;
-		}
+	presentProjection(s, last.layer, false, true);
+
+	static int synthCount = 0;
+	if (++synthCount % 90 == 1 && verboseLogging) {
+		Logf("[OXRWXR] Half-rate: synthesized frame #%d (motion vectors L=%d R=%d)", synthCount,
+			FindSpaceWarpInfo(last.views[0]) != nullptr, last.layer.viewCount > 1 && FindSpaceWarpInfo(last.views[1]) != nullptr);
 	}
 }
 
@@ -4223,10 +6385,10 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 		return;
 	}
 
-	auto it = rt::g_swapchains.find(quad->subImage.swapchain);
-	if (it == rt::g_swapchains.end()) return;
+	rt::Swapchain* quadChain = rt::g_swapchains.Get(quad->subImage.swapchain);
+	if (!quadChain) return;
 
-	auto& chain = it->second;
+	auto& chain = *quadChain;
 
 	// Get texture dimensions from the quad subImage
 	uint32_t texWidth = quad->subImage.imageRect.extent.width;
@@ -4247,7 +6409,16 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 			texIdx, chain.imageCount);
 	}
 
-	ComPtr<ID3D11Texture2D> quadTex;
+	// Quad textures and SRVs come from the blit cache, keyed on the quad swapchain
+	rt::BlitCacheEntry* quadEntry = nullptr;
+	blitcache::Key quadKey;
+	quadKey.swapchain = handles::ToBits(quad->subImage.swapchain);
+	auto createQuadEntry = [&](const D3D11_TEXTURE2D_DESC& desc) {
+		return [&s, desc](rt::BlitCacheEntry& e) {
+			if (FAILED(s.d3d11Device->CreateTexture2D(&desc, nullptr, e.texture.GetAddressOf()))) return false;
+			return SUCCEEDED(s.d3d11Device->CreateShaderResourceView(e.texture.Get(), nullptr, e.srv.GetAddressOf()));
+			};
+		};
 
 	// Check if using OpenGL
 	if (chain.backend == rt::Swapchain::Backend::OpenGL && !chain.imagesGL.empty()) {
@@ -4335,15 +6506,7 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 		}
 
 		// Flip vertically (OpenGL has Y=0 at bottom)
-		const uint32_t rowSize = texWidth * 4;
-		std::vector<uint8_t> tempRow(rowSize);
-		for (uint32_t y = 0; y < texHeight / 2; y++) {
-			uint8_t* topRow = pixels.data() + y * rowSize;
-			uint8_t* bottomRow = pixels.data() + (texHeight - 1 - y) * rowSize;
-			memcpy(tempRow.data(), topRow, rowSize);
-			memcpy(topRow, bottomRow, rowSize);
-			memcpy(bottomRow, tempRow.data(), rowSize);
-		}
+		imgk::FlipRowsInPlace(pixels.data(), (size_t)texWidth * 4, texHeight);
 
 		// Store quad layer pixels for MCP screenshot capture
 		//mcp::StoreQuadLayerPixels(pixels.data(), texWidth, texHeight);
@@ -4362,14 +6525,15 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 		texDesc.Usage = D3D11_USAGE_DEFAULT;
 		texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 
-		D3D11_SUBRESOURCE_DATA initData = {};
-		initData.pSysMem = pixels.data();
-		initData.SysMemPitch = texWidth * 4;
-
-		if (FAILED(s.d3d11Device->CreateTexture2D(&texDesc, &initData, quadTex.GetAddressOf()))) {
+		quadKey.width = texWidth;
+		quadKey.height = texHeight;
+		quadKey.format = texDesc.Format;
+		quadEntry = s.blitCache.GetOrCreate(quadKey, createQuadEntry(texDesc));
+		if (!quadEntry) {
 			if (shouldLog) Log("[OXRWXR] renderQuadLayer: Failed to create D3D11 texture from GL pixels");
 			return;
 		}
+		s.d3d11Context->UpdateSubresource(quadEntry->texture.Get(), 0, nullptr, pixels.data(), texWidth * 4, 0);
 
 		if (shouldLog && verboseLogging) {
 			Logf("[OXRWXR] Rendering quad layer (OpenGL): size=%.2fx%.2f, texSize=%ux%u, glTex=%u",
@@ -4410,22 +6574,33 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 			break; // Already typed or unknown
 		}
 
-		// Create temp texture for the quad content with typed format
+		// Temp texture for the quad content with typed format (only mip 0 / one slice is ever copied)
 		D3D11_TEXTURE2D_DESC tempDesc = srcDesc;
 		tempDesc.Format = typedFormat;  // Use typed format for the temp texture
+		tempDesc.MipLevels = 1;
+		tempDesc.ArraySize = 1;
 		tempDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		tempDesc.CPUAccessFlags = 0;
 		tempDesc.MiscFlags = 0;
 		tempDesc.SampleDesc.Count = 1;
-
-		if (FAILED(s.d3d11Device->CreateTexture2D(&tempDesc, nullptr, quadTex.GetAddressOf()))) return;
+		tempDesc.SampleDesc.Quality = 0;
 
 		// Copy the quad texture (handle array index if needed)
 		const auto& rect = quad->subImage.imageRect;
 		uint32_t arraySlice = quad->subImage.imageArrayIndex;
+
+		quadKey.imageIndex = texIdx;
+		quadKey.arraySlice = arraySlice;
+		quadKey.width = tempDesc.Width;
+		quadKey.height = tempDesc.Height;
+		quadKey.format = typedFormat;
+		quadEntry = s.blitCache.GetOrCreate(quadKey, createQuadEntry(tempDesc));
+		if (!quadEntry) return;
+		ID3D11Texture2D* quadTex = quadEntry->texture.Get();
 		D3D11_BOX box = { (UINT)rect.offset.x, (UINT)rect.offset.y, 0,
 						  (UINT)(rect.offset.x + rect.extent.width), (UINT)(rect.offset.y + rect.extent.height), 1 };
 		uint32_t srcSubresource = D3D11CalcSubresource(0, arraySlice, 1);
-		s.d3d11Context->CopySubresourceRegion(quadTex.Get(), 0, 0, 0, 0, chain.images[texIdx].Get(), srcSubresource, &box);
+		s.d3d11Context->CopySubresourceRegion(quadTex, 0, 0, 0, 0, chain.images[texIdx].Get(), srcSubresource, &box);
 
 		if (shouldLog && verboseLogging) {
 			Logf("[OXRWXR] Rendering quad layer (D3D11): size=%.2fx%.2f, texSize=%ux%u, typedFmt=%d, srcFmt=%d, arraySlice=%u",
@@ -4437,17 +6612,11 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 		return;
 	}
 
-	// Get backbuffer
-	ComPtr<ID3D11Texture2D> bb;
-	if (FAILED(s.previewSwapchain->GetBuffer(0, IID_PPV_ARGS(bb.GetAddressOf())))) return;
+	// Cached backbuffer RTV
+	ID3D11RenderTargetView* rtv = rt::GetPreviewRTV(s, false);
+	if (!rtv) return;
 
-	// Create RTV
-	ComPtr<ID3D11RenderTargetView> rtv;
-	if (FAILED(s.d3d11Device->CreateRenderTargetView(bb.Get(), nullptr, rtv.GetAddressOf()))) return;
-
-	// Create SRV
-	ComPtr<ID3D11ShaderResourceView> srv;
-	if (FAILED(s.d3d11Device->CreateShaderResourceView(quadTex.Get(), nullptr, srv.GetAddressOf()))) return;
+	ID3D11ShaderResourceView* srv = quadEntry->srv.Get();
 
 	// Calculate viewport for quad
 	// For menus, show fullscreen (or nearly fullscreen)
@@ -4474,7 +6643,7 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 	s.d3d11Context->VSSetShader(s.blitVS.Get(), nullptr, 0);
 	s.d3d11Context->PSSetShader(s.blitPS.Get(), nullptr, 0);
 
-	ID3D11ShaderResourceView* srvs[] = { srv.Get() };
+	ID3D11ShaderResourceView* srvs[] = { srv };
 	s.d3d11Context->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* samplers[] = { s.samplerState.Get() };
 	s.d3d11Context->PSSetSamplers(0, 1, samplers);
@@ -4487,7 +6656,7 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 	s.d3d11Context->OMSetDepthStencilState(nullptr, 0);
 	s.d3d11Context->RSSetState(s.noCullRS.Get());
 
-	ID3D11RenderTargetView* rtvs[1] = { rtv.Get() };
+	ID3D11RenderTargetView* rtvs[1] = { rtv };
 	s.d3d11Context->OMSetRenderTargets(1, rtvs, nullptr);
 
 	s.d3d11Context->Draw(4, 0);
@@ -4497,6 +6666,61 @@ static void renderQuadLayer(rt::Session& s, const XrCompositionLayerQuad* quad)
 	s.d3d11Context->PSSetShaderResources(0, 1, nullSRV);
 }
 
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Content signature of everything the preview composes from, so resubmitted frames (loading screens,
+// pause menus) can skip the blit and Present. The sync block's frame ID is left out on purpose: the
+// image already on screen carries the ID of the pose it was rendered for. So is the view mode under alt-eye
+// rendering: ApplyAerParity flips it every frame, and the signature would never repeat.
+static uint64_t ComputeFrameSignature(const XrFrameEndInfo& info) {
+	uint64_t h = 1469598103934665603ull;  // FNV-1a, same as the blit cache keys
+	auto mix = [&h](uint64_t v) { h ^= v; h *= 1099511628211ull; };
+	auto mixBytes = [&mix](const void* p, size_t n) {
+		const uint8_t* b = static_cast<const uint8_t*>(p);
+		for (size_t i = 0; i < n; ++i) mix(b[i]);
+	};
+	auto mixSubImage = [&](const XrSwapchainSubImage& sub) {
+		mix(handles::ToBits(sub.swapchain));
+		if (const rt::Swapchain* chain = rt::g_swapchains.Get(sub.swapchain)) {
+			mix(chain->lastReleased);
+			mix(chain->releaseGeneration);
+		}
+		mixBytes(&sub.imageRect, sizeof(sub.imageRect));
+		mix(sub.imageArrayIndex);
+	};
+
+	mix((uint64_t)ui::g_uiState.displayLayout);
+	if (!bEnableAltEyeRendering) mix((uint64_t)ui::g_uiState.viewMode);
+	mix(ui::g_uiState.showFullRender);
+	mix(((uint64_t)ui::g_uiState.windowWidth << 32) | (uint32_t)ui::g_uiState.windowHeight);
+	mix(info.layerCount);
+	for (uint32_t i = 0; i < info.layerCount; ++i) {
+		const XrCompositionLayerBaseHeader* base = info.layers[i];
+		if (!base) continue;
+		mix((uint64_t)base->type);
+		mix(base->layerFlags);
+		if (base->type == XR_TYPE_COMPOSITION_LAYER_PROJECTION) {
+			const auto* proj = reinterpret_cast<const XrCompositionLayerProjection*>(base);
+			mix(proj->viewCount);
+			for (uint32_t v = 0; v < proj->viewCount && proj->views; ++v) {
+				mixSubImage(proj->views[v].subImage);
+			}
+		}
+		else if (base->type == XR_TYPE_COMPOSITION_LAYER_QUAD) {
+			const auto* quad = reinterpret_cast<const XrCompositionLayerQuad*>(base);
+			mixSubImage(quad->subImage);
+			mixBytes(&quad->pose, sizeof(quad->pose));
+			mixBytes(&quad->size, sizeof(quad->size));
+		}
+	}
+	return h;
+}
+
+// Skip once the same content has been composed twice in a row: the repeat lets alt-eye rendering show
+// it to both eyes and the OpenGL readback ring (which displays one frame late) catch up
+static constexpr int kUnchangedFramesBeforeSkip = 2;
+
 static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* info) {
 	static int frameCount = 0;
 	frameCount++;
@@ -4517,6 +6741,10 @@ static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* in
 		Logf("[OXRWXR] xrEndFrame: layers=%u", info->layerCount);
 	}
 
+	// AER: show the eye latched for this frame's display time (the one xrLocateViews gave the app)
+	if (bEnableAltEyeRendering) rt::ApplyAerParity(info->displayTime);
+	if (bDynamicResolution) rt::NoteFrameEnd(info->displayTime);
+
 	// First pass: count layer types to know if we need to defer Present
 	int projectionCount = 0, quadCount = 0, cylinderCount = 0, otherCount = 0;
 	for (uint32_t i = 0; i < info->layerCount; ++i) {
@@ -4534,6 +6762,32 @@ static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* in
 	bool hasOverlays = (quadCount > 0 || cylinderCount > 0);
 	g_presentPending = false;
 
+	// Reprojection and half-rate warp every frame to a newer pose, so only plain composition can be skipped
+	static uint64_t lastSignature = 0;
+	static int unchangedFrames = 0;
+	if (bSkipUnchangedFrames && !bEnableReprojection && !bEnableHalfRate && projectionCount > 0) {
+		uint64_t signature = ComputeFrameSignature(*info);
+		unchangedFrames = (signature == lastSignature) ? unchangedFrames + 1 : 0;
+		lastSignature = signature;
+
+		if (unchangedFrames >= kUnchangedFramesBeforeSkip) {
+			// Keep the preview window responsive; the last Present stays on screen
+			auto& s = rt::g_session;
+			MSG msg;
+			while (PeekMessageW(&msg, s.hwnd, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessageW(&msg); }
+
+			uint64_t skipped = ++rt::g_previewCounters.skippedUnchanged;
+			if ((skipped == 1 || skipped % 600 == 0) && verboseLogging) {
+				Logf("[OXRWXR] xrEndFrame: content unchanged for %d frames, skipped %llu preview frames so far",
+					unchangedFrames, (unsigned long long)skipped);
+			}
+			return XR_SUCCESS;
+		}
+	}
+	else {
+		unchangedFrames = 0;
+	}
+
 	// Second pass: render projection layers (background)
 	// If there are overlays, skip Present until after they're rendered
 	for (uint32_t i = 0; i < info->layerCount; ++i) {
@@ -4543,6 +6797,7 @@ static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* in
 		if (base->type == XR_TYPE_COMPOSITION_LAYER_PROJECTION) {
 			const auto* proj = reinterpret_cast<const XrCompositionLayerProjection*>(base);
 			presentProjection(rt::g_session, *proj, hasOverlays);  // skipPresent if overlays pending
+			if (bEnableHalfRate) StoreSubmittedProjection(*proj);
 		}
 	}
 
@@ -4572,12 +6827,7 @@ static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* in
 		MSG msg;
 		while (PeekMessageW(&msg, s.hwnd, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessageW(&msg); }
 
-		if (s.usesD3D12 && s.previewSwapchain12) {
-			s.previewSwapchain12->Present(1, 0);
-		}
-		else if (s.previewSwapchain) {
-			s.previewSwapchain->Present(1, 0);
-		}
+		rt::PresentPreview(s);
 		g_presentPending = false;
 	}
 
@@ -4600,7 +6850,9 @@ static XrResult XRAPI_PTR xrEndFrame_runtime(XrSession, const XrFrameEndInfo* in
 }
 
 static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInfo* li, XrViewState* vs, uint32_t cap, uint32_t* outCount, XrView* views) {
-	if (outCount) *outCount = 2;
+	const uint32_t viewCount = rt::ViewCountFor(li ? li->viewConfigurationType : rt::g_session.viewConfiguration);
+	if (viewCount == 0) return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+	if (outCount) *outCount = viewCount;
 	if (vs) {
 		vs->type = XR_TYPE_VIEW_STATE;
 		// Set both VALID and TRACKED bits so Unity knows this is a real tracked HMD
@@ -4609,7 +6861,7 @@ static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInf
 			XR_VIEW_STATE_ORIENTATION_TRACKED_BIT |
 			XR_VIEW_STATE_POSITION_TRACKED_BIT;
 	}
-	if (cap < 2 || !views) return XR_SUCCESS;
+	if (cap < viewCount || !views) return XR_SUCCESS;
 	const float ipd = 0.064f;
 
 	//----------------
@@ -4643,7 +6895,7 @@ static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInf
 		return XrVector3f{ result.x, result.y, result.z };
 		};
 
-	for (uint32_t i = 0; i < 2; ++i) {
+	for (uint32_t i = 0; i < viewCount; ++i) {
 		views[i].type = XR_TYPE_VIEW;
 		views[i].pose.orientation = orientation;
 
@@ -4655,6 +6907,11 @@ static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInf
 		// Apply IPD offset in full head orientation space (yaw+pitch)
 		// This fixes stereo geometry and eliminates warping when pitching
 		float eyeOffset = (i == 0 ? -IPDVal * 0.5f : IPDVal * 0.5f);
+		if (viewCount == 1) {
+			// AER: a single view that follows the eye latched for this display time
+			eyeOffset = !bEnableAltEyeRendering ? rt::MonoViewEyeOffset(IPDVal)
+				: (rt::AerRightEyeFor(li->displayTime) ? IPDVal * 0.5f : -IPDVal * 0.5f);
+		}
 		XrVector3f localEyeOffset{ eyeOffset, 0.0f, 0.0f };
 		XrVector3f rotatedOffset = rotateVector(orientation, localEyeOffset);
 
@@ -4670,8 +6927,7 @@ static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInf
 		//int fovDeg = ui::g_uiState.fovDegrees;
 		//if (fovDeg <= 0 || fovDeg > 180) fovDeg = 90;
 		//float fovRadians = fovDeg * 0.5f * 3.14159265f / 180.0f;
-		float fovTan = tanf(FOVTotal / 2.0f); //fovRadians);
-		views[i].fov = { -fovTan, fovTan, fovTan, -fovTan };
+		views[i].fov = rt::ViewFov();
 	}
 	static int locateCount = 0;
 	if (++locateCount % 90 == 1 && verboseLogging) {  // Log every 90 frames (~1 second)
@@ -4685,28 +6941,31 @@ static XrResult XRAPI_PTR xrLocateViews_runtime(XrSession, const XrViewLocateInf
 // Add missing space/action functions for compatibility
 static XrResult XRAPI_PTR xrCreateReferenceSpace_runtime(XrSession, const XrReferenceSpaceCreateInfo* info, XrSpace* space) {
 	if (!info || !space) return XR_ERROR_VALIDATION_FAILURE;
-	static uintptr_t nextSpace = 100;
-	*space = (XrSpace)(nextSpace++);
+	rt::SpaceRecord record;
+	record.referenceType = info->referenceSpaceType;
+	*space = rt::g_spaces.Insert(record);
 	Logf("[OXRWXR] xrCreateReferenceSpace: type=%d space=%p", info->referenceSpaceType, *space);
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrDestroySpace_runtime(XrSpace space) {
+	if (!rt::g_spaces.Remove(space)) return XR_ERROR_HANDLE_INVALID;
 	Logf("[OXRWXR] xrDestroySpace: space=%p", space);
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrLocateSpace_runtime(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location) {
 	if (!location) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::SpaceRecord* record = rt::g_spaces.Get(space);
+	if (!record || !rt::g_spaces.Contains(baseSpace)) return XR_ERROR_HANDLE_INVALID;
 	location->type = XR_TYPE_SPACE_LOCATION;
 
-	if (verboseLogging) Logf("Looking for space:0x%llX", (uint64_t)space);
+	if (verboseLogging) Logf("Looking for space:0x%llX", handles::ToBits(space));
 	// Check if this is a controller space
-	auto it = rt::g_controllerSpaces.find(space);
-	if (it != rt::g_controllerSpaces.end()) {
+	if (record->controllerType > 0) {
 		if (verboseLogging) Logf("[OXRWXR] xrLocateSpace: Found controller space");
 
-		int ctrlType = it->second;
+		int ctrlType = record->controllerType;
 		const rt::ControllerState& ctrl = (ctrlType == 1) ? rt::g_leftController : rt::g_rightController;
 
 		//----------------
@@ -4715,8 +6974,8 @@ static XrResult XRAPI_PTR xrLocateSpace_runtime(XrSpace space, XrSpace baseSpace
 		// Always tracking now
 		//if (ctrl.isTracking) {
 
-		if (it->second > 0) {
-			if (verboseLogging) Logf("[OXRWXR] xrLocateSpace: it->second is > 0");
+		if (ctrlType > 0) {
+			if (verboseLogging) Logf("[OXRWXR] xrLocateSpace: ctrlType is > 0");
 
 			location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT |
 				XR_SPACE_LOCATION_ORIENTATION_VALID_BIT |
@@ -4744,7 +7003,7 @@ static XrResult XRAPI_PTR xrLocateSpace_runtime(XrSpace space, XrSpace baseSpace
 			}
 		}
 		else {
-			if (verboseLogging) Logf("[OXRWXR] xrLocateSpace: it->second is <= 0");
+			if (verboseLogging) Logf("[OXRWXR] xrLocateSpace: ctrlType is <= 0");
 			location->locationFlags = 0;
 			location->pose.orientation = { 0, 0, 0, 1 };
 			location->pose.position = { 0, 0, 0 };
@@ -4753,11 +7012,11 @@ static XrResult XRAPI_PTR xrLocateSpace_runtime(XrSpace space, XrSpace baseSpace
 	else {
 		// Default for non-controller spaces (identity pose)
 		if (verboseLogging) {
-			Logf("[OXRWXR] xrLocateSpace: it == rt::g_controllerSpaces.end()");
-			Logf("rt::g_controllerSpaces contents:");
-			for (const auto& pair : rt::g_controllerSpaces) {
-				Logf("  Space: %p, Value: %p", pair.first, pair.second);
-			}
+			Logf("[OXRWXR] xrLocateSpace: space %p is not a controller space", space);
+			Logf("rt::g_spaces contents:");
+			rt::g_spaces.ForEach([](XrSpace handle, const rt::SpaceRecord& rec) {
+				Logf("  Space: %p, Controller: %d", handle, rec.controllerType);
+				});
 		}
 		location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT;
 		location->pose.orientation = { 0, 0, 0, 1 };
@@ -4781,30 +7040,26 @@ static XrResult XRAPI_PTR xrCreateActionSpace_runtime(XrSession, const XrActionS
 	*space = (XrSpace)(dummyHandler++);*/
 
 	if (!info || !space) return XR_ERROR_VALIDATION_FAILURE;
-	static uintptr_t nextSpace = 200;
-	*space = (XrSpace)(nextSpace++);
+	if (!rt::g_actions.Contains(info->action)) return XR_ERROR_HANDLE_INVALID;
+	rt::SpaceRecord record;
+	record.isActionSpace = true;
+	*space = rt::g_spaces.Insert(record);
 
 	// Detect controller subaction paths and register the space
 	int controllerType = 0;  // 0=none, 1=left, 2=right
-	Logf("[OXRWXR] xrCreateActionSpace: subactionPath=%llu, g_pathStrings.size()=%zu",
-		(unsigned long long)info->subactionPath, rt::g_pathStrings.size());
+	Logf("[OXRWXR] xrCreateActionSpace: subactionPath=%llu", (unsigned long long)info->subactionPath);
 
 	if (info->subactionPath != XR_NULL_PATH) {
-		auto it = rt::g_pathStrings.find(info->subactionPath);
-		if (it != rt::g_pathStrings.end()) {
-			const std::string& pathStr = it->second;
-			Logf("[OXRWXR] xrCreateActionSpace: found path='%s'", pathStr.c_str());
-			if (pathStr.find("/user/hand/left") != std::string::npos) {
-				controllerType = 1;  // Left controller
-				Logf("[OXRWXR] xrCreateActionSpace: LEFT controller space %llu", (unsigned long long) * space);
-			}
-			else if (pathStr.find("/user/hand/right") != std::string::npos) {
-				controllerType = 2;  // Right controller
-				Logf("[OXRWXR] xrCreateActionSpace: RIGHT controller space %llu", (unsigned long long) * space);
-			}
+		if (info->subactionPath == rt::g_leftHandPath) {
+			controllerType = 1;  // Left controller
+			Logf("[OXRWXR] xrCreateActionSpace: LEFT controller space %llu", (unsigned long long) * space);
 		}
-		else {
-			Logf("[OXRWXR] xrCreateActionSpace: path %llu NOT FOUND in g_pathStrings", (unsigned long long)info->subactionPath);
+		else if (info->subactionPath == rt::g_rightHandPath) {
+			controllerType = 2;  // Right controller
+			Logf("[OXRWXR] xrCreateActionSpace: RIGHT controller space %llu", (unsigned long long) * space);
+		}
+		else if (!rt::g_paths.Contains(info->subactionPath)) {
+			Logf("[OXRWXR] xrCreateActionSpace: path %llu was never interned", (unsigned long long)info->subactionPath);
 		}
 	}
 	else {
@@ -4813,13 +7068,13 @@ static XrResult XRAPI_PTR xrCreateActionSpace_runtime(XrSession, const XrActionS
 
 	if (controllerType > 0) {
 		Logf("[OXRWXR] xrCreateActionSpace: space %llu controller type %d", (unsigned long long) * space, controllerType);
-		rt::g_controllerSpaces[*space] = controllerType;
+		rt::g_spaces.Get(*space)->controllerType = controllerType;
 
 		if (verboseLogging) {
-			Logf("rt::g_controllerSpaces contents:");
-			for (const auto& pair : rt::g_controllerSpaces) {
-				Logf("  Space: %p, Value: %p", pair.first, pair.second);
-			}
+			Logf("rt::g_spaces contents:");
+			rt::g_spaces.ForEach([](XrSpace handle, const rt::SpaceRecord& rec) {
+				Logf("  Space: %p, Controller: %d", handle, rec.controllerType);
+				});
 		}
 	}
 	return XR_SUCCESS;
@@ -4827,49 +7082,62 @@ static XrResult XRAPI_PTR xrCreateActionSpace_runtime(XrSession, const XrActionS
 
 static XrResult XRAPI_PTR xrCreateActionSet_runtime(XrInstance, const XrActionSetCreateInfo* info, XrActionSet* set) {
 	if (!info || !set) return XR_ERROR_VALIDATION_FAILURE;
-	static uintptr_t nextSet = 300;
-	*set = (XrActionSet)(nextSet++);
 	// actionSetName may not be null-terminated
 	char setName[XR_MAX_ACTION_SET_NAME_SIZE + 1] = { 0 };
 	memcpy(setName, info->actionSetName, XR_MAX_ACTION_SET_NAME_SIZE);
+	rt::ActionSetRecord record;
+	record.name = setName;
+	*set = rt::g_actionSets.Insert(std::move(record));
 	Logf("[OXRWXR] xrCreateActionSet: name=%s", setName);
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrDestroyActionSet_runtime(XrActionSet set) {
-	Log("[OXRWXR] xrDestroyActionSet");
+	if (!rt::g_actionSets.Remove(set)) return XR_ERROR_HANDLE_INVALID;
+	// Destroying a set destroys the actions created in it
+	std::vector<XrAction> owned;
+	rt::g_actions.ForEach([&](XrAction handle, const rt::ActionRecord& rec) {
+		if (rec.set == set) owned.push_back(handle);
+		});
+	for (XrAction action : owned) rt::g_actions.Remove(action);
+	Logf("[OXRWXR] xrDestroyActionSet: set=%p actions=%zu", set, owned.size());
 	return XR_SUCCESS;
 }
 
-static XrResult XRAPI_PTR xrCreateAction_runtime(XrActionSet, const XrActionCreateInfo* info, XrAction* action) {
+static XrResult XRAPI_PTR xrCreateAction_runtime(XrActionSet set, const XrActionCreateInfo* info, XrAction* action) {
 	if (!info || !action) return XR_ERROR_VALIDATION_FAILURE;
-	static uintptr_t nextAction = 400;
-	*action = (XrAction)(nextAction++);
+	if (!rt::g_actionSets.Contains(set)) return XR_ERROR_HANDLE_INVALID;
 	// actionName may not be null-terminated
 	char actName[XR_MAX_ACTION_NAME_SIZE + 1] = { 0 };
 	memcpy(actName, info->actionName, XR_MAX_ACTION_NAME_SIZE);
 	Logf("[OXRWXR] xrCreateAction: name=%s, type=%d", actName, info->actionType);
 
-	// Store action name for input mapping
-	rt::g_actionNames[*action] = actName;
-
 	// Detect which hand this action is bound to based on subactionPaths
 	int handBinding = 0;  // 0=both/any
 	if (info->countSubactionPaths > 0 && info->subactionPaths) {
 		for (uint32_t i = 0; i < info->countSubactionPaths; i++) {
-			auto it = rt::g_pathStrings.find(info->subactionPaths[i]);
-			if (it != rt::g_pathStrings.end()) {
-				if (it->second.find("left") != std::string::npos) handBinding |= 1;
-				if (it->second.find("right") != std::string::npos) handBinding |= 2;
-			}
+			if (info->subactionPaths[i] == rt::g_leftHandPath) handBinding |= 1;
+			if (info->subactionPaths[i] == rt::g_rightHandPath) handBinding |= 2;
 		}
 	}
-	rt::g_actionHand[*action] = handBinding;
+
+	// Store action name and hand for input mapping
+	rt::ActionRecord record;
+	record.name = actName;
+	record.hand = handBinding;
+	record.type = info->actionType;
+	record.set = set;
+	if (info->countSubactionPaths > 0 && info->subactionPaths) {
+		record.subactionPaths.assign(info->subactionPaths, info->subactionPaths + info->countSubactionPaths);
+	}
+	rt::GuessActionInputs(record);
+	*action = rt::g_actions.Insert(std::move(record));
 
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrDestroyAction_runtime(XrAction action) {
+	if (!rt::g_actions.Remove(action)) return XR_ERROR_HANDLE_INVALID;
 	Log("[OXRWXR] xrDestroyAction");
 	return XR_SUCCESS;
 }
@@ -4879,185 +7147,248 @@ static XrResult XRAPI_PTR xrSuggestInteractionProfileBindings_runtime(XrInstance
 	// interactionProfile is an XrPath (integer), not a C-string
 	Logf("[OXRWXR] xrSuggestInteractionProfileBindings: profile=0x%llx",
 		(unsigned long long)bindings->interactionProfile);
+	if (bindings->countSuggestedBindings > 0 && !bindings->suggestedBindings) return XR_ERROR_VALIDATION_FAILURE;
+
+	// A new suggestion for a profile replaces the previous one
+	std::vector<rt::SuggestedBinding> suggested;
+	suggested.reserve(bindings->countSuggestedBindings);
+	for (uint32_t i = 0; i < bindings->countSuggestedBindings; ++i) {
+		const XrActionSuggestedBinding& sb = bindings->suggestedBindings[i];
+		if (!rt::g_actions.Contains(sb.action)) return XR_ERROR_HANDLE_INVALID;
+		suggested.push_back({ sb.action, sb.binding });
+	}
+	rt::g_suggestedBindings[bindings->interactionProfile] = std::move(suggested);
 	return XR_SUCCESS;
 }
 
-static XrResult XRAPI_PTR xrAttachSessionActionSets_runtime(XrSession, const XrSessionActionSetsAttachInfo* info) {
+static XrResult XRAPI_PTR xrAttachSessionActionSets_runtime(XrSession session, const XrSessionActionSetsAttachInfo* info) {
 	if (!info) return XR_ERROR_VALIDATION_FAILURE;
 	Logf("[OXRWXR] xrAttachSessionActionSets: count=%u", info->countActionSets);
+	if (rt::CompileActionBindings()) {
+		// Apps re-query xrGetCurrentInteractionProfile on this event and switch to their native input path
+		rt::g_eventQueue.Push(events::InteractionProfileChanged(session));
+	}
 	return XR_SUCCESS;
 }
 
-// Helper to get controller state based on action and subactionPath
-static rt::ControllerState* GetControllerForAction(XrAction action, XrPath subactionPath) {
-	// First check subactionPath
-	if (subactionPath != XR_NULL_PATH) {
-		auto pathIt = rt::g_pathStrings.find(subactionPath);
-		if (pathIt != rt::g_pathStrings.end()) {
-			if (pathIt->second.find("left") != std::string::npos) return &rt::g_leftController;
-			if (pathIt->second.find("right") != std::string::npos) return &rt::g_rightController;
-		}
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// xrSyncActions samples the input compiled for each action (see rt::CompileActionBindings) from one input snapshot;
+// queries then only read the synced state, no string work and no torn reads of the live controller globals
+
+// Synced state for a query's subaction path, or nullptr (XR_ERROR_PATH_UNSUPPORTED) when the action wasn't created
+// with that path. Paths it was created with that the feed drives nothing for, such as /user/gamepad, read as inactive.
+static const actstate::Channel* SyncedChannel(const rt::ActionRecord& record, XrPath subactionPath) {
+	static const actstate::Channel kInactive{};
+	if (!rt::AcceptsSubactionPath(record, subactionPath)) return nullptr;
+	if (subactionPath == XR_NULL_PATH) return &record.synced[0];
+	if (subactionPath == rt::g_leftHandPath) return &record.synced[bindings::kHandLeft];
+	if (subactionPath == rt::g_rightHandPath) return &record.synced[bindings::kHandRight];
+	return &kInactive;
+}
+
+static bool ReadBoolean(const rt::ControllerState& ctrl, bindings::Input input) {
+	switch (input) {
+	case bindings::Input::Trigger: return ctrl.triggerPressed;
+	case bindings::Input::Squeeze: return ctrl.gripPressed;
+	case bindings::Input::Menu: return ctrl.menuPressed;
+	case bindings::Input::Primary: return ctrl.primaryPressed;
+	case bindings::Input::Secondary: return ctrl.secondaryPressed;
+	case bindings::Input::Thumbstick:
+	case bindings::Input::ThumbstickClick: return ctrl.thumbstickPressed;
+	case bindings::Input::ThumbstickX: return std::fabs(ctrl.thumbstick.x) > 0.5f;
+	case bindings::Input::ThumbstickY: return std::fabs(ctrl.thumbstick.y) > 0.5f;
+	case bindings::Input::TriggerTouch: return ctrl.triggerTouched;
+	case bindings::Input::ThumbstickTouch: return ctrl.thumbstickTouched;
+	case bindings::Input::PrimaryTouch: return ctrl.primaryTouched;
+	case bindings::Input::SecondaryTouch: return ctrl.secondaryTouched;
+	case bindings::Input::ThumbrestTouch: return ctrl.thumbrestTouched;
+	default: return false;
 	}
-	// Fall back to action's hand binding
-	auto handIt = rt::g_actionHand.find(action);
-	if (handIt != rt::g_actionHand.end()) {
-		if (handIt->second == 1) return &rt::g_leftController;
-		if (handIt->second == 2) return &rt::g_rightController;
+}
+
+static float ReadFloat(const rt::ControllerState& ctrl, bindings::Input input) {
+	switch (input) {
+	case bindings::Input::Trigger: return ctrl.triggerValue;
+	case bindings::Input::Squeeze: return ctrl.gripValue;
+	case bindings::Input::ThumbstickX: return ctrl.thumbstick.x;
+	case bindings::Input::ThumbstickY: return ctrl.thumbstick.y;
+	default: return ReadBoolean(ctrl, input) ? 1.0f : 0.0f;
 	}
-	// Default to right hand
-	return &rt::g_rightController;
 }
 
-// Helper to check if action name matches input type (case-insensitive substring match)
-static bool ActionNameMatches(const std::string& name, const char* pattern) {
-	std::string lower = name;
-	for (auto& c : lower) c = (char)tolower(c);
-	std::string patLower = pattern;
-	for (auto& c : patLower) c = (char)tolower(c);
-	return lower.find(patLower) != std::string::npos;
+static XrVector2f ReadVector2f(const rt::ControllerState& ctrl, bindings::Input input) {
+	return input == bindings::Input::Thumbstick ? ctrl.thumbstick : XrVector2f{ 0.0f, 0.0f };
+}
+
+static XrVector2f SampleInput(const rt::ControllerState& ctrl, bindings::Input input, XrActionType type) {
+	switch (type) {
+	case XR_ACTION_TYPE_BOOLEAN_INPUT: return { ReadBoolean(ctrl, input) ? 1.0f : 0.0f, 0.0f };
+	case XR_ACTION_TYPE_FLOAT_INPUT: return { ReadFloat(ctrl, input), 0.0f };
+	case XR_ACTION_TYPE_VECTOR2F_INPUT: return ReadVector2f(ctrl, input);
+	default: return { 0.0f, 0.0f };
+	}
 }
 
 static XrResult XRAPI_PTR xrGetActionStateBoolean_runtime(XrSession, const XrActionStateGetInfo* info, XrActionStateBoolean* state) {
 	if (!info || !state) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	const actstate::Channel* synced = SyncedChannel(*record, info->subactionPath);
+	if (!synced) return XR_ERROR_PATH_UNSUPPORTED;
+	const actstate::Channel& ch = *synced;
 	state->type = XR_TYPE_ACTION_STATE_BOOLEAN;
-	state->changedSinceLastSync = XR_FALSE;
-	state->lastChangeTime = 0;
-
-	// Get controller for this action
-	rt::ControllerState* ctrl = GetControllerForAction(info->action, info->subactionPath);
-
-	// Get action name to determine input type
-	bool buttonState = false;
-	auto nameIt = rt::g_actionNames.find(info->action);
-	if (nameIt != rt::g_actionNames.end()) {
-		const std::string& name = nameIt->second;
-		if (ActionNameMatches(name, "trigger") || ActionNameMatches(name, "select") || ActionNameMatches(name, "fire")) {
-			buttonState = ctrl->triggerPressed;
-		}
-		else if (ActionNameMatches(name, "grip") || ActionNameMatches(name, "squeeze") || ActionNameMatches(name, "grab")) {
-			buttonState = ctrl->gripPressed;
-		}
-		else if (ActionNameMatches(name, "menu")) {
-			buttonState = ctrl->menuPressed;
-		}
-		else if (ActionNameMatches(name, "primary") || ActionNameMatches(name, "a_button") || ActionNameMatches(name, "x_button")) {
-			buttonState = ctrl->primaryPressed;
-		}
-		else if (ActionNameMatches(name, "secondary") || ActionNameMatches(name, "b_button") || ActionNameMatches(name, "y_button")) {
-			buttonState = ctrl->secondaryPressed;
-		}
-		else if (ActionNameMatches(name, "thumbstick") || ActionNameMatches(name, "joystick")) {
-			buttonState = ctrl->thumbstickPressed;
-		}
-	}
-
-	state->currentState = buttonState ? XR_TRUE : XR_FALSE;
-	state->isActive = XR_TRUE;  // Controllers are always active in simulator
+	state->currentState = ch.value.x != 0.0f ? XR_TRUE : XR_FALSE;
+	state->changedSinceLastSync = ch.changed ? XR_TRUE : XR_FALSE;
+	state->lastChangeTime = ch.lastChangeTime;
+	state->isActive = ch.active ? XR_TRUE : XR_FALSE;
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrGetActionStateFloat_runtime(XrSession, const XrActionStateGetInfo* info, XrActionStateFloat* state) {
 	if (!info || !state) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	const actstate::Channel* synced = SyncedChannel(*record, info->subactionPath);
+	if (!synced) return XR_ERROR_PATH_UNSUPPORTED;
+	const actstate::Channel& ch = *synced;
 	state->type = XR_TYPE_ACTION_STATE_FLOAT;
-	state->changedSinceLastSync = XR_FALSE;
-	state->lastChangeTime = 0;
-
-	// Get controller for this action
-	rt::ControllerState* ctrl = GetControllerForAction(info->action, info->subactionPath);
-
-	// Get action name to determine input type
-	float floatState = 0.0f;
-	auto nameIt = rt::g_actionNames.find(info->action);
-	if (nameIt != rt::g_actionNames.end()) {
-		const std::string& name = nameIt->second;
-		if (ActionNameMatches(name, "trigger") || ActionNameMatches(name, "select") || ActionNameMatches(name, "fire")) {
-			floatState = ctrl->triggerValue;
-		}
-		else if (ActionNameMatches(name, "grip") || ActionNameMatches(name, "squeeze") || ActionNameMatches(name, "grab")) {
-			floatState = ctrl->gripValue;
-		}
-	}
-
-	state->currentState = floatState;
-	state->isActive = XR_TRUE;
+	state->currentState = ch.value.x;
+	state->changedSinceLastSync = ch.changed ? XR_TRUE : XR_FALSE;
+	state->lastChangeTime = ch.lastChangeTime;
+	state->isActive = ch.active ? XR_TRUE : XR_FALSE;
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrGetActionStatePose_runtime(XrSession, const XrActionStateGetInfo* info, XrActionStatePose* state) {
 	if (!info || !state) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	const actstate::Channel* synced = SyncedChannel(*record, info->subactionPath);
+	if (!synced) return XR_ERROR_PATH_UNSUPPORTED;
 	state->type = XR_TYPE_ACTION_STATE_POSE;
-	state->isActive = XR_TRUE;
+	state->isActive = synced->active ? XR_TRUE : XR_FALSE;
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrGetActionStateVector2f_runtime(XrSession, const XrActionStateGetInfo* info, XrActionStateVector2f* state) {
 	if (!info || !state) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	const actstate::Channel* synced = SyncedChannel(*record, info->subactionPath);
+	if (!synced) return XR_ERROR_PATH_UNSUPPORTED;
+	const actstate::Channel& ch = *synced;
 	state->type = XR_TYPE_ACTION_STATE_VECTOR2F;
-	state->changedSinceLastSync = XR_FALSE;
-	state->lastChangeTime = 0;
+	state->currentState = ch.value;
+	state->changedSinceLastSync = ch.changed ? XR_TRUE : XR_FALSE;
+	state->lastChangeTime = ch.lastChangeTime;
+	state->isActive = ch.active ? XR_TRUE : XR_FALSE;
+	return XR_SUCCESS;
+}
 
-	// Get controller for this action
-	rt::ControllerState* ctrl = GetControllerForAction(info->action, info->subactionPath);
+static XrResult XRAPI_PTR xrSyncActions_runtime(XrSession, const XrActionsSyncInfo* info) {
+	if (!info) return XR_ERROR_VALIDATION_FAILURE;
+	if (info->countActiveActionSets > 0 && !info->activeActionSets) return XR_ERROR_VALIDATION_FAILURE;
+	for (uint32_t i = 0; i < info->countActiveActionSets; ++i) {
+		if (!rt::g_actionSets.Contains(info->activeActionSets[i].actionSet)) return XR_ERROR_HANDLE_INVALID;
+	}
+
+	// One consistent copy of the input for the whole sync
+	const rt::InputSnapshot& snap = rt::g_inputSnapshots.Latest();
+
+	rt::g_actions.ForEach([&](XrAction, rt::ActionRecord& rec) {
+		// An active set entry with no subaction path activates the set for both hands
+		bool setActive[2] = { false, false };
+		for (uint32_t i = 0; i < info->countActiveActionSets; ++i) {
+			const XrActiveActionSet& active = info->activeActionSets[i];
+			if (active.actionSet != rec.set) continue;
+			if (active.subactionPath == XR_NULL_PATH || active.subactionPath == rt::g_leftHandPath) setActive[0] = true;
+			if (active.subactionPath == XR_NULL_PATH || active.subactionPath == rt::g_rightHandPath) setActive[1] = true;
+		}
+		const bool handActive[2] = {
+			setActive[0] && rec.input[0] != bindings::Input::None,
+			setActive[1] && rec.input[1] != bindings::Input::None,
+		};
+		const XrVector2f zero{ 0.0f, 0.0f };
+		const XrVector2f handValue[2] = {
+			handActive[0] ? SampleInput(snap.left, rec.input[0], rec.type) : zero,
+			handActive[1] ? SampleInput(snap.right, rec.input[1], rec.type) : zero,
+		};
 
-	// Get action name to determine input type
-	auto nameIt = rt::g_actionNames.find(info->action);
-	if (nameIt != rt::g_actionNames.end()) {
-		const std::string& name = nameIt->second;
-		if (ActionNameMatches(name, "thumbstick") || ActionNameMatches(name, "joystick") ||
-			ActionNameMatches(name, "move") || ActionNameMatches(name, "turn")) {
-			state->currentState = ctrl->thumbstick;
+		// Without a subaction path: bound actions combine both hands, name-guessed ones read their default hand
+		bool anyActive;
+		XrVector2f anyValue;
+		if (rec.fromBindings) {
+			anyActive = handActive[0] || handActive[1];
+			anyValue = actstate::Combine(rec.type, handValue[0], handValue[1]);
 		}
 		else {
-			state->currentState = { 0.0f, 0.0f };
+			int h = rec.defaultHand - 1;
+			anyActive = handActive[h];
+			anyValue = handValue[h];
 		}
-	}
-	else {
-		state->currentState = { 0.0f, 0.0f };
-	}
-
-	state->isActive = XR_TRUE;
-	return XR_SUCCESS;
-}
 
-static XrResult XRAPI_PTR xrSyncActions_runtime(XrSession, const XrActionsSyncInfo* info) {
-	if (!info) return XR_ERROR_VALIDATION_FAILURE;
+		actstate::Update(rec.synced[0], anyValue, anyActive, snap.time);
+		actstate::Update(rec.synced[1], handValue[0], handActive[0], snap.time);
+		actstate::Update(rec.synced[2], handValue[1], handActive[1], snap.time);
+		});
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrStringToPath_runtime(XrInstance, const char* pathString, XrPath* path) {
 	if (!pathString || !path) return XR_ERROR_VALIDATION_FAILURE;
-	// Simple hash as path ID
-	size_t hash = 5381;
-	for (const char* c = pathString; *c; ++c) {
-		hash = ((hash << 5) + hash) + *c;
-	}
-	*path = (XrPath)hash;
-	// Store path string for controller detection
-	rt::g_pathStrings[*path] = pathString;
-	Logf("[OXRWXR] xrStringToPath: %s -> %llu", pathString, (unsigned long long) * path);
+	std::string_view str(pathString, strnlen(pathString, XR_MAX_PATH_LENGTH));
+	if (!paths::IsWellFormed(str)) return XR_ERROR_PATH_FORMAT_INVALID;
+	*path = rt::g_paths.Intern(str);
+	if (verboseLogging) Logf("[OXRWXR] xrStringToPath: %s -> %llu", pathString, (unsigned long long) * path);
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrPathToString_runtime(XrInstance, XrPath path, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) {
-	const char* str = "/unknown/path";
-	size_t len = strlen(str) + 1;
-	if (bufferCountOutput) *bufferCountOutput = (uint32_t)len;
-	if (buffer && bufferCapacityInput > 0) {
-		strncpy(buffer, str, bufferCapacityInput - 1);
-		buffer[bufferCapacityInput - 1] = '\0';
-	}
+	if (!bufferCountOutput) return XR_ERROR_VALIDATION_FAILURE;
+	std::string_view str = rt::g_paths.View(path);
+	if (str.empty()) return XR_ERROR_PATH_INVALID;
+	*bufferCountOutput = (uint32_t)str.size() + 1;
+	if (bufferCapacityInput == 0) return XR_SUCCESS;
+	if (bufferCapacityInput < *bufferCountOutput) return XR_ERROR_SIZE_INSUFFICIENT;
+	if (!buffer) return XR_ERROR_VALIDATION_FAILURE;
+	memcpy(buffer, str.data(), str.size());
+	buffer[str.size()] = '\0';
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrGetCurrentInteractionProfile_runtime(XrSession, XrPath topLevelUserPath, XrInteractionProfileState* interactionProfile) {
 	if (!interactionProfile) return XR_ERROR_VALIDATION_FAILURE;
+	if (!rt::g_paths.Contains(topLevelUserPath)) return XR_ERROR_PATH_INVALID;
 	interactionProfile->type = XR_TYPE_INTERACTION_PROFILE_STATE;
-	interactionProfile->interactionProfile = XR_NULL_PATH;
+	// Only the hands have controllers behind them
+	const bool hand = topLevelUserPath == rt::g_leftHandPath || topLevelUserPath == rt::g_rightHandPath;
+	interactionProfile->interactionProfile = hand ? rt::g_boundProfile : XR_NULL_PATH;
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrEnumerateBoundSourcesForAction_runtime(XrSession, const XrBoundSourcesForActionEnumerateInfo* info, uint32_t sourceCapacityInput, uint32_t* sourceCountOutput, XrPath* sources) {
-	if (sourceCountOutput) *sourceCountOutput = 0;
+	if (!info || !sourceCountOutput) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+
+	// The bound profile's suggestions for this action that actually resolve to an input
+	std::vector<XrPath> bound;
+	auto it = rt::g_suggestedBindings.find(rt::g_boundProfile);
+	if (it != rt::g_suggestedBindings.end()) {
+		const rt::CompiledProfile* profile = rt::FindInteractionProfile(rt::g_boundProfile);
+		for (const rt::SuggestedBinding& sb : it->second) {
+			bindings::Binding b;
+			if (sb.action == info->action && rt::ResolveBinding(profile, sb.binding, record->type, b)) bound.push_back(sb.binding);
+		}
+	}
+
+	*sourceCountOutput = (uint32_t)bound.size();
+	if (sourceCapacityInput == 0) return XR_SUCCESS;
+	if (sourceCapacityInput < bound.size()) return XR_ERROR_SIZE_INSUFFICIENT;
+	if (!sources) return XR_ERROR_VALIDATION_FAILURE;
+	std::copy(bound.begin(), bound.end(), sources);
 	return XR_SUCCESS;
 }
 
@@ -5073,24 +7404,45 @@ static XrResult XRAPI_PTR xrGetInputSourceLocalizedName_runtime(XrSession, const
 }
 
 static XrResult XRAPI_PTR xrDestroySwapchain_runtime(XrSwapchain sc) {
-	auto it = rt::g_swapchains.find(sc);
-	if (it == rt::g_swapchains.end()) return XR_ERROR_HANDLE_INVALID;
+	rt::Swapchain* chainPtr = rt::g_swapchains.Get(sc);
+	if (!chainPtr) return XR_ERROR_HANDLE_INVALID;
 
-	// For OpenGL swapchains, delete the textures
-	if (it->second.backend == rt::Swapchain::Backend::OpenGL && !it->second.imagesGL.empty()) {
-		// Make app's GL context current if available
-		HGLRC prevRC = wglGetCurrentContext();
-		HDC prevDC = wglGetCurrentDC();
-		if (rt::g_session.glDC && rt::g_session.glRC) {
-			wglMakeCurrent(rt::g_session.glDC, rt::g_session.glRC);
-		}
-		for (GLuint tex : it->second.imagesGL) {
-			glDeleteTextures(1, &tex);
-		}
-		if (prevRC) wglMakeCurrent(prevDC, prevRC);
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	// Images go back to the pool; only what it evicts to stay within budget is actually freed
+	rt::Swapchain& chain = *chainPtr;
+	std::vector<rt::PooledImage> evicted;
+	auto giveToPool = [&](rt::PooledImage image) {
+		image.device = chain.poolKey.device;
+		rt::g_texturePool.Give(chain.poolKey, std::move(image), chain.poolImageBytes, evicted);
+		};
+	for (auto& tex : chain.images) {
+		rt::PooledImage image;
+		image.d3d11 = std::move(tex);
+		giveToPool(std::move(image));
+	}
+	for (size_t i = 0; i < chain.images12.size(); ++i) {
+		rt::PooledImage image;
+		image.d3d12 = std::move(chain.images12[i]);
+		image.state12 = i < chain.imageStates12.size() ? chain.imageStates12[i] : D3D12_RESOURCE_STATE_COMMON;
+		giveToPool(std::move(image));
 	}
+	for (GLuint tex : chain.imagesGL) {
+		rt::PooledImage image;
+		image.gl = tex;
+		giveToPool(std::move(image));
+	}
+	rt::ReleasePooledImages(evicted);
+	rt::LogTexturePoolStats("destroy");
+
+	//----------------
+	//OXRWXR CHANGE:
+	//---------------- 
+	//  Drop cached blit resources, the slot (under a new generation) can be handed out again
+	rt::g_session.blitCache.InvalidateSwapchain(handles::ToBits(sc));
 
-	rt::g_swapchains.erase(it);
+	rt::g_swapchains.Remove(sc);
 	Logf("[OXRWXR] xrDestroySwapchain: sc=%p", sc);
 	return XR_SUCCESS;
 }
@@ -5120,6 +7472,7 @@ static XrResult XRAPI_PTR xrGetReferenceSpaceBoundsRect_runtime(XrSession, XrRef
 static XrResult XRAPI_PTR xrGetViewConfigurationProperties_runtime(XrInstance, XrSystemId, XrViewConfigurationType type,
 	XrViewConfigurationProperties* props) {
 	if (!props) return XR_ERROR_VALIDATION_FAILURE;
+	if (rt::ViewCountFor(type) == 0) return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
 	props->type = XR_TYPE_VIEW_CONFIGURATION_PROPERTIES;
 	props->viewConfigurationType = type;
 	props->fovMutable = XR_FALSE;
@@ -5127,24 +7480,186 @@ static XrResult XRAPI_PTR xrGetViewConfigurationProperties_runtime(XrInstance, X
 	return XR_SUCCESS;
 }
 
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// XR_KHR_visibility_mask: two-call idiom for vertices and indices
+static XrResult XRAPI_PTR xrGetVisibilityMaskKHR_runtime(XrSession, XrViewConfigurationType viewConfigurationType, uint32_t viewIndex,
+	XrVisibilityMaskTypeKHR maskType, XrVisibilityMaskKHR* mask) {
+	if (!mask) return XR_ERROR_VALIDATION_FAILURE;
+	const uint32_t viewCount = rt::ViewCountFor(viewConfigurationType);
+	if (viewCount == 0) return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+	if (viewIndex >= viewCount) return XR_ERROR_VALIDATION_FAILURE;
+
+	const float nasalSign = (viewCount == 1) ? 0.0f : (viewIndex == 0 ? 1.0f : -1.0f);
+	const vismask::Meshes& meshes = rt::g_visibilityMasks.Get(vismask::FindLens(hmdMake, hmdModel), rt::ViewFov(), nasalSign);
+	const vismask::Mesh* mesh = nullptr;
+	switch (maskType) {
+	case XR_VISIBILITY_MASK_TYPE_HIDDEN_TRIANGLE_MESH_KHR: mesh = &meshes.hidden; break;
+	case XR_VISIBILITY_MASK_TYPE_VISIBLE_TRIANGLE_MESH_KHR: mesh = &meshes.visible; break;
+	case XR_VISIBILITY_MASK_TYPE_LINE_LOOP_KHR: mesh = &meshes.lineLoop; break;
+	default: return XR_ERROR_VALIDATION_FAILURE;
+	}
+
+	const uint32_t vertexCount = (uint32_t)mesh->vertices.size();
+	const uint32_t indexCount = (uint32_t)mesh->indices.size();
+	mask->vertexCountOutput = vertexCount;
+	mask->indexCountOutput = indexCount;
+	if (mask->vertexCapacityInput == 0 && mask->indexCapacityInput == 0) return XR_SUCCESS;
+	if (mask->vertexCapacityInput < vertexCount || mask->indexCapacityInput < indexCount) return XR_ERROR_SIZE_INSUFFICIENT;
+	if (!mask->vertices || !mask->indices) return XR_ERROR_VALIDATION_FAILURE;
+	std::memcpy(mask->vertices, mesh->vertices.data(), vertexCount * sizeof(XrVector2f));
+	std::memcpy(mask->indices, mesh->indices.data(), indexCount * sizeof(uint32_t));
+
+	static bool logged = false;
+	if (!logged) {
+		Logf("[OXRWXR] xrGetVisibilityMaskKHR: %s/%s lens, %.0f%% of each view hidden",
+			hmdMake.c_str(), hmdModel.c_str(), (1.0f - meshes.visibleFraction) * 100.0f);
+		logged = true;
+	}
+	return XR_SUCCESS;
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// XR_META_recommended_layer_resolution: the governor's scaled baseline, never larger than the layer's swapchains
+static XrResult XRAPI_PTR xrGetRecommendedLayerResolutionMETA_runtime(XrSession, const XrRecommendedLayerResolutionGetInfoMETA* info,
+	XrRecommendedLayerResolutionMETA* resolution) {
+	if (!info || !resolution || !info->layer) return XR_ERROR_VALIDATION_FAILURE;
+	resolution->recommendedImageDimensions = { 0, 0 };
+	resolution->isValid = XR_FALSE;
+	if (!bDynamicResolution || info->layer->type != XR_TYPE_COMPOSITION_LAYER_PROJECTION) return XR_SUCCESS;
+
+	const auto* proj = reinterpret_cast<const XrCompositionLayerProjection*>(info->layer);
+	if (proj->viewCount < 1 || !proj->views) return XR_SUCCESS;
+	uint32_t maxWidth = UINT32_MAX, maxHeight = UINT32_MAX;
+	for (uint32_t i = 0; i < proj->viewCount; ++i) {
+		const rt::Swapchain* chain = rt::g_swapchains.Get(proj->views[i].subImage.swapchain);
+		if (!chain) return XR_ERROR_HANDLE_INVALID;
+		maxWidth = std::min(maxWidth, chain->width);
+		maxHeight = std::min(maxHeight, chain->height);
+	}
+
+	uint32_t width, height;
+	const resgov::Baseline& base = rt::EyeBaseline();
+	rt::g_resolutionGovernor.Extent(base.width, base.height, width, height);
+	resolution->recommendedImageDimensions.width = (int32_t)std::min(width, maxWidth);
+	resolution->recommendedImageDimensions.height = (int32_t)std::min(height, maxHeight);
+	resolution->isValid = XR_TRUE;
+	return XR_SUCCESS;
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Hands a haptic call addresses: its subaction path, else every hand the action was created for
+static void HapticHands(const XrHapticActionInfo& info, const rt::ActionRecord& record, bool (&hands)[haptics::kHandCount]) {
+	if (info.subactionPath == rt::g_leftHandPath || info.subactionPath == rt::g_rightHandPath) {
+		hands[0] = info.subactionPath == rt::g_leftHandPath;
+		hands[1] = !hands[0];
+		return;
+	}
+	hands[0] = record.hand == 0 || (record.hand & 1);
+	hands[1] = record.hand == 0 || (record.hand & 2);
+}
+
 static XrResult XRAPI_PTR xrApplyHapticFeedback_runtime(XrSession, const XrHapticActionInfo* info, const XrHapticBaseHeader* haptic) {
-	if (udpReader) {
-		if (sendHaptics) {
-			udpReader->SendData("1 1 1 " + aerMode + " " + std::to_string(fovVarE) + " " + std::to_string(fovVarF));
-		}
-		else {
-			udpReader->SendData("0 0 1 " + aerMode + " " + std::to_string(fovVarE) + " " + std::to_string(fovVarF));
+	if (!info || !haptic) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	if (record->type != XR_ACTION_TYPE_VIBRATION_OUTPUT) return XR_ERROR_ACTION_TYPE_MISMATCH;
+	if (!rt::AcceptsSubactionPath(*record, info->subactionPath)) return XR_ERROR_PATH_UNSUPPORTED;
+	if (haptic->type != XR_TYPE_HAPTIC_VIBRATION || !sendHaptics) return XR_SUCCESS;
+
+	const XrHapticVibration* vibration = reinterpret_cast<const XrHapticVibration*>(haptic);
+	bool hands[haptics::kHandCount];
+	HapticHands(*info, *record, hands);
+	std::lock_guard<std::mutex> lock(rt::g_hapticsMutex);
+	for (int h = 0; h < haptics::kHandCount; ++h) {
+		if (hands[h]) {
+			rt::g_haptics.Apply(h, handles::ToBits(info->action), vibration->duration, vibration->amplitude, vibration->frequency);
 		}
 	}
-
 	return XR_SUCCESS;
 }
 
 static XrResult XRAPI_PTR xrStopHapticFeedback_runtime(XrSession, const XrHapticActionInfo* info) {
-	if (udpReader) {
-		udpReader->SendData("0 0 1 " + aerMode + " " + std::to_string(fovVarE) + " " + std::to_string(fovVarF));
+	if (!info) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::ActionRecord* record = rt::g_actions.Get(info->action);
+	if (!record) return XR_ERROR_HANDLE_INVALID;
+	if (record->type != XR_ACTION_TYPE_VIBRATION_OUTPUT) return XR_ERROR_ACTION_TYPE_MISMATCH;
+	if (!rt::AcceptsSubactionPath(*record, info->subactionPath)) return XR_ERROR_PATH_UNSUPPORTED;
+
+	bool hands[haptics::kHandCount];
+	HapticHands(*info, *record, hands);
+	std::lock_guard<std::mutex> lock(rt::g_hapticsMutex);
+	for (int h = 0; h < haptics::kHandCount; ++h) {
+		if (hands[h]) rt::g_haptics.Stop(h, handles::ToBits(info->action));
+	}
+	return XR_SUCCESS;
+}
+
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// XR_EXT_hand_tracking
+static XrResult XRAPI_PTR xrCreateHandTrackerEXT_runtime(XrSession session, const XrHandTrackerCreateInfoEXT* info, XrHandTrackerEXT* handTracker) {
+	if (!info || !handTracker) return XR_ERROR_VALIDATION_FAILURE;
+	if (!rt::HandTrackingEnabled()) return XR_ERROR_FUNCTION_UNSUPPORTED;
+	if (session != rt::g_session.handle) return XR_ERROR_HANDLE_INVALID;
+	if (info->hand != XR_HAND_LEFT_EXT && info->hand != XR_HAND_RIGHT_EXT) return XR_ERROR_VALIDATION_FAILURE;
+	if (info->handJointSet != XR_HAND_JOINT_SET_DEFAULT_EXT) return XR_ERROR_VALIDATION_FAILURE;
+
+	rt::HandTrackerRecord record;
+	record.hand = info->hand;
+	*handTracker = rt::g_handTrackers.Insert(record);
+	Logf("[OXRWXR] xrCreateHandTrackerEXT: %s hand", info->hand == XR_HAND_LEFT_EXT ? "left" : "right");
+	return XR_SUCCESS;
+}
+
+static XrResult XRAPI_PTR xrDestroyHandTrackerEXT_runtime(XrHandTrackerEXT handTracker) {
+	return rt::g_handTrackers.Remove(handTracker) ? XR_SUCCESS : XR_ERROR_HANDLE_INVALID;
+}
+
+// Joints follow the controller pose of their hand, like the action spaces (base space is not applied there either)
+static XrResult XRAPI_PTR xrLocateHandJointsEXT_runtime(XrHandTrackerEXT handTracker, const XrHandJointsLocateInfoEXT* info,
+	XrHandJointLocationsEXT* locations) {
+	if (!info || !locations) return XR_ERROR_VALIDATION_FAILURE;
+	const rt::HandTrackerRecord* record = rt::g_handTrackers.Get(handTracker);
+	if (!record || !rt::g_spaces.Contains(info->baseSpace)) return XR_ERROR_HANDLE_INVALID;
+	if (locations->jointCount != handjoints::kJointCount || !locations->jointLocations) return XR_ERROR_VALIDATION_FAILURE;
+
+	XrHandJointVelocitiesEXT* velocities = nullptr;
+	for (auto* next = reinterpret_cast<XrBaseOutStructure*>(locations->next); next; next = next->next) {
+		if (next->type == XR_TYPE_HAND_JOINT_VELOCITIES_EXT) velocities = reinterpret_cast<XrHandJointVelocitiesEXT*>(next);
+	}
+	if (velocities && (velocities->jointCount != handjoints::kJointCount || !velocities->jointVelocities)) return XR_ERROR_VALIDATION_FAILURE;
+
+	const bool right = record->hand == XR_HAND_RIGHT_EXT;
+	const rt::ControllerState& ctrl = right ? rt::g_rightController : rt::g_leftController;
+	XrPosef base;
+	rt::GetControllerPose(ctrl, &base, right);
+
+	locations->isActive = XR_TRUE;
+	{
+		std::lock_guard<std::mutex> lock(rt::g_handJointsMutex);
+		const rt::HandJoints& joints = rt::g_handJoints[right ? 1 : 0];
+		// A posed model hand is a valid guess, but only the headset's own joints count as tracked
+		XrSpaceLocationFlags flags = XR_SPACE_LOCATION_POSITION_VALID_BIT | XR_SPACE_LOCATION_ORIENTATION_VALID_BIT;
+		if (joints.fromHeadset) flags |= XR_SPACE_LOCATION_POSITION_TRACKED_BIT | XR_SPACE_LOCATION_ORIENTATION_TRACKED_BIT;
+		handjoints::Transform(base, joints.local, locations->jointLocations, handjoints::kJointCount, flags);
 	}
 
+	// The feed has no per-joint motion; every joint moves with the controller
+	if (velocities) {
+		for (uint32_t i = 0; i < handjoints::kJointCount; ++i) {
+			XrHandJointVelocityEXT& v = velocities->jointVelocities[i];
+			v.velocityFlags = XR_SPACE_VELOCITY_LINEAR_VALID_BIT | XR_SPACE_VELOCITY_ANGULAR_VALID_BIT;
+			v.linearVelocity = ctrl.linearVelocity;
+			v.angularVelocity = ctrl.angularVelocity;
+		}
+	}
 	return XR_SUCCESS;
 }
 
@@ -5177,77 +7692,21 @@ static XrResult XRAPI_PTR xrConvertTimeToWin32PerformanceCounterKHR_runtime(XrIn
 
 // ----------------------------------------------
 
-struct NameFn { const char* name; PFN_xrVoidFunction fn; };
-
-static const NameFn kFnTable[] = {
-	{"xrGetInstanceProcAddr", (PFN_xrVoidFunction)xrGetInstanceProcAddr_runtime},
-	{"xrEnumerateApiLayerProperties", (PFN_xrVoidFunction)xrEnumerateApiLayerProperties_runtime},
-	{"xrEnumerateInstanceExtensionProperties", (PFN_xrVoidFunction)xrEnumerateInstanceExtensionProperties_runtime},
-	{"xrCreateInstance", (PFN_xrVoidFunction)xrCreateInstance_runtime},
-	{"xrDestroyInstance", (PFN_xrVoidFunction)xrDestroyInstance_runtime},
-	{"xrGetInstanceProperties", (PFN_xrVoidFunction)xrGetInstanceProperties_runtime},
-	{"xrGetSystem", (PFN_xrVoidFunction)xrGetSystem_runtime},
-	{"xrGetSystemProperties", (PFN_xrVoidFunction)xrGetSystemProperties_runtime},
-	{"xrEnumerateViewConfigurations", (PFN_xrVoidFunction)xrEnumerateViewConfigurations_runtime},
-	{"xrEnumerateViewConfigurationViews", (PFN_xrVoidFunction)xrEnumerateViewConfigurationViews_runtime},
-	{"xrEnumerateEnvironmentBlendModes", (PFN_xrVoidFunction)xrEnumerateEnvironmentBlendModes_runtime},
-	{"xrCreateSession", (PFN_xrVoidFunction)xrCreateSession_runtime},
-	{"xrDestroySession", (PFN_xrVoidFunction)xrDestroySession_runtime},
-	{"xrEnumerateSwapchainFormats", (PFN_xrVoidFunction)xrEnumerateSwapchainFormats_runtime},
-	{"xrCreateSwapchain", (PFN_xrVoidFunction)xrCreateSwapchain_runtime},
-	{"xrDestroySwapchain", (PFN_xrVoidFunction)xrDestroySwapchain_runtime},
-	{"xrEnumerateSwapchainImages", (PFN_xrVoidFunction)xrEnumerateSwapchainImages_runtime},
-	{"xrAcquireSwapchainImage", (PFN_xrVoidFunction)xrAcquireSwapchainImage_runtime},
-	{"xrWaitSwapchainImage", (PFN_xrVoidFunction)xrWaitSwapchainImage_runtime},
-	{"xrReleaseSwapchainImage", (PFN_xrVoidFunction)xrReleaseSwapchainImage_runtime},
-	{"xrBeginSession", (PFN_xrVoidFunction)xrBeginSession_runtime},
-	{"xrEndSession", (PFN_xrVoidFunction)xrEndSession_runtime},
-	{"xrWaitFrame", (PFN_xrVoidFunction)xrWaitFrame_runtime},
-	{"xrBeginFrame", (PFN_xrVoidFunction)xrBeginFrame_runtime},
-	{"xrEndFrame", (PFN_xrVoidFunction)xrEndFrame_runtime},
-	{"xrPollEvent", (PFN_xrVoidFunction)xrPollEvent_runtime},
-	{"xrLocateViews", (PFN_xrVoidFunction)xrLocateViews_runtime},
-	{"xrGetD3D11GraphicsRequirementsKHR", (PFN_xrVoidFunction)xrGetD3D11GraphicsRequirementsKHR_runtime},
-	{"xrGetD3D12GraphicsRequirementsKHR", (PFN_xrVoidFunction)xrGetD3D12GraphicsRequirementsKHR_runtime},
-	{"xrGetOpenGLGraphicsRequirementsKHR", (PFN_xrVoidFunction)xrGetOpenGLGraphicsRequirementsKHR_runtime},
-	{"xrRequestExitSession", (PFN_xrVoidFunction)xrRequestExitSession_runtime},
-	// Space functions
-	{"xrCreateReferenceSpace", (PFN_xrVoidFunction)xrCreateReferenceSpace_runtime},
-	{"xrDestroySpace", (PFN_xrVoidFunction)xrDestroySpace_runtime},
-	{"xrLocateSpace", (PFN_xrVoidFunction)xrLocateSpace_runtime},
-	{"xrEnumerateReferenceSpaces", (PFN_xrVoidFunction)xrEnumerateReferenceSpaces_runtime},
-	{"xrCreateActionSpace", (PFN_xrVoidFunction)xrCreateActionSpace_runtime},
-	// Action functions
-	{"xrCreateActionSet", (PFN_xrVoidFunction)xrCreateActionSet_runtime},
-	{"xrDestroyActionSet", (PFN_xrVoidFunction)xrDestroyActionSet_runtime},
-	{"xrCreateAction", (PFN_xrVoidFunction)xrCreateAction_runtime},
-	{"xrDestroyAction", (PFN_xrVoidFunction)xrDestroyAction_runtime},
-	{"xrSuggestInteractionProfileBindings", (PFN_xrVoidFunction)xrSuggestInteractionProfileBindings_runtime},
-	{"xrAttachSessionActionSets", (PFN_xrVoidFunction)xrAttachSessionActionSets_runtime},
-	{"xrGetActionStateBoolean", (PFN_xrVoidFunction)xrGetActionStateBoolean_runtime},
-	{"xrGetActionStateFloat", (PFN_xrVoidFunction)xrGetActionStateFloat_runtime},
-	{"xrGetActionStatePose", (PFN_xrVoidFunction)xrGetActionStatePose_runtime},
-	{"xrGetActionStateVector2f", (PFN_xrVoidFunction)xrGetActionStateVector2f_runtime},
-	{"xrSyncActions", (PFN_xrVoidFunction)xrSyncActions_runtime},
-	// Path functions
-	{"xrStringToPath", (PFN_xrVoidFunction)xrStringToPath_runtime},
-	{"xrPathToString", (PFN_xrVoidFunction)xrPathToString_runtime},
-	// Interaction functions
-	{"xrGetCurrentInteractionProfile", (PFN_xrVoidFunction)xrGetCurrentInteractionProfile_runtime},
-	{"xrEnumerateBoundSourcesForAction", (PFN_xrVoidFunction)xrEnumerateBoundSourcesForAction_runtime},
-	{"xrGetInputSourceLocalizedName", (PFN_xrVoidFunction)xrGetInputSourceLocalizedName_runtime},
-	// Utility functions
-	{"xrResultToString", (PFN_xrVoidFunction)xrResultToString_runtime},
-	{"xrStructureTypeToString", (PFN_xrVoidFunction)xrStructureTypeToString_runtime},
-	{"xrGetReferenceSpaceBoundsRect", (PFN_xrVoidFunction)xrGetReferenceSpaceBoundsRect_runtime},
-	{"xrGetViewConfigurationProperties", (PFN_xrVoidFunction)xrGetViewConfigurationProperties_runtime},
-	// Haptic functions
-	{"xrApplyHapticFeedback", (PFN_xrVoidFunction)xrApplyHapticFeedback_runtime},
-	{"xrStopHapticFeedback", (PFN_xrVoidFunction)xrStopHapticFeedback_runtime},
-	// Time conversion functions
-	{"xrConvertWin32PerformanceCounterToTimeKHR", (PFN_xrVoidFunction)xrConvertWin32PerformanceCounterToTimeKHR_runtime},
-	{"xrConvertTimeToWin32PerformanceCounterKHR", (PFN_xrVoidFunction)xrConvertTimeToWin32PerformanceCounterKHR_runtime},
-};
+//----------------
+//OXRWXR CHANGE:
+//---------------- 
+// Every exported entry point (runtime_functions.h) resolves to xrName_runtime. Names and pointers are expanded from
+// that one list so they can't drift apart, and the names feed a perfect hash built at compile time.
+#define OXRWXR_FN_NAME(fn) #fn,
+#define OXRWXR_FN_POINTER(fn) (PFN_xrVoidFunction)fn##_runtime,
+
+static constexpr std::string_view kFnNames[] = { OXRWXR_RUNTIME_FUNCTIONS(OXRWXR_FN_NAME) };
+static const PFN_xrVoidFunction kFnPointers[] = { OXRWXR_RUNTIME_FUNCTIONS(OXRWXR_FN_POINTER) };
+static constexpr auto kFnHash = procdispatch::Build(kFnNames);
+static_assert(kFnHash.Ok(), "OXRWXR_RUNTIME_FUNCTIONS lists a function twice");
+
+#undef OXRWXR_FN_NAME
+#undef OXRWXR_FN_POINTER
 
 static XrResult XRAPI_PTR xrGetInstanceProcAddr_runtime(XrInstance instance, const char* name, PFN_xrVoidFunction* fn) {
 	if (!name || !fn) {
@@ -5255,23 +7714,14 @@ static XrResult XRAPI_PTR xrGetInstanceProcAddr_runtime(XrInstance instance, con
 		return XR_ERROR_VALIDATION_FAILURE;
 	}
 
-	// Reduce logging verbosity for xrGetInstanceProcAddr
-	static bool reduceLogging = false;
-	static int callCount = 0;
-	callCount++;
-
-	for (auto& e : kFnTable) {
-		if (strcmp(name, e.name) == 0) {
-			*fn = e.fn;
-			if (callCount < 100 || strstr(name, "D3D11") || strstr(name, "Create") || strstr(name, "Destroy")) {
-				Logf("[OXRWXR] xrGetInstanceProcAddr: %s -> FOUND", name);
-			}
-			return XR_SUCCESS;
-		}
+	// Loaders resolve hundreds of names at startup and some layers re-resolve every frame: one hash, one compare
+	const size_t index = kFnHash.Find(name);
+	if (index < std::size(kFnNames)) {
+		*fn = kFnPointers[index];
+		if (verboseLogging) Logf("[OXRWXR] xrGetInstanceProcAddr: %s -> FOUND", name);
+		return XR_SUCCESS;
 	}
 
-	if (callCount < 100 || strstr(name, "D3D11")) {
-		Logf("[OXRWXR] xrGetInstanceProcAddr: %s -> NOT FOUND", name);
-	}
+	if (verboseLogging) Logf("[OXRWXR] xrGetInstanceProcAddr: %s -> NOT FOUND", name);
 	return XR_ERROR_FUNCTION_UNSUPPORTED;
 }
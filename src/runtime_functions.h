@@ -0,0 +1,78 @@
+// Entry points exported by OpenXR WXR
+// X(xrName) for every function xrGetInstanceProcAddr resolves; runtime.cpp maps each to xrName_runtime, the tests walk the names
+#pragma once
+
+#define OXRWXR_RUNTIME_FUNCTIONS(X) \
+    X(xrGetInstanceProcAddr) \
+    X(xrEnumerateApiLayerProperties) \
+    X(xrEnumerateInstanceExtensionProperties) \
+    X(xrCreateInstance) \
+    X(xrDestroyInstance) \
+    X(xrGetInstanceProperties) \
+    X(xrGetSystem) \
+    X(xrGetSystemProperties) \
+    X(xrEnumerateViewConfigurations) \
+    X(xrEnumerateViewConfigurationViews) \
+    X(xrEnumerateEnvironmentBlendModes) \
+    X(xrCreateSession) \
+    X(xrDestroySession) \
+    X(xrEnumerateSwapchainFormats) \
+    X(xrCreateSwapchain) \
+    X(xrDestroySwapchain) \
+    X(xrEnumerateSwapchainImages) \
+    X(xrAcquireSwapchainImage) \
+    X(xrWaitSwapchainImage) \
+    X(xrReleaseSwapchainImage) \
+    X(xrBeginSession) \
+    X(xrEndSession) \
+    X(xrWaitFrame) \
+    X(xrBeginFrame) \
+    X(xrEndFrame) \
+    X(xrPollEvent) \
+    X(xrLocateViews) \
+    X(xrGetD3D11GraphicsRequirementsKHR) \
+    X(xrGetD3D12GraphicsRequirementsKHR) \
+    X(xrGetOpenGLGraphicsRequirementsKHR) \
+    X(xrRequestExitSession) \
+    /* Space functions */ \
+    X(xrCreateReferenceSpace) \
+    X(xrDestroySpace) \
+    X(xrLocateSpace) \
+    X(xrEnumerateReferenceSpaces) \
+    X(xrCreateActionSpace) \
+    /* Action functions */ \
+    X(xrCreateActionSet) \
+    X(xrDestroyActionSet) \
+    X(xrCreateAction) \
+    X(xrDestroyAction) \
+    X(xrSuggestInteractionProfileBindings) \
+    X(xrAttachSessionActionSets) \
+    X(xrGetActionStateBoolean) \
+    X(xrGetActionStateFloat) \
+    X(xrGetActionStatePose) \
+    X(xrGetActionStateVector2f) \
+    X(xrSyncActions) \
+    /* Path functions */ \
+    X(xrStringToPath) \
+    X(xrPathToString) \
+    /* Interaction functions */ \
+    X(xrGetCurrentInteractionProfile) \
+    X(xrEnumerateBoundSourcesForAction) \
+    X(xrGetInputSourceLocalizedName) \
+    /* Utility functions */ \
+    X(xrResultToString) \
+    X(xrStructureTypeToString) \
+    X(xrGetReferenceSpaceBoundsRect) \
+    X(xrGetViewConfigurationProperties) \
+    /* Haptic functions */ \
+    X(xrApplyHapticFeedback) \
+    X(xrGetRecommendedLayerResolutionMETA) \
+    X(xrGetVisibilityMaskKHR) \
+    X(xrStopHapticFeedback) \
+    /* Hand tracking functions */ \
+    X(xrCreateHandTrackerEXT) \
+    X(xrDestroyHandTrackerEXT) \
+    X(xrLocateHandJointsEXT) \
+    /* Time conversion functions */ \
+    X(xrConvertWin32PerformanceCounterToTimeKHR) \
+    X(xrConvertTimeToWin32PerformanceCounterKHR)
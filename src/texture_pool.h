@@ -0,0 +1,135 @@
+// Swapchain image pool for OpenXR WXR
+// Keeps the images of destroyed swapchains for reuse by the next matching xrCreateSwapchain, within a byte budget
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace texpool {
+
+// Everything that decides whether a pooled image can stand in for a freshly created one
+struct Key {
+    uint64_t device{ 0 };      // Owning device / GL context, images never cross devices
+    uint32_t backend{ 0 };
+    int64_t format{ 0 };
+    uint32_t width{ 0 };
+    uint32_t height{ 0 };
+    uint32_t arraySize{ 1 };
+    uint32_t mipCount{ 1 };
+    uint32_t sampleCount{ 1 };
+    uint64_t usageFlags{ 0 };
+
+    bool operator==(const Key& o) const {
+        return device == o.device && backend == o.backend && format == o.format &&
+            width == o.width && height == o.height && arraySize == o.arraySize &&
+            mipCount == o.mipCount && sampleCount == o.sampleCount && usageFlags == o.usageFlags;
+    }
+};
+
+struct Stats {
+    uint64_t hits{ 0 };
+    uint64_t misses{ 0 };
+    uint64_t returned{ 0 };
+    uint64_t evictions{ 0 };
+    uint64_t residentBytes{ 0 };
+    uint64_t peakBytes{ 0 };
+
+    double HitRate() const {
+        uint64_t requests = hits + misses;
+        return requests ? (double)hits / (double)requests : 0.0;
+    }
+};
+
+// Image is whatever the caller stores per swapchain image (COM pointers, GL names...). The pool never
+// releases images itself: evicted ones are handed back so the caller can free them with the right context.
+template <typename Image>
+class Pool {
+public:
+    explicit Pool(uint64_t budgetBytes = 256ull << 20) : budget_(budgetBytes) {}
+
+    void SetBudget(uint64_t budgetBytes, std::vector<Image>& evicted) {
+        budget_ = budgetBytes;
+        Trim(evicted);
+    }
+    uint64_t Budget() const { return budget_; }
+
+    // Most recently returned match first: it's the likeliest to still be warm in video memory
+    bool Take(const Key& key, Image& out) {
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            if (it->key == key) {
+                out = std::move(it->image);
+                stats_.residentBytes -= it->bytes;
+                entries_.erase(it);
+                ++stats_.hits;
+                return true;
+            }
+        }
+        ++stats_.misses;
+        return false;
+    }
+
+    // Images larger than the whole budget go straight back to the caller
+    void Give(const Key& key, Image image, uint64_t bytes, std::vector<Image>& evicted) {
+        if (bytes > budget_) {
+            evicted.push_back(std::move(image));
+            ++stats_.evictions;
+            return;
+        }
+        entries_.push_front(Entry{ key, std::move(image), bytes });
+        stats_.residentBytes += bytes;
+        ++stats_.returned;
+        if (stats_.residentBytes > stats_.peakBytes) stats_.peakBytes = stats_.residentBytes;
+        Trim(evicted);
+    }
+
+    // Drops every image the predicate selects, e.g. those of a device that is going away
+    template <typename Pred>
+    void EvictIf(Pred&& pred, std::vector<Image>& evicted) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (pred(it->key)) {
+                stats_.residentBytes -= it->bytes;
+                evicted.push_back(std::move(it->image));
+                ++stats_.evictions;
+                it = entries_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void Clear(std::vector<Image>& evicted) {
+        EvictIf([](const Key&) { return true; }, evicted);
+    }
+
+    size_t Size() const { return entries_.size(); }
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    struct Entry {
+        Key key;
+        Image image;
+        uint64_t bytes{ 0 };
+    };
+
+    // Oldest returns go first
+    void Trim(std::vector<Image>& evicted) {
+        while (stats_.residentBytes > budget_ && !entries_.empty()) {
+            Entry& oldest = entries_.back();
+            stats_.residentBytes -= oldest.bytes;
+            evicted.push_back(std::move(oldest.image));
+            ++stats_.evictions;
+            entries_.pop_back();
+        }
+    }
+
+    // Only a handful of swapchains are ever pooled, a list scan beats hashing here
+    std::list<Entry> entries_;
+    uint64_t budget_;
+    Stats stats_;
+};
+
+} // namespace texpool
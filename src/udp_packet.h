@@ -0,0 +1,127 @@
+// WinlatorXR pose datagram parser for OpenXR WXR
+// Fixed-layout scan of the space separated packet into a flat struct: no streams, no locale, no allocations
+#pragma once
+
+#include "hand_joints.h"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace udppkt {
+
+// Packet layout:
+//   client f0 .. f27 frameID buttons [analog lt lg rt rg] [touch bits] [hand L joints] [hand R joints]
+// floats and buttons are described next to the parse in xrWaitFrame_runtime. The bracketed sections are optional
+// and may come in any order after the buttons; senders that don't know them keep working, and unknown trailing
+// tokens are skipped.
+//   analog: trigger and grip values 0..1, left then right
+//   touch:  T/F per TouchBit
+//   hand:   tracked hand joints relative to that hand's pose above, encoded as in hand_joints.h; a hand that is
+//           missing (or fails to decode) this packet is not being tracked
+constexpr size_t kFloatCount = 28;
+constexpr size_t kButtonCount = 19;
+
+enum TouchBit : uint8_t {
+    kTouchLeftTrigger, kTouchLeftThumbstick, kTouchLeftX, kTouchLeftY, kTouchLeftThumbrest,
+    kTouchRightTrigger, kTouchRightThumbstick, kTouchRightA, kTouchRightB, kTouchRightThumbrest,
+    kTouchCount
+};
+
+enum AnalogChannel : uint8_t {
+    kAnalogLeftTrigger, kAnalogLeftGrip, kAnalogRightTrigger, kAnalogRightGrip,
+    kAnalogCount
+};
+
+struct Packet {
+    float floats[kFloatCount]{};
+    int frameID{ 0 };
+    bool buttons[kButtonCount]{};   // Missing trailing characters read as released
+    bool hasAnalog{ false };
+    float analog[kAnalogCount]{};
+    bool hasTouch{ false };
+    bool touch[kTouchCount]{};
+    bool hasHand[2]{};              // Left, right
+    handjoints::Skeleton hands[2];
+};
+
+class Scanner {
+public:
+    explicit Scanner(std::string_view text) : text_(text) {}
+
+    std::string_view Next() {
+        while (pos_ < text_.size() && IsSpace(text_[pos_])) ++pos_;
+        size_t start = pos_;
+        while (pos_ < text_.size() && !IsSpace(text_[pos_])) ++pos_;
+        return text_.substr(start, pos_ - start);
+    }
+
+    bool NextFloat(float& out) {
+        std::string_view t = Next();
+        if (!t.empty() && t.front() == '+') t.remove_prefix(1);
+        auto result = std::from_chars(t.data(), t.data() + t.size(), out);
+        return !t.empty() && result.ec == std::errc() && result.ptr == t.data() + t.size();
+    }
+
+    bool NextInt(int& out) {
+        std::string_view t = Next();
+        auto result = std::from_chars(t.data(), t.data() + t.size(), out);
+        return !t.empty() && result.ec == std::errc() && result.ptr == t.data() + t.size();
+    }
+
+private:
+    static bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    std::string_view text_;
+    size_t pos_{ 0 };
+};
+
+// Reads 'T'/'F' characters into bits; anything else is skipped like the original parser did
+inline void ReadBits(std::string_view token, bool* bits, size_t count) {
+    size_t n = 0;
+    for (char c : token) {
+        if (n == count) break;
+        if (c == 'T') bits[n++] = true;
+        else if (c == 'F') bits[n++] = false;
+    }
+}
+
+// Returns false if the required part (through the frame ID) is missing or malformed; whatever was read is kept
+inline bool Parse(std::string_view text, Packet& out) {
+    out = Packet{};
+    Scanner scan(text);
+    if (scan.Next().empty()) return false;  // Client name
+    for (float& f : out.floats) {
+        if (!scan.NextFloat(f)) return false;
+    }
+    if (!scan.NextInt(out.frameID)) return false;
+    ReadBits(scan.Next(), out.buttons, kButtonCount);
+
+    for (std::string_view tag = scan.Next(); !tag.empty(); tag = scan.Next()) {
+        if (tag == "analog") {
+            // NaN would get through the clamp below and stick in the action state; drop the section instead
+            bool ok = true;
+            for (float& v : out.analog) ok = scan.NextFloat(v) && std::isfinite(v) && ok;
+            out.hasAnalog = ok;
+            if (ok) {
+                for (float& v : out.analog) v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+            }
+        }
+        else if (tag == "touch") {
+            ReadBits(scan.Next(), out.touch, kTouchCount);
+            out.hasTouch = true;
+        }
+        else if (tag == "hand") {
+            std::string_view side = scan.Next();
+            std::string_view joints = scan.Next();
+            if (side == "L" || side == "R") {
+                const int h = side == "L" ? 0 : 1;
+                out.hasHand[h] = handjoints::DecodeHand(joints, out.hands[h]);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace udppkt
@@ -49,7 +49,16 @@ enum MenuCommand {
 
     // Help
     ID_HELP_CONTROLS = 1501,
-    ID_HELP_ABOUT = 1502
+    ID_HELP_ABOUT = 1502,
+
+    // Preview policy
+    ID_PREVIEW_RATE_FULL = 1601,
+    ID_PREVIEW_RATE_HALF = 1602,
+    ID_PREVIEW_RATE_QUARTER = 1603,
+    ID_PREVIEW_SCALE_100 = 1611,
+    ID_PREVIEW_SCALE_50 = 1612,
+    ID_PREVIEW_SCALE_25 = 1613,
+    ID_PREVIEW_SYNC_ONLY = 1621
 };
 
 // View mode enum
@@ -81,6 +90,11 @@ struct UIState {
 
     // Render options
     bool showFullRender = false;  // If true, show full swapchain instead of imageRect crop
+
+    // Preview policy: the window mostly carries the frame sync block, so the eyes can be drawn less often and smaller
+    int previewRateDivisor = 1;        // Compose the eyes every Nth app frame (1, 2 or 4); the sync block updates every frame
+    int previewScalePercent = 100;     // Backbuffer resolution relative to the window, stretched on present
+    bool previewSyncOnly = false;      // Draw only the frame sync block and skip the eye blits
 };
 
 inline UIState g_uiState;
@@ -158,6 +172,19 @@ inline HMENU CreateAppMenu() {
     AppendMenuW(fovMenu, MF_STRING, ID_VIEW_FULL_RENDER, L"Show &Full Render\tG");
     AppendMenuW(menuBar, MF_POPUP, (UINT_PTR)fovMenu, L"F&OV");
 
+    // Preview Menu
+    HMENU previewMenu = CreatePopupMenu();
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_RATE_FULL, L"Full Rate");
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_RATE_HALF, L"1/2 Rate");
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_RATE_QUARTER, L"1/4 Rate");
+    AppendMenuW(previewMenu, MF_SEPARATOR, 0, nullptr);
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_SCALE_100, L"100% Resolution");
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_SCALE_50, L"50% Resolution");
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_SCALE_25, L"25% Resolution");
+    AppendMenuW(previewMenu, MF_SEPARATOR, 0, nullptr);
+    AppendMenuW(previewMenu, MF_STRING, ID_PREVIEW_SYNC_ONLY, L"&Sync Block Only");
+    AppendMenuW(menuBar, MF_POPUP, (UINT_PTR)previewMenu, L"&Preview");
+
     // Tools Menu
     HMENU toolsMenu = CreatePopupMenu();
     AppendMenuW(toolsMenu, MF_STRING, ID_TOOLS_SCREENSHOT, L"Take &Screenshot\tF12");
@@ -212,6 +239,15 @@ inline void UpdateMenuState(HMENU menu) {
     // Full render toggle
     CheckMenuItem(menu, ID_VIEW_FULL_RENDER,
         g_uiState.showFullRender ? MF_CHECKED : MF_UNCHECKED);
+
+    // Preview policy checks
+    CheckMenuItem(menu, ID_PREVIEW_RATE_FULL, g_uiState.previewRateDivisor == 1 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_RATE_HALF, g_uiState.previewRateDivisor == 2 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_RATE_QUARTER, g_uiState.previewRateDivisor == 4 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_SCALE_100, g_uiState.previewScalePercent == 100 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_SCALE_50, g_uiState.previewScalePercent == 50 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_SCALE_25, g_uiState.previewScalePercent == 25 ? MF_CHECKED : MF_UNCHECKED);
+    CheckMenuItem(menu, ID_PREVIEW_SYNC_ONLY, g_uiState.previewSyncOnly ? MF_CHECKED : MF_UNCHECKED);
 }
 
 // Show controls help dialog
@@ -398,6 +434,38 @@ inline bool HandleMenuCommand(HWND hwnd, WPARAM wParam,
             needsResize = true;
             break;
 
+        // Preview policy
+        case ID_PREVIEW_RATE_FULL:
+            g_uiState.previewRateDivisor = 1;
+            break;
+
+        case ID_PREVIEW_RATE_HALF:
+            g_uiState.previewRateDivisor = 2;
+            break;
+
+        case ID_PREVIEW_RATE_QUARTER:
+            g_uiState.previewRateDivisor = 4;
+            break;
+
+        case ID_PREVIEW_SCALE_100:
+            g_uiState.previewScalePercent = 100;
+            needsResize = true;
+            break;
+
+        case ID_PREVIEW_SCALE_50:
+            g_uiState.previewScalePercent = 50;
+            needsResize = true;
+            break;
+
+        case ID_PREVIEW_SCALE_25:
+            g_uiState.previewScalePercent = 25;
+            needsResize = true;
+            break;
+
+        case ID_PREVIEW_SYNC_ONLY:
+            g_uiState.previewSyncOnly = !g_uiState.previewSyncOnly;
+            break;
+
         // Tools
         case ID_TOOLS_SCREENSHOT:
             if (screenshotCallback) screenshotCallback();
@@ -0,0 +1,153 @@
+// Visibility mask meshes for OpenXR WXR (XR_KHR_visibility_mask)
+// Per-headset parametric lens outlines turned into hidden / visible triangle meshes and a line loop on the z=-1 plane
+#pragma once
+
+#include <openxr/openxr.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vismask {
+
+// Visible area as a superellipse |x/rx|^n + |y/ry|^n = 1 in the view's normalized rect ([-1,1] on both axes),
+// centred nasalShift toward the nose. Parts of the outline past the rect edge are clipped to it.
+struct LensProfile {
+    const char* make;
+    const char* model;   // nullptr matches any model of the make
+    float exponent;      // 2 = ellipse (Fresnel), higher = squarer (pancake)
+    float radiusX;
+    float radiusY;
+    float nasalShift;
+};
+
+inline constexpr LensProfile kDefaultLens{ "", nullptr, 2.2f, 1.05f, 1.05f, 0.03f };
+
+inline constexpr LensProfile kLensProfiles[] = {
+    { "META", "QUEST 3", 3.0f, 1.04f, 1.04f, 0.02f },        // Pancake, ~8% hidden
+    { "META", "QUEST 2", 2.0f, 1.04f, 1.06f, 0.05f },        // Fresnel, ~15% hidden
+    { "PICO", nullptr, 3.0f, 1.04f, 1.04f, 0.02f },          // Pancake
+    { "PLAY FOR DREAM", nullptr, 3.0f, 1.04f, 1.04f, 0.02f },
+};
+
+inline const LensProfile& FindLens(const std::string& make, const std::string& model) {
+    for (const LensProfile& lens : kLensProfiles) {
+        if (make != lens.make) continue;
+        if (!lens.model || model == lens.model) return lens;
+    }
+    return kDefaultLens;
+}
+
+struct Mesh {
+    std::vector<XrVector2f> vertices;
+    std::vector<uint32_t> indices;
+};
+
+struct Meshes {
+    Mesh hidden;     // Triangles covering what the lens can't show
+    Mesh visible;    // Triangle fan (as a list) covering what it can
+    Mesh lineLoop;   // Outline of the visible area
+    float visibleFraction{ 1.0f };
+};
+
+// nasalSign: +1 for the left eye (nose to the right), -1 for the right eye, 0 for a centred mono view.
+// All triangles are wound counter-clockwise with x right and y up.
+inline Meshes Generate(const LensProfile& lens, const XrFovf& fov, float nasalSign, uint32_t samplesPerSide = 16) {
+    const float left = std::tan(fov.angleLeft), right = std::tan(fov.angleRight);
+    const float down = std::tan(fov.angleDown), up = std::tan(fov.angleUp);
+    const float midX = (left + right) * 0.5f, halfX = (right - left) * 0.5f;
+    const float midY = (up + down) * 0.5f, halfY = (up - down) * 0.5f;
+    auto toView = [&](float nx, float ny) { return XrVector2f{ midX + nx * halfX, midY + ny * halfY }; };
+
+    // Rect border, counter-clockwise from the bottom-right corner; every corner is a sample so the hidden mesh tiles exactly
+    const uint32_t n = std::max<uint32_t>(samplesPerSide, 1);
+    const float corners[5][2] = { { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+    std::vector<XrVector2f> border;
+    border.reserve(n * 4);
+    for (int side = 0; side < 4; ++side) {
+        for (uint32_t i = 0; i < n; ++i) {
+            float t = (float)i / (float)n;
+            border.push_back({ corners[side][0] + (corners[side + 1][0] - corners[side][0]) * t,
+                               corners[side][1] + (corners[side + 1][1] - corners[side][1]) * t });
+        }
+    }
+
+    // Each border sample pulled toward the lens centre onto the outline (never past the border)
+    const float cx = std::clamp(lens.nasalShift * nasalSign, -0.5f, 0.5f);
+    std::vector<XrVector2f> ring(border.size());
+    for (size_t i = 0; i < border.size(); ++i) {
+        float dx = border[i].x - cx, dy = border[i].y;
+        float f = std::pow(std::fabs(dx / lens.radiusX), lens.exponent) + std::pow(std::fabs(dy / lens.radiusY), lens.exponent);
+        float t = (f > 0.0f) ? std::min(1.0f, std::pow(f, -1.0f / lens.exponent)) : 1.0f;
+        ring[i] = { cx + dx * t, dy * t };
+    }
+
+    Meshes out;
+    const uint32_t count = (uint32_t)border.size();
+
+    // Visible: centre + outline as a fan
+    out.visible.vertices.reserve(count + 1);
+    out.visible.vertices.push_back(toView(cx, 0.0f));
+    for (const XrVector2f& p : ring) out.visible.vertices.push_back(toView(p.x, p.y));
+    double visibleArea = 0.0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t j = (i + 1) % count;
+        out.visible.indices.insert(out.visible.indices.end(), { 0u, i + 1, j + 1 });
+        visibleArea += 0.5 * ((ring[i].x - cx) * ring[j].y - (ring[j].x - cx) * ring[i].y);
+    }
+    out.visibleFraction = (float)(visibleArea / 4.0);
+
+    // Hidden: the band between outline and border, skipping segments where the outline runs along the border
+    out.hidden.vertices.reserve(count * 2);
+    for (uint32_t i = 0; i < count; ++i) {
+        out.hidden.vertices.push_back(toView(ring[i].x, ring[i].y));      // 2i
+        out.hidden.vertices.push_back(toView(border[i].x, border[i].y));  // 2i + 1
+    }
+    auto same = [](const XrVector2f& a, const XrVector2f& b) { return std::fabs(a.x - b.x) < 1e-5f && std::fabs(a.y - b.y) < 1e-5f; };
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t j = (i + 1) % count;
+        bool clippedI = same(ring[i], border[i]);
+        bool clippedJ = same(ring[j], border[j]);
+        if (clippedI && clippedJ) continue;
+        if (!clippedI) out.hidden.indices.insert(out.hidden.indices.end(), { 2 * i, 2 * i + 1, 2 * j + 1 });
+        if (!clippedJ) out.hidden.indices.insert(out.hidden.indices.end(), { 2 * i, 2 * j + 1, 2 * j });
+    }
+
+    // Line loop: the outline itself
+    out.lineLoop.vertices.assign(out.visible.vertices.begin() + 1, out.visible.vertices.end());
+    out.lineLoop.indices.resize(count);
+    for (uint32_t i = 0; i < count; ++i) out.lineLoop.indices[i] = i;
+    return out;
+}
+
+// Meshes only change with the FOV, lens or eye; the last few are kept. A returned reference lasts until the next Get.
+class Cache {
+public:
+    const Meshes& Get(const LensProfile& lens, const XrFovf& fov, float nasalSign) {
+        for (const Entry& e : entries_) {
+            if (e.lens == &lens && e.nasalSign == nasalSign && e.fov.angleLeft == fov.angleLeft &&
+                e.fov.angleRight == fov.angleRight && e.fov.angleUp == fov.angleUp && e.fov.angleDown == fov.angleDown) {
+                return e.meshes;
+            }
+        }
+        if (entries_.size() >= kMaxEntries) entries_.erase(entries_.begin());
+        entries_.push_back(Entry{ &lens, fov, nasalSign, Generate(lens, fov, nasalSign) });
+        return entries_.back().meshes;
+    }
+
+    void Clear() { entries_.clear(); }
+
+private:
+    static constexpr size_t kMaxEntries = 6;  // Both eyes plus mono, for the current and previous FOV
+
+    struct Entry {
+        const LensProfile* lens;
+        XrFovf fov;
+        float nasalSign;
+        Meshes meshes;
+    };
+    std::vector<Entry> entries_;
+};
+
+} // namespace vismask
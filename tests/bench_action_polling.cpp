@@ -0,0 +1,203 @@
+// Benchmark for action_bindings.h and action_state.h
+// A frame of input polling, xrSyncActions plus every action read for each subaction path, against the per-query name matching it replaced
+
+#include "action_bindings.h"
+#include "action_state.h"
+#include "bench_common.h"
+
+#include <cctype>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using bindings::Input;
+
+// The fields of the runtime's ControllerState the actions read
+struct Controller {
+    bool triggerPressed, gripPressed, menuPressed, primaryPressed, secondaryPressed, thumbstickPressed;
+    float triggerValue, gripValue;
+    XrVector2f thumbstick;
+};
+
+struct Snapshot {
+    Controller left{}, right{};
+    XrTime time{ 0 };
+};
+
+struct ActionDesc {
+    const char* name;
+    XrActionType type;
+    const char* leftPath;   // nullptr: not bound on that hand
+    const char* rightPath;
+};
+
+// A typical game's action set, bound the way a Touch profile suggestion would bind it
+const ActionDesc kActions[] = {
+    { "fire", XR_ACTION_TYPE_FLOAT_INPUT, "/user/hand/left/input/trigger/value", "/user/hand/right/input/trigger/value" },
+    { "grab", XR_ACTION_TYPE_FLOAT_INPUT, "/user/hand/left/input/squeeze/value", "/user/hand/right/input/squeeze/value" },
+    { "grab_pressed", XR_ACTION_TYPE_BOOLEAN_INPUT, "/user/hand/left/input/squeeze/value", "/user/hand/right/input/squeeze/value" },
+    { "move", XR_ACTION_TYPE_VECTOR2F_INPUT, "/user/hand/left/input/thumbstick", nullptr },
+    { "turn", XR_ACTION_TYPE_VECTOR2F_INPUT, nullptr, "/user/hand/right/input/thumbstick" },
+    { "jump", XR_ACTION_TYPE_BOOLEAN_INPUT, nullptr, "/user/hand/right/input/a/click" },
+    { "crouch", XR_ACTION_TYPE_BOOLEAN_INPUT, nullptr, "/user/hand/right/input/b/click" },
+    { "inventory", XR_ACTION_TYPE_BOOLEAN_INPUT, "/user/hand/left/input/x/click", nullptr },
+    { "map", XR_ACTION_TYPE_BOOLEAN_INPUT, "/user/hand/left/input/y/click", nullptr },
+    { "pause_menu", XR_ACTION_TYPE_BOOLEAN_INPUT, "/user/hand/left/input/menu/click", nullptr },
+    { "sprint", XR_ACTION_TYPE_BOOLEAN_INPUT, "/user/hand/left/input/thumbstick/click", nullptr },
+    { "reload", XR_ACTION_TYPE_BOOLEAN_INPUT, nullptr, "/user/hand/right/input/thumbstick/click" },
+};
+
+struct CompiledAction {
+    XrActionType type;
+    Input input[2]{ Input::None, Input::None };
+    actstate::Channel synced[3];
+};
+
+bool ReadBoolean(const Controller& c, Input input) {
+    switch (input) {
+    case Input::Trigger: return c.triggerPressed;
+    case Input::Squeeze: return c.gripPressed;
+    case Input::Menu: return c.menuPressed;
+    case Input::Primary: return c.primaryPressed;
+    case Input::Secondary: return c.secondaryPressed;
+    case Input::ThumbstickClick: return c.thumbstickPressed;
+    default: return false;
+    }
+}
+
+XrVector2f Sample(const Controller& c, Input input, XrActionType type) {
+    switch (type) {
+    case XR_ACTION_TYPE_BOOLEAN_INPUT: return { ReadBoolean(c, input) ? 1.0f : 0.0f, 0.0f };
+    case XR_ACTION_TYPE_FLOAT_INPUT:
+        if (input == Input::Trigger) return { c.triggerValue, 0.0f };
+        if (input == Input::Squeeze) return { c.gripValue, 0.0f };
+        return { ReadBoolean(c, input) ? 1.0f : 0.0f, 0.0f };
+    case XR_ACTION_TYPE_VECTOR2F_INPUT: return input == Input::Thumbstick ? c.thumbstick : XrVector2f{ 0.0f, 0.0f };
+    default: return { 0.0f, 0.0f };
+    }
+}
+
+// xrSyncActions: one snapshot, every action sampled once per hand
+void Sync(std::vector<CompiledAction>& actions, const Snapshot& snap) {
+    for (CompiledAction& a : actions) {
+        const bool active[2] = { a.input[0] != Input::None, a.input[1] != Input::None };
+        const XrVector2f zero{ 0.0f, 0.0f };
+        const XrVector2f value[2] = {
+            active[0] ? Sample(snap.left, a.input[0], a.type) : zero,
+            active[1] ? Sample(snap.right, a.input[1], a.type) : zero,
+        };
+        actstate::Update(a.synced[0], actstate::Combine(a.type, value[0], value[1]), active[0] || active[1], snap.time);
+        actstate::Update(a.synced[1], value[0], active[0], snap.time);
+        actstate::Update(a.synced[2], value[1], active[1], snap.time);
+    }
+}
+
+// The old xrGetActionState*: subaction path string search, then lowercased substring matches on the action name
+bool NameMatches(const std::string& name, const char* pattern) {
+    std::string lower = name;
+    for (auto& c : lower) c = (char)std::tolower((unsigned char)c);
+    std::string patLower = pattern;
+    for (auto& c : patLower) c = (char)std::tolower((unsigned char)c);
+    return lower.find(patLower) != std::string::npos;
+}
+
+const Controller& ControllerFor(const std::unordered_map<XrPath, std::string>& pathStrings, XrPath subactionPath,
+    const Snapshot& snap) {
+    if (subactionPath != XR_NULL_PATH) {
+        auto it = pathStrings.find(subactionPath);
+        if (it != pathStrings.end()) {
+            if (it->second.find("left") != std::string::npos) return snap.left;
+            if (it->second.find("right") != std::string::npos) return snap.right;
+        }
+    }
+    return snap.right;
+}
+
+float OldRead(const std::string& name, XrActionType type, const Controller& c) {
+    switch (type) {
+    case XR_ACTION_TYPE_BOOLEAN_INPUT:
+        if (NameMatches(name, "trigger") || NameMatches(name, "select") || NameMatches(name, "fire")) return c.triggerPressed;
+        if (NameMatches(name, "grip") || NameMatches(name, "squeeze") || NameMatches(name, "grab")) return c.gripPressed;
+        if (NameMatches(name, "menu")) return c.menuPressed;
+        if (NameMatches(name, "primary") || NameMatches(name, "a_button") || NameMatches(name, "x_button")) return c.primaryPressed;
+        if (NameMatches(name, "secondary") || NameMatches(name, "b_button") || NameMatches(name, "y_button")) return c.secondaryPressed;
+        if (NameMatches(name, "thumbstick") || NameMatches(name, "joystick")) return c.thumbstickPressed;
+        return 0.0f;
+    case XR_ACTION_TYPE_FLOAT_INPUT:
+        if (NameMatches(name, "trigger") || NameMatches(name, "select") || NameMatches(name, "fire")) return c.triggerValue;
+        if (NameMatches(name, "grip") || NameMatches(name, "squeeze") || NameMatches(name, "grab")) return c.gripValue;
+        return 0.0f;
+    default:
+        if (NameMatches(name, "thumbstick") || NameMatches(name, "joystick") || NameMatches(name, "move") ||
+            NameMatches(name, "turn")) {
+            return c.thumbstick.x + c.thumbstick.y;
+        }
+        return 0.0f;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const benchutil::Options opts = benchutil::ParseOptions(argc, argv);
+    const int frames = opts.quick ? 10 : 20000;
+    constexpr XrPath kLeft = 1, kRight = 2;
+    const XrPath kQueries[] = { XR_NULL_PATH, kLeft, kRight };
+
+    // Compile once, as xrAttachSessionActionSets does
+    std::vector<CompiledAction> compiled;
+    std::vector<std::string> names;
+    for (const ActionDesc& d : kActions) {
+        CompiledAction a;
+        a.type = d.type;
+        bindings::Binding b;
+        if (d.leftPath && bindings::ParseBindingPath(d.leftPath, b)) a.input[b.hand - 1] = b.input;
+        if (d.rightPath && bindings::ParseBindingPath(d.rightPath, b)) a.input[b.hand - 1] = b.input;
+        compiled.push_back(a);
+        names.emplace_back(d.name);
+    }
+    const std::unordered_map<XrPath, std::string> pathStrings = { { kLeft, "/user/hand/left" }, { kRight, "/user/hand/right" } };
+
+    // Input changes every frame so the syncs do real change tracking
+    actstate::TripleBuffer<Snapshot> snapshots;
+    auto publish = [&](int frame) {
+        Snapshot& s = snapshots.Back();
+        s.left.triggerValue = s.right.gripValue = (float)(frame % 100) * 0.01f;
+        s.left.triggerPressed = s.right.primaryPressed = frame % 7 == 0;
+        s.left.thumbstick = { std::sin((float)frame), std::cos((float)frame) };
+        s.time = frame;
+        snapshots.Publish();
+    };
+    std::printf("action polling, %zu actions x 3 subaction paths x %d frames\n", compiled.size(), frames);
+
+    const double old = benchutil::MedianMicros(opts, [&] {
+        double sum = 0.0;
+        for (int f = 0; f < frames; ++f) {
+            publish(f);
+            const Snapshot& snap = snapshots.Latest();
+            for (size_t i = 0; i < names.size(); ++i) {
+                for (XrPath q : kQueries) sum += OldRead(names[i], kActions[i].type, ControllerFor(pathStrings, q, snap));
+            }
+        }
+        benchutil::Consume((uint64_t)sum);
+    });
+    benchutil::Report("name matching per query", old);
+    benchutil::Report("compiled bindings + sync", benchutil::MedianMicros(opts, [&] {
+        double sum = 0.0;
+        for (int f = 0; f < frames; ++f) {
+            publish(f);
+            Sync(compiled, snapshots.Latest());
+            for (const CompiledAction& a : compiled) {
+                for (XrPath q : kQueries) {
+                    const actstate::Channel& ch = a.synced[q == kLeft ? 1 : q == kRight ? 2 : 0];
+                    sum += ch.value.x + ch.value.y + (ch.changed ? 1.0 : 0.0);
+                }
+            }
+        }
+        benchutil::Consume((uint64_t)sum);
+    }), old);
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Minimal timing helpers for the OpenXR WXR header benchmarks
+// Each case runs a few times and reports the median; --quick runs everything once on small inputs so ctest can smoke-test the benches
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace benchutil {
+
+struct Options {
+    bool quick{ false };
+    int runs{ 9 };
+};
+
+inline Options ParseOptions(int argc, char** argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            o.quick = true;
+            o.runs = 1;
+        }
+    }
+    return o;
+}
+
+// Keeps a result alive so the optimizer can't drop the work that produced it
+inline void Consume(uint64_t value) {
+    static volatile uint64_t sink = 0;
+    sink = sink + value;
+}
+
+// Median wall time of one call to fn, in microseconds
+template <typename Fn>
+double MedianMicros(const Options& o, Fn&& fn) {
+    std::vector<double> times;
+    fn();  // Warm caches and lazily sized buffers
+    for (int r = 0; r < o.runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+inline void Report(const char* name, double micros, double baselineMicros = 0.0) {
+    if (baselineMicros > 0.0 && micros > 0.0) {
+        std::printf("%-44s %12.2f us  (%.2fx)\n", name, micros, baselineMicros / micros);
+    }
+    else {
+        std::printf("%-44s %12.2f us\n", name, micros);
+    }
+}
+
+} // namespace benchutil
@@ -0,0 +1,93 @@
+// Benchmark for frame_synthesis.h and the CPU reprojection kernel
+// One eye of a half-rate synthesized frame: luma downsample, block matching, field or motion-vector extrapolation, then the pose warp
+
+#include "frame_synthesis.h"
+#include "reprojection.h"
+#include "bench_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Smooth gradients plus texture, shifted by (dx, dy), so block matching has something to lock onto
+std::vector<uint32_t> TexturedImage(uint32_t width, uint32_t height, int dx, int dy) {
+    std::vector<uint32_t> img((size_t)width * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const int sx = (int)x - dx, sy = (int)y - dy;
+            const uint32_t r = (uint32_t)((sx * 7 + sy * 3) & 0xFF);
+            const uint32_t g = (uint32_t)(((sx ^ sy) * 13) & 0xFF);
+            const uint32_t b = (uint32_t)((sx * sy) & 0xFF);
+            img[(size_t)y * width + x] = r | (g << 8) | (b << 16) | 0xFF000000u;
+        }
+    }
+    return img;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const benchutil::Options opts = benchutil::ParseOptions(argc, argv);
+    const uint32_t width = opts.quick ? 256 : 1832, height = opts.quick ? 256 : 1920;
+    std::printf("frame synthesis, one %ux%u eye\n", width, height);
+
+    const std::vector<uint32_t> prev = TexturedImage(width, height, 0, 0);
+    const std::vector<uint32_t> cur = TexturedImage(width, height, 6, 3);
+    std::vector<uint32_t> dst((size_t)width * height);
+
+    std::vector<uint8_t> prevLuma, curLuma;
+    uint32_t lw = 0, lh = 0;
+    benchutil::Report("DownsampleLuma", benchutil::MedianMicros(opts, [&] {
+        synth::DownsampleLuma(cur.data(), width, height, synth::kLumaDownsample, curLuma, lw, lh);
+        benchutil::Consume(curLuma[0]);
+    }));
+    synth::DownsampleLuma(prev.data(), width, height, synth::kLumaDownsample, prevLuma, lw, lh);
+
+    synth::MotionField field;
+    benchutil::Report("EstimateMotion", benchutil::MedianMicros(opts, [&] {
+        synth::EstimateMotion(prevLuma.data(), curLuma.data(), lw, lh, synth::kLumaDownsample, field);
+        benchutil::Consume((uint64_t)field.dx.size());
+    }));
+
+    benchutil::Report("ExtrapolateWithField", benchutil::MedianMicros(opts, [&] {
+        synth::ExtrapolateWithField(cur.data(), width, height, field, 0.5f, dst.data());
+        benchutil::Consume(dst[dst.size() / 2]);
+    }));
+
+    // XR_FB_space_warp vectors at full and at the recommended half resolution
+    for (uint32_t div = 1; div <= 2; ++div) {
+        const uint32_t mvWidth = width / div, mvHeight = height / div;
+        std::vector<float> motion((size_t)mvWidth * mvHeight * 4);
+        for (size_t i = 0; i < motion.size(); i += 4) {
+            motion[i] = 0.01f * std::sin((float)i * 1e-4f);
+            motion[i + 1] = -0.005f;
+        }
+        const double us = benchutil::MedianMicros(opts, [&] {
+            synth::ExtrapolateWithMotionVectors(cur.data(), width, height, motion.data(), mvWidth, mvHeight, 4, 0.5f, dst.data());
+            benchutil::Consume(dst[dst.size() / 2]);
+        });
+        benchutil::Report(div == 1 ? "ExtrapolateWithMotionVectors (full-size MV)" : "ExtrapolateWithMotionVectors (half-size MV)", us);
+    }
+
+    // The pose warp that follows, rotation-only and with depth
+    XrFovf fov{ -0.8f, 0.8f, 0.8f, -0.8f };
+    XrPosef render{ { 0.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } };
+    XrPosef target = synth::ExtrapolatePose(render, { { 0.0f, 0.02f, 0.0f, 0.9998f }, { 0.01f, 0.0f, 0.0f } }, 1.5f);
+    std::vector<float> depth((size_t)width * height, 0.5f);
+    std::vector<float> zbuf;
+    const reproj::FovTangents tangents = reproj::TangentsFromFov(fov);
+    const reproj::EyeDelta delta = reproj::ComputeEyeDelta(render, target);
+    benchutil::Report("ReprojectImage (rotation only)", benchutil::MedianMicros(opts, [&] {
+        reproj::ReprojectImage(cur.data(), nullptr, width, height, tangents, tangents, delta,
+            reproj::RotationOnlyDepthRange(), dst.data(), zbuf);
+        benchutil::Consume(dst[dst.size() / 2]);
+    }));
+    benchutil::Report("ReprojectImage (depth)", benchutil::MedianMicros(opts, [&] {
+        reproj::ReprojectImage(cur.data(), depth.data(), width, height, tangents, tangents, delta,
+            reproj::MakeDepthRange(0.0f, 1.0f, 0.1f, 100.0f), dst.data(), zbuf);
+        benchutil::Consume(dst[dst.size() / 2]);
+    }));
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Benchmark for handle_table.h
+// Looking up live and stale handles through Table::Get, against the unordered_map<uint64_t, T> the tables replaced
+
+#include "handle_table.h"
+#include "bench_common.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Roughly the size of the runtime's action and space records
+struct Record {
+    uint64_t key{ 0 };
+    float values[14]{};
+};
+
+using RecordTable = handles::Table<Record, handles::HandleType::Action>;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const benchutil::Options opts = benchutil::ParseOptions(argc, argv);
+    const int rounds = opts.quick ? 10 : 5000;
+    const uint32_t objects = 256;
+
+    // Every other object is destroyed, so its handle is stale in both containers; both see the same handles
+    RecordTable table;
+    std::unordered_map<uint64_t, Record> map;
+    std::vector<uint64_t> live, stale;
+    for (uint32_t i = 0; i < objects; ++i) {
+        Record r;
+        r.key = i;
+        const uint64_t h = table.Insert(r);
+        map.emplace(h, r);
+        if (i % 2) {
+            table.Remove(h);
+            map.erase(h);
+            stale.push_back(h);
+        }
+        else {
+            live.push_back(h);
+        }
+    }
+    // Reuse the freed slots so stale handles point at occupied slots with a newer generation
+    for (uint32_t i = 0; i < objects / 2; ++i) {
+        Record r;
+        r.key = objects + i;
+        const uint64_t h = table.Insert(r);
+        map.emplace(h, r);
+        live.push_back(h);
+    }
+    std::printf("handle lookup, %zu live + %zu stale handles x %d rounds\n", live.size(), stale.size(), rounds);
+
+    const double mapLive = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (uint64_t h : live) {
+                auto it = map.find(h);
+                if (it != map.end()) sum += it->second.key;
+            }
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("unordered_map find, live", mapLive);
+    benchutil::Report("Table::Get, live", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (uint64_t h : live) {
+                if (const Record* rec = table.Get(h)) sum += rec->key;
+            }
+        }
+        benchutil::Consume(sum);
+    }), mapLive);
+
+    const double mapStale = benchutil::MedianMicros(opts, [&] {
+        uint64_t misses = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (uint64_t h : stale) misses += map.find(h) == map.end();
+        }
+        benchutil::Consume(misses);
+    });
+    benchutil::Report("unordered_map find, stale", mapStale);
+    benchutil::Report("Table::Get, stale", benchutil::MedianMicros(opts, [&] {
+        uint64_t misses = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (uint64_t h : stale) misses += table.Get(h) == nullptr;
+        }
+        benchutil::Consume(misses);
+    }), mapStale);
+    return 0;
+}
@@ -0,0 +1,148 @@
+// Benchmark for path_interner.h
+// Interning, finding and viewing binding paths, against an unordered_map<string, XrPath> plus vector of strings
+
+#include "path_interner.h"
+#include "bench_common.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// The obvious interner: map for string -> path, vector for path -> string
+class MapInterner {
+public:
+    XrPath Intern(std::string_view path) {
+        auto it = ids_.find(std::string(path));
+        if (it != ids_.end()) return it->second;
+        strings_.emplace_back(path);
+        const XrPath id = (XrPath)strings_.size();
+        ids_.emplace(strings_.back(), id);
+        return id;
+    }
+
+    XrPath Find(std::string_view path) const {
+        auto it = ids_.find(std::string(path));
+        return it != ids_.end() ? it->second : XR_NULL_PATH;
+    }
+
+    std::string_view View(XrPath path) const {
+        if (path == XR_NULL_PATH || path > strings_.size()) return std::string_view();
+        return strings_[(size_t)path - 1];
+    }
+
+private:
+    std::unordered_map<std::string, XrPath> ids_;
+    std::vector<std::string> strings_;
+};
+
+// What apps intern at startup: every input of several profiles on both hands, many times over
+std::vector<std::string> MakePaths(size_t profiles) {
+    static const char* const kInputs[] = {
+        "/input/a/click", "/input/a/touch", "/input/b/click", "/input/b/touch", "/input/x/click", "/input/x/touch",
+        "/input/y/click", "/input/y/touch", "/input/menu/click", "/input/system/click", "/input/squeeze/value",
+        "/input/trigger/value", "/input/trigger/touch", "/input/thumbstick", "/input/thumbstick/x", "/input/thumbstick/y",
+        "/input/thumbstick/click", "/input/thumbstick/touch", "/input/grip/pose", "/input/aim/pose", "/output/haptic",
+    };
+    std::vector<std::string> out;
+    for (size_t p = 0; p < profiles; ++p) {
+        out.push_back("/interaction_profiles/vendor" + std::to_string(p) + "/controller");
+        for (const char* hand : { "/user/hand/left", "/user/hand/right" }) {
+            for (const char* input : kInputs) out.push_back(std::string(hand) + input + "_" + std::to_string(p));
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const benchutil::Options opts = benchutil::ParseOptions(argc, argv);
+    const int rounds = opts.quick ? 2 : 200;
+    const std::vector<std::string> paths = MakePaths(opts.quick ? 4 : 48);
+    std::vector<std::string_view> missing;
+    std::vector<std::string> missingStorage;
+    for (const std::string& p : paths) missingStorage.push_back(p + "/nope");
+    for (const std::string& p : missingStorage) missing.push_back(p);
+    std::printf("path interner, %zu paths x %d rounds\n", paths.size(), rounds);
+
+    // A fresh interner per round, so every Intern inserts
+    const double mapIntern = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            MapInterner in;
+            for (const std::string& p : paths) sum += in.Intern(p);
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("unordered_map Intern (new)", mapIntern);
+    benchutil::Report("Interner::Intern (new)", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            paths::Interner in;
+            for (const std::string& p : paths) sum += in.Intern(p);
+        }
+        benchutil::Consume(sum);
+    }), mapIntern);
+
+    MapInterner mapIn;
+    paths::Interner in;
+    std::vector<XrPath> ids;
+    for (const std::string& p : paths) {
+        mapIn.Intern(p);
+        ids.push_back(in.Intern(p));
+    }
+
+    // xrStringToPath on a path the app already has
+    const double mapRepeat = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (const std::string& p : paths) sum += mapIn.Intern(p);
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("unordered_map Intern (existing)", mapRepeat);
+    benchutil::Report("Interner::Intern (existing)", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (const std::string& p : paths) sum += in.Intern(p);
+        }
+        benchutil::Consume(sum);
+    }), mapRepeat);
+
+    const double mapFind = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (std::string_view p : missing) sum += mapIn.Find(p);
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("unordered_map Find (missing)", mapFind);
+    benchutil::Report("Interner::Find (missing)", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (std::string_view p : missing) sum += in.Find(p);
+        }
+        benchutil::Consume(sum);
+    }), mapFind);
+
+    // xrPathToString and the binding lookups
+    const double mapView = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (XrPath id : ids) sum += mapIn.View(id).size();
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("vector View", mapView);
+    benchutil::Report("Interner::View", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (XrPath id : ids) sum += in.View(id).size();
+        }
+        benchutil::Consume(sum);
+    }), mapView);
+    return 0;
+}
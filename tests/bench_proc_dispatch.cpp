@@ -0,0 +1,61 @@
+// Benchmark for proc_dispatch.h
+// Resolving every runtime entry point plus as many unknown names, against the strcmp walk the perfect hash replaced
+
+#include "proc_dispatch.h"
+#include "runtime_functions.h"
+#include "bench_common.h"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+#define OXRWXR_FN_NAME(fn) #fn,
+constexpr std::string_view kFnNames[] = { OXRWXR_RUNTIME_FUNCTIONS(OXRWXR_FN_NAME) };
+const char* const kFnCStrings[] = { OXRWXR_RUNTIME_FUNCTIONS(OXRWXR_FN_NAME) };
+#undef OXRWXR_FN_NAME
+constexpr size_t kCount = std::size(kFnNames);
+constexpr auto kFnHash = procdispatch::Build(kFnNames);
+
+// The old xrGetInstanceProcAddr: one strcmp per known function until a match
+size_t FindByStrcmp(const char* name) {
+    for (size_t i = 0; i < kCount; ++i) {
+        if (std::strcmp(name, kFnCStrings[i]) == 0) return i;
+    }
+    return kCount;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const benchutil::Options opts = benchutil::ParseOptions(argc, argv);
+    const int rounds = opts.quick ? 10 : 2000;
+
+    // Loaders query extension functions the runtime doesn't have about as often as ones it does
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < kCount; ++i) {
+        queries.emplace_back(kFnNames[i]);
+        queries.push_back(std::string(kFnNames[i]) + "FB");
+    }
+    std::printf("proc address lookup, %zu names (%zu known) x %d rounds\n", queries.size(), kCount, rounds);
+
+    const double walk = benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (const std::string& q : queries) sum += FindByStrcmp(q.c_str());
+        }
+        benchutil::Consume(sum);
+    });
+    benchutil::Report("strcmp walk", walk);
+    benchutil::Report("perfect hash", benchutil::MedianMicros(opts, [&] {
+        uint64_t sum = 0;
+        for (int r = 0; r < rounds; ++r) {
+            // strlen included: the runtime gets a const char* too
+            for (const std::string& q : queries) sum += kFnHash.Find(q.c_str());
+        }
+        benchutil::Consume(sum);
+    }), walk);
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Tests for action_bindings.h
+// Binding paths are checked for hand prefixes, identifiers, components and rejected paths; name guesses per action type
+
+#include "action_bindings.h"
+#include "test_common.h"
+
+#include <string_view>
+
+namespace {
+
+using bindings::Binding;
+using bindings::Input;
+
+bool Parses(std::string_view path, Input input, bindings::Hand hand) {
+    Binding b;
+    return bindings::ParseBindingPath(path, b) && b.input == input && b.hand == hand;
+}
+
+bool Rejects(std::string_view path) {
+    Binding b{ Input::Menu, bindings::kHandRight };
+    // A rejected path leaves the output untouched
+    return !bindings::ParseBindingPath(path, b) && b.input == Input::Menu && b.hand == bindings::kHandRight;
+}
+
+void TestHandPrefixes() {
+    CHECK(Parses("/user/hand/left/input/trigger/value", Input::Trigger, bindings::kHandLeft));
+    CHECK(Parses("/user/hand/right/input/trigger/value", Input::Trigger, bindings::kHandRight));
+    CHECK(Rejects("/user/head/input/trigger/value"));
+    CHECK(Rejects("/user/gamepad/input/a/click"));
+    CHECK(Rejects("/user/hand/left"));
+    CHECK(Rejects("/user/hand/left/input"));
+    CHECK(Rejects("/user/hand/lefty/input/trigger/value"));
+    CHECK(Rejects("/user/hand/Left/input/trigger/value"));
+}
+
+void TestIdentifiers() {
+    const auto L = bindings::kHandLeft;
+    CHECK(Parses("/user/hand/left/input/select/click", Input::Trigger, L));
+    CHECK(Parses("/user/hand/left/input/squeeze/value", Input::Squeeze, L));
+    CHECK(Parses("/user/hand/left/input/menu/click", Input::Menu, L));
+    CHECK(Parses("/user/hand/left/input/system/click", Input::Menu, L));
+    CHECK(Parses("/user/hand/left/input/x/click", Input::Primary, L));
+    CHECK(Parses("/user/hand/left/input/a/click", Input::Primary, L));
+    CHECK(Parses("/user/hand/left/input/y/click", Input::Secondary, L));
+    CHECK(Parses("/user/hand/left/input/b/click", Input::Secondary, L));
+    CHECK(Parses("/user/hand/left/input/grip/pose", Input::Pose, L));
+    CHECK(Parses("/user/hand/left/input/aim/pose", Input::Pose, L));
+}
+
+void TestComponents() {
+    const auto R = bindings::kHandRight;
+    CHECK(Parses("/user/hand/right/input/thumbstick", Input::Thumbstick, R));
+    CHECK(Parses("/user/hand/right/input/thumbstick/x", Input::ThumbstickX, R));
+    CHECK(Parses("/user/hand/right/input/thumbstick/y", Input::ThumbstickY, R));
+    CHECK(Parses("/user/hand/right/input/thumbstick/click", Input::ThumbstickClick, R));
+    CHECK(Parses("/user/hand/right/input/trackpad/click", Input::ThumbstickClick, R));
+    CHECK(Parses("/user/hand/right/input/trigger/touch", Input::TriggerTouch, R));
+    CHECK(Parses("/user/hand/right/input/thumbstick/touch", Input::ThumbstickTouch, R));
+    CHECK(Parses("/user/hand/right/input/a/touch", Input::PrimaryTouch, R));
+    CHECK(Parses("/user/hand/right/input/y/touch", Input::SecondaryTouch, R));
+    CHECK(Parses("/user/hand/right/input/thumbrest/touch", Input::ThumbrestTouch, R));
+    // Touch on an input without a touch sensor in the feed
+    CHECK(Rejects("/user/hand/right/input/squeeze/touch"));
+}
+
+void TestIdentifierOnlyPaths() {
+    // The parser is the fallback for table misses, so paths without a component must parse too
+    CHECK(Parses("/user/hand/left/input/trigger", Input::Trigger, bindings::kHandLeft));
+    CHECK(Parses("/user/hand/right/input/squeeze", Input::Squeeze, bindings::kHandRight));
+    CHECK(Parses("/user/hand/right/input/a", Input::Primary, bindings::kHandRight));
+    CHECK(Parses("/user/hand/left/input/grip", Input::Pose, bindings::kHandLeft));
+    CHECK(Parses("/user/hand/left/input/aim", Input::Pose, bindings::kHandLeft));
+}
+
+void TestBadPaths() {
+    CHECK(Rejects(""));
+    CHECK(Rejects("/user/hand/right/output/haptic"));
+    CHECK(Rejects("/user/hand/right/input/"));
+    CHECK(Rejects("/user/hand/right/input/pinch/value"));
+    CHECK(Rejects("/interaction_profiles/oculus/touch_controller"));
+}
+
+void TestContainsNoCase() {
+    CHECK(bindings::ContainsNoCase("FireWeapon", "fire"));
+    CHECK(bindings::ContainsNoCase("grab_LEFT", "left"));
+    CHECK(bindings::ContainsNoCase("menu", "menu"));
+    CHECK(!bindings::ContainsNoCase("men", "menu"));
+    CHECK(bindings::ContainsNoCase("anything", ""));
+}
+
+void TestGuessInput() {
+    CHECK(bindings::GuessInput("FireWeapon", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Trigger);
+    CHECK(bindings::GuessInput("grab_object", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Squeeze);
+    CHECK(bindings::GuessInput("OpenMenu", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Menu);
+    CHECK(bindings::GuessInput("x_button", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Primary);
+    CHECK(bindings::GuessInput("secondary", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Secondary);
+    CHECK(bindings::GuessInput("joystick_click", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::ThumbstickClick);
+    CHECK(bindings::GuessInput("jump", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::None);
+
+    CHECK(bindings::GuessInput("TriggerValue", XR_ACTION_TYPE_FLOAT_INPUT) == Input::Trigger);
+    CHECK(bindings::GuessInput("squeeze", XR_ACTION_TYPE_FLOAT_INPUT) == Input::Squeeze);
+    // Floats only guess analog inputs
+    CHECK(bindings::GuessInput("menu", XR_ACTION_TYPE_FLOAT_INPUT) == Input::None);
+
+    CHECK(bindings::GuessInput("Move", XR_ACTION_TYPE_VECTOR2F_INPUT) == Input::Thumbstick);
+    CHECK(bindings::GuessInput("snap_turn", XR_ACTION_TYPE_VECTOR2F_INPUT) == Input::Thumbstick);
+    CHECK(bindings::GuessInput("scroll", XR_ACTION_TYPE_VECTOR2F_INPUT) == Input::None);
+
+    CHECK(bindings::GuessInput("hand_pose", XR_ACTION_TYPE_POSE_INPUT) == Input::Pose);
+    CHECK(bindings::GuessInput("anything", XR_ACTION_TYPE_POSE_INPUT) == Input::Pose);
+    CHECK(bindings::GuessInput("trigger_haptic", XR_ACTION_TYPE_VIBRATION_OUTPUT) == Input::None);
+}
+
+} // namespace
+
+int main() {
+    TestHandPrefixes();
+    TestIdentifiers();
+    TestComponents();
+    TestIdentifierOnlyPaths();
+    TestBadPaths();
+    TestContainsNoCase();
+    TestGuessInput();
+    return testutil::Finish();
+}
@@ -0,0 +1,155 @@
+// Tests for blit_cache.h
+// A fake device hands out textures that count themselves, so the tests can see which entries were built and released
+
+#include "blit_cache.h"
+#include "test_common.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+struct FakeDevice {
+    int created{ 0 };
+    int live{ 0 };
+    bool failNext{ false };
+};
+
+struct FakeTexture {
+    FakeDevice* device;
+    uint32_t width, height;
+    FakeTexture(FakeDevice* d, uint32_t w, uint32_t h) : device(d), width(w), height(h) { ++device->live; }
+    ~FakeTexture() { --device->live; }
+};
+
+// Stands in for the runtime's texture + SRV pair
+struct Entry {
+    std::shared_ptr<FakeTexture> texture;
+};
+
+using Cache = blitcache::Cache<Entry>;
+
+blitcache::Key MakeKey(uint64_t swapchain, uint32_t image, uint32_t width = 1832, uint32_t height = 1920) {
+    blitcache::Key key;
+    key.swapchain = swapchain;
+    key.imageIndex = image;
+    key.width = width;
+    key.height = height;
+    key.format = 29;  // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+    return key;
+}
+
+// The factory the runtime passes: build the resource on the device, fail like CreateTexture2D would
+auto Factory(FakeDevice& device, const blitcache::Key& key) {
+    return [&device, key](Entry& e) {
+        if (device.failNext) {
+            device.failNext = false;
+            return false;
+        }
+        ++device.created;
+        e.texture = std::make_shared<FakeTexture>(&device, key.width, key.height);
+        return true;
+    };
+}
+
+void TestCreateThenHit() {
+    FakeDevice device;
+    Cache cache;
+    const blitcache::Key key = MakeKey(1, 0);
+    Entry* a = cache.GetOrCreate(key, Factory(device, key));
+    CHECK(a && a->texture && a->texture->width == 1832);
+    Entry* b = cache.GetOrCreate(key, Factory(device, key));
+    CHECK(b == a);
+    CHECK(device.created == 1 && device.live == 1);
+    CHECK(cache.GetStats().creates == 1 && cache.GetStats().hits == 1);
+
+    // Any field of the key makes a different entry
+    blitcache::Key other = key;
+    other.arraySlice = 1;
+    CHECK(cache.GetOrCreate(other, Factory(device, other)) != a);
+    other = key;
+    other.format = 87;
+    CHECK(cache.GetOrCreate(other, Factory(device, other)) != a);
+    other = MakeKey(1, 0, 1280, 720);
+    CHECK(cache.GetOrCreate(other, Factory(device, other))->texture->width == 1280);
+    CHECK(cache.Size() == 4 && device.live == 4);
+    CHECK(cache.GetStats().creates == 4 && cache.GetStats().hits == 1);
+}
+
+void TestFailedCreateIsNotCached() {
+    FakeDevice device;
+    Cache cache;
+    const blitcache::Key key = MakeKey(1, 0);
+    device.failNext = true;
+    CHECK(cache.GetOrCreate(key, Factory(device, key)) == nullptr);
+    CHECK(cache.Size() == 0 && cache.GetStats().failures == 1 && cache.GetStats().creates == 0);
+    // The next frame tries again and succeeds
+    Entry* e = cache.GetOrCreate(key, Factory(device, key));
+    CHECK(e && e->texture);
+    CHECK(cache.GetStats().failures == 1 && cache.GetStats().creates == 1 && cache.GetStats().hits == 0);
+}
+
+void TestInvalidateSwapchain() {
+    FakeDevice device;
+    Cache cache;
+    for (uint64_t sc = 1; sc <= 2; ++sc) {
+        for (uint32_t i = 0; i < 3; ++i) {
+            const blitcache::Key key = MakeKey(sc, i);
+            cache.GetOrCreate(key, Factory(device, key));
+        }
+    }
+    CHECK(cache.Size() == 6 && device.live == 6);
+    cache.InvalidateSwapchain(1);
+    CHECK(cache.Size() == 3 && device.live == 3);
+    CHECK(cache.GetStats().evictions == 3);
+    cache.InvalidateSwapchain(99);  // Unknown swapchain: nothing happens
+    CHECK(cache.Size() == 3 && cache.GetStats().evictions == 3);
+
+    // A reused handle gets fresh resources, not the old ones
+    const blitcache::Key reused = MakeKey(1, 0);
+    cache.GetOrCreate(reused, Factory(device, reused));
+    CHECK(device.created == 7 && cache.GetStats().hits == 0);
+    // Swapchain 2's entries are untouched
+    const blitcache::Key kept = MakeKey(2, 1);
+    cache.GetOrCreate(kept, Factory(device, kept));
+    CHECK(cache.GetStats().hits == 1 && device.created == 7);
+}
+
+void TestClear() {
+    FakeDevice device;
+    Cache cache;
+    for (uint32_t i = 0; i < 4; ++i) {
+        const blitcache::Key key = MakeKey(5, i);
+        cache.GetOrCreate(key, Factory(device, key));
+    }
+    cache.Clear();
+    CHECK(cache.Size() == 0 && device.live == 0);
+    CHECK(cache.GetStats().evictions == 4);
+    // Counters survive a Clear (they are logged per session)
+    CHECK(cache.GetStats().creates == 4);
+    const blitcache::Key key = MakeKey(5, 0);
+    cache.GetOrCreate(key, Factory(device, key));
+    CHECK(device.created == 5 && cache.GetStats().hits == 0);
+}
+
+void TestKeyHashSeparatesFields() {
+    const blitcache::KeyHash hash;
+    const blitcache::Key a = MakeKey(1, 0);
+    blitcache::Key b = a;
+    b.imageIndex = 1;
+    blitcache::Key c = a;
+    c.arraySlice = 1;
+    CHECK(hash(a) == hash(MakeKey(1, 0)));
+    CHECK(hash(a) != hash(b) && hash(a) != hash(c) && hash(b) != hash(c));
+}
+
+} // namespace
+
+int main() {
+    TestCreateThenHit();
+    TestFailedCreateIsNotCached();
+    TestInvalidateSwapchain();
+    TestClear();
+    TestKeyHashSeparatesFields();
+    return testutil::Finish();
+}
@@ -0,0 +1,41 @@
+// Minimal test helpers for the OpenXR WXR header tests
+// CHECK records a failure and keeps going; main returns Finish() so ctest sees the result
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+namespace testutil {
+
+inline int& Failures() {
+    static int failures = 0;
+    return failures;
+}
+
+inline int Finish() {
+    if (Failures() != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", Failures());
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
+
+} // namespace testutil
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++testutil::Failures(); \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps) \
+    do { \
+        const double check_a_ = (double)(a), check_b_ = (double)(b); \
+        if (!(std::fabs(check_a_ - check_b_) <= (double)(eps))) { \
+            std::fprintf(stderr, "%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g\n", __FILE__, __LINE__, #a, #b, check_a_, check_b_); \
+            ++testutil::Failures(); \
+        } \
+    } while (0)
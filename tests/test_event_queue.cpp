@@ -0,0 +1,222 @@
+// Tests for event_queue.h
+// Ordering of the events-lost notice, the session-state reserve, and a multi-producer stress run against one consumer
+
+#include "event_queue.h"
+#include "test_common.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Ring = events::Ring<64>;
+
+const XrSession kSession = (XrSession)(uintptr_t)0x1234;
+
+XrStructureType TypeOf(const XrEventDataBuffer& b) {
+    return b.type;
+}
+
+template <typename E>
+E As(const XrEventDataBuffer& b) {
+    E e;
+    std::memcpy(&e, &b, sizeof(E));
+    return e;
+}
+
+events::Record Mask(uint32_t producer, uint32_t sequence) {
+    return events::VisibilityMaskChanged(kSession, (XrViewConfigurationType)producer, sequence);
+}
+
+void TestExpandedEvents() {
+    XrEventDataBuffer b{};
+    events::Expand(events::SessionStateChanged(kSession, XR_SESSION_STATE_FOCUSED, 99), b);
+    const auto state = As<XrEventDataSessionStateChanged>(b);
+    CHECK(state.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED && state.next == nullptr);
+    CHECK(state.session == kSession && state.state == XR_SESSION_STATE_FOCUSED && state.time == 99);
+    events::Expand(events::InteractionProfileChanged(kSession), b);
+    CHECK(TypeOf(b) == XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED);
+    events::ExpandEventsLost(5, b);
+    const auto lost = As<XrEventDataEventsLost>(b);
+    CHECK(lost.type == XR_TYPE_EVENT_DATA_EVENTS_LOST && lost.next == nullptr && lost.lostEventCount == 5);
+}
+
+void TestFifo() {
+    Ring ring;
+    XrEventDataBuffer b{};
+    CHECK(!ring.Deliver(b));
+    for (uint32_t i = 0; i < 10; ++i) CHECK(ring.Push(Mask(0, i)));
+    CHECK(ring.Size() == 10);
+    for (uint32_t i = 0; i < 10; ++i) {
+        CHECK(ring.Deliver(b));
+        CHECK(As<XrEventDataVisibilityMaskChangedKHR>(b).viewIndex == i);
+    }
+    CHECK(!ring.Deliver(b));
+}
+
+void TestReserveKeepsRoomForStateChanges() {
+    Ring ring;
+    uint32_t accepted = 0;
+    while (ring.Push(Mask(0, accepted))) ++accepted;
+    CHECK(accepted == 64 - Ring::kReserved);
+    CHECK(!ring.Push(events::InteractionProfileChanged(kSession)));
+    // Session state changes still get in, up to the full capacity
+    for (size_t i = 0; i < Ring::kReserved; ++i) CHECK(ring.Push(events::SessionStateChanged(kSession, XR_SESSION_STATE_READY, (XrTime)i)));
+    CHECK(!ring.Push(events::SessionStateChanged(kSession, XR_SESSION_STATE_READY, 0)));
+    CHECK(ring.Size() == 64);
+}
+
+void TestLostNoticeFollowsEarlierRecords() {
+    Ring ring;
+    const uint32_t room = (uint32_t)(64 - Ring::kReserved);
+    for (uint32_t i = 0; i < room; ++i) CHECK(ring.Push(Mask(0, i)));
+    CHECK(!ring.Push(Mask(0, 1000)));
+    CHECK(!ring.Push(Mask(0, 1001)));
+
+    // Free some room and queue more after the drop
+    XrEventDataBuffer b{};
+    for (uint32_t i = 0; i < 4; ++i) {
+        CHECK(ring.Deliver(b));
+        CHECK(As<XrEventDataVisibilityMaskChangedKHR>(b).viewIndex == i);
+    }
+    for (uint32_t i = 0; i < 4; ++i) CHECK(ring.Push(Mask(0, 2000 + i)));
+    CHECK(!ring.Push(events::InteractionProfileChanged(kSession)));  // Third drop, still one notice
+    CHECK(ring.Push(events::SessionStateChanged(kSession, XR_SESSION_STATE_STOPPING, 7)));
+
+    // Everything queued before the first drop, then the notice, then what came after
+    for (uint32_t i = 4; i < room; ++i) {
+        CHECK(ring.Deliver(b));
+        CHECK(TypeOf(b) == XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR);
+        CHECK(As<XrEventDataVisibilityMaskChangedKHR>(b).viewIndex == i);
+    }
+    CHECK(ring.Deliver(b));
+    CHECK(TypeOf(b) == XR_TYPE_EVENT_DATA_EVENTS_LOST);
+    CHECK(As<XrEventDataEventsLost>(b).lostEventCount == 3);
+    for (uint32_t i = 0; i < 4; ++i) {
+        CHECK(ring.Deliver(b));
+        CHECK(As<XrEventDataVisibilityMaskChangedKHR>(b).viewIndex == 2000 + i);
+    }
+    CHECK(ring.Deliver(b));
+    CHECK(As<XrEventDataSessionStateChanged>(b).state == XR_SESSION_STATE_STOPPING);
+    CHECK(!ring.Deliver(b));
+
+    // A later overflow gets its own notice
+    for (uint32_t i = 0; i < room; ++i) ring.Push(Mask(0, i));
+    CHECK(!ring.Push(Mask(0, 0)));
+    uint32_t delivered = 0, notices = 0;
+    while (ring.Deliver(b)) {
+        if (TypeOf(b) == XR_TYPE_EVENT_DATA_EVENTS_LOST) {
+            ++notices;
+            CHECK(delivered == room);
+        }
+        else {
+            ++delivered;
+        }
+    }
+    CHECK(notices == 1 && delivered == room);
+}
+
+void TestWrapAround() {
+    // Many laps of the ring, so positions wrap the cell index many times over
+    Ring ring;
+    XrEventDataBuffer b{};
+    for (uint32_t i = 0; i < 100000; ++i) {
+        CHECK(ring.Push(Mask(0, i)));
+        if (i % 3 == 2) {
+            for (uint32_t k = 0; k < 3; ++k) CHECK(ring.Deliver(b));
+        }
+    }
+}
+
+void TestMultiProducerStress() {
+    // Four producers flood masks while a fifth pushes state changes at most 8 ahead of the consumer.
+    // Per producer, records arrive in order; every drop is reported; no state change is ever dropped.
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kPerProducer = 50000;
+    constexpr uint32_t kStates = 5000;
+    Ring ring;
+    std::atomic<uint32_t> dropped{ 0 };
+    std::atomic<uint32_t> statesSeen{ 0 };
+    std::atomic<uint32_t> stateDrops{ 0 };
+    std::atomic<uint32_t> producersDone{ 0 };
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (uint32_t i = 0; i < kPerProducer; ++i) {
+                if (!ring.Push(Mask(p, i))) dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            producersDone.fetch_add(1);
+        });
+    }
+    threads.emplace_back([&] {
+        for (uint32_t i = 0; i < kStates; ++i) {
+            while (i - statesSeen.load(std::memory_order_acquire) >= 8) std::this_thread::yield();
+            if (!ring.Push(events::SessionStateChanged(kSession, XR_SESSION_STATE_VISIBLE, (XrTime)i))) stateDrops.fetch_add(1);
+        }
+        producersDone.fetch_add(1);
+    });
+
+    uint32_t next[kProducers] = {};
+    uint32_t masks = 0, lost = 0, outOfOrder = 0, nextState = 0;
+    XrEventDataBuffer b{};
+    for (;;) {
+        const bool finished = producersDone.load(std::memory_order_acquire) == kProducers + 1;
+        if (!ring.Deliver(b)) {
+            if (finished && !ring.Deliver(b)) break;
+            if (!finished) {
+                std::this_thread::yield();
+                continue;
+            }
+        }
+        switch (TypeOf(b)) {
+        case XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR: {
+            const auto e = As<XrEventDataVisibilityMaskChangedKHR>(b);
+            const uint32_t p = (uint32_t)e.viewConfigurationType;
+            if (p >= kProducers || e.viewIndex < next[p]) ++outOfOrder;
+            else next[p] = e.viewIndex + 1;
+            ++masks;
+            break;
+        }
+        case XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED: {
+            if (As<XrEventDataSessionStateChanged>(b).time != (XrTime)nextState) ++outOfOrder;
+            ++nextState;
+            statesSeen.store(nextState, std::memory_order_release);
+            break;
+        }
+        case XR_TYPE_EVENT_DATA_EVENTS_LOST:
+            lost += As<XrEventDataEventsLost>(b).lostEventCount;
+            break;
+        default:
+            ++outOfOrder;
+            break;
+        }
+    }
+    for (std::thread& t : threads) t.join();
+    while (ring.Deliver(b)) {
+        if (TypeOf(b) == XR_TYPE_EVENT_DATA_EVENTS_LOST) lost += As<XrEventDataEventsLost>(b).lostEventCount;
+        else ++masks;
+    }
+
+    CHECK(outOfOrder == 0);
+    CHECK(stateDrops.load() == 0);
+    CHECK(nextState == kStates);
+    CHECK(lost == dropped.load());
+    CHECK(masks + dropped.load() == kProducers * kPerProducer);
+    CHECK(ring.Size() == 0);
+}
+
+} // namespace
+
+int main() {
+    TestExpandedEvents();
+    TestFifo();
+    TestReserveKeepsRoomForStateChanges();
+    TestLostNoticeFollowsEarlierRecords();
+    TestWrapAround();
+    TestMultiProducerStress();
+    return testutil::Finish();
+}
@@ -0,0 +1,146 @@
+// Tests for frame_synthesis.h
+// Pose extrapolation limits, block matching on a known shift, and motion vectors at full and reduced resolution
+
+#include "frame_synthesis.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+XrPosef Pose(float yaw, float x) {
+    XrPosef p;
+    p.orientation = { 0.0f, sinf(yaw * 0.5f), 0.0f, cosf(yaw * 0.5f) };
+    p.position = { x, 0.0f, 0.0f };
+    return p;
+}
+
+float Yaw(const XrPosef& p) {
+    return 2.0f * atan2f(p.orientation.y, p.orientation.w);
+}
+
+// Pseudo-random texture, shifted by (dx, dy)
+std::vector<uint32_t> TexturedImage(uint32_t width, uint32_t height, int dx, int dy) {
+    std::vector<uint32_t> img((size_t)width * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint32_t h = (uint32_t)((int)x - dx) * 73856093u ^ (uint32_t)((int)y - dy) * 19349663u;
+            h ^= h >> 13;
+            h *= 0x5bd1e995u;
+            h ^= h >> 15;
+            img[(size_t)y * width + x] = (h & 0x00FFFFFFu) | 0xFF000000u;
+        }
+    }
+    return img;
+}
+
+void TestExtrapolatePose() {
+    const XrPosef a = Pose(0.0f, 0.0f), b = Pose(0.1f, 0.01f);
+    const XrPosef same = synth::ExtrapolatePose(a, b, 1.0f);
+    CHECK_NEAR(Yaw(same), 0.1f, 1e-5f);
+    CHECK_NEAR(same.position.x, 0.01f, 1e-6f);
+
+    // Half an interval past the newer pose
+    const XrPosef ahead = synth::ExtrapolatePose(a, b, 1.5f);
+    CHECK_NEAR(Yaw(ahead), 0.15f, 1e-4f);
+    CHECK_NEAR(ahead.position.x, 0.015f, 1e-6f);
+
+    // One bad sample can't throw the view further than the clamps
+    const XrPosef wild = synth::ExtrapolatePose(a, Pose(1.0f, 1.0f), 2.0f);
+    CHECK_NEAR(Yaw(wild), 1.0f + synth::kMaxExtrapolatedRadians, 1e-4f);
+    CHECK_NEAR(wild.position.x, 1.0f + synth::kMaxExtrapolatedMeters, 1e-5f);
+}
+
+void TestBlockMatchingFindsShift() {
+    const uint32_t width = 256, height = 128;
+    const std::vector<uint32_t> prev = TexturedImage(width, height, 0, 0);
+    const std::vector<uint32_t> cur = TexturedImage(width, height, 8, -4);  // Content moved 8 right, 4 up
+    std::vector<uint8_t> prevLuma, curLuma;
+    uint32_t lw = 0, lh = 0;
+    synth::DownsampleLuma(prev.data(), width, height, synth::kLumaDownsample, prevLuma, lw, lh);
+    synth::DownsampleLuma(cur.data(), width, height, synth::kLumaDownsample, curLuma, lw, lh);
+    CHECK(lw == width / synth::kLumaDownsample && lh == height / synth::kLumaDownsample);
+
+    synth::MotionField field;
+    synth::EstimateMotion(prevLuma.data(), curLuma.data(), lw, lh, synth::kLumaDownsample, field);
+    CHECK(field.blocksX == lw / synth::kMotionBlockSize && field.blocksY == lh / synth::kMotionBlockSize);
+    // Interior blocks (the search window can't see past the image edge)
+    uint32_t matched = 0, interior = 0;
+    for (uint32_t by = 1; by + 1 < field.blocksY; ++by) {
+        for (uint32_t bx = 1; bx + 1 < field.blocksX; ++bx) {
+            const size_t i = (size_t)by * field.blocksX + bx;
+            ++interior;
+            if (field.dx[i] == 8.0f && field.dy[i] == -4.0f) ++matched;
+        }
+    }
+    CHECK(interior > 0 && matched == interior);
+
+    // Half a frame further along is 4 right, 2 up
+    std::vector<uint32_t> dst(cur.size());
+    synth::ExtrapolateWithField(cur.data(), width, height, field, 0.5f, dst.data());
+    const std::vector<uint32_t> expected = TexturedImage(width, height, 12, -6);
+    const uint32_t x = width / 2, y = height / 2;
+    CHECK(dst[(size_t)y * width + x] == expected[(size_t)y * width + x]);
+}
+
+void TestMotionVectorsShift() {
+    // A uniform NDC motion of (2k / width, 0) is k pixels; extrapolating half a frame moves by k/2
+    const uint32_t width = 64, height = 32;
+    const std::vector<uint32_t> cur = TexturedImage(width, height, 0, 0);
+    std::vector<float> motion((size_t)width * height * 4, 0.0f);
+    for (size_t i = 0; i < motion.size(); i += 4) {
+        motion[i] = 2.0f * 4.0f / (float)width;
+        motion[i + 1] = -2.0f * 2.0f / (float)height;  // NDC y is up: 2 pixels down
+    }
+    std::vector<uint32_t> dst(cur.size());
+    synth::ExtrapolateWithMotionVectors(cur.data(), width, height, motion.data(), width, height, 4, 0.5f, dst.data());
+    for (uint32_t y = 1; y < height; ++y) {
+        for (uint32_t x = 2; x < width; ++x) CHECK(dst[(size_t)y * width + x] == cur[(size_t)(y - 1) * width + x - 2]);
+    }
+
+    // No vectors: the frame is passed through
+    synth::ExtrapolateWithMotionVectors(cur.data(), width, height, motion.data(), 0, 0, 4, 0.5f, dst.data());
+    CHECK(dst == cur);
+}
+
+void TestHalfSizeMotionVectorsMatchFullSize() {
+    // Vectors that are constant over 2x2 pixels give the same result at half resolution
+    const uint32_t width = 96, height = 64;
+    const std::vector<uint32_t> cur = TexturedImage(width, height, 0, 0);
+    std::vector<float> full((size_t)width * height * 2), half((size_t)(width / 2) * (height / 2) * 2);
+    for (uint32_t y = 0; y < height / 2; ++y) {
+        for (uint32_t x = 0; x < width / 2; ++x) {
+            const float mx = 0.02f * (float)((x * 7 + y) % 5) - 0.04f;
+            const float my = 0.03f * (float)((x + y * 3) % 4) - 0.045f;
+            half[((size_t)y * (width / 2) + x) * 2] = mx;
+            half[((size_t)y * (width / 2) + x) * 2 + 1] = my;
+            for (uint32_t sy = 0; sy < 2; ++sy) {
+                for (uint32_t sx = 0; sx < 2; ++sx) {
+                    const size_t i = ((size_t)(y * 2 + sy) * width + x * 2 + sx) * 2;
+                    full[i] = mx;
+                    full[i + 1] = my;
+                }
+            }
+        }
+    }
+    std::vector<uint32_t> fromFull(cur.size()), fromHalf(cur.size());
+    synth::ExtrapolateWithMotionVectors(cur.data(), width, height, full.data(), width, height, 2, 0.5f, fromFull.data());
+    synth::ExtrapolateWithMotionVectors(cur.data(), width, height, half.data(), width / 2, height / 2, 2, 0.5f, fromHalf.data());
+    CHECK(fromFull == fromHalf);
+
+    // Odd ratios stay inside the vector image
+    std::vector<float> odd((size_t)7 * 5 * 2, 0.01f);
+    synth::ExtrapolateWithMotionVectors(cur.data(), width, height, odd.data(), 7, 5, 2, 0.5f, fromHalf.data());
+}
+
+} // namespace
+
+int main() {
+    TestExtrapolatePose();
+    TestBlockMatchingFindsShift();
+    TestMotionVectorsShift();
+    TestHalfSizeMotionVectorsMatchFullSize();
+    return testutil::Finish();
+}
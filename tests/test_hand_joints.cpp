@@ -0,0 +1,213 @@
+// Tests for hand_joints.h and the hand and analog sections of udp_packet.h
+// Covers the smallest-three joint codec, the base64 hand section of the pose datagram, analog validation and the mirrored left hand
+
+#include "hand_joints.h"
+#include "udp_packet.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace {
+
+using handjoints::Skeleton;
+
+uint32_t g_seed = 2024u;
+
+float RandomUnit() {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (float)(g_seed >> 8) / 16777216.0f * 2.0f - 1.0f;
+}
+
+XrQuaternionf Normalized(XrQuaternionf q) {
+    const float len = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    return XrQuaternionf{ q.x / len, q.y / len, q.z / len, q.w / len };
+}
+
+// 1 for the same rotation (q and -q included)
+float SameRotation(const XrQuaternionf& a, const XrQuaternionf& b) {
+    return std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+}
+
+Skeleton RandomSkeleton() {
+    Skeleton s;
+    for (size_t i = 0; i < handjoints::kJointCount; ++i) {
+        XrQuaternionf q = Normalized({ RandomUnit(), RandomUnit(), RandomUnit(), RandomUnit() });
+        // Every joint index lands on a different largest component at least once
+        float* c[4] = { &q.x, &q.y, &q.z, &q.w };
+        *c[i % 4] = std::copysign(1.5f, *c[i % 4]);
+        q = Normalized(q);
+        const XrPosef pose{ q, { RandomUnit() * 0.2f, RandomUnit() * 0.2f, RandomUnit() * 0.2f } };
+        s.Set(i, pose, 0.004f + 0.012f * (RandomUnit() * 0.5f + 0.5f));
+    }
+    return s;
+}
+
+int CompareSkeletons(const Skeleton& a, const Skeleton& b) {
+    int bad = 0;
+    for (size_t i = 0; i < handjoints::kJointCount; ++i) {
+        const XrPosef pa = a.Pose(i), pb = b.Pose(i);
+        const float posTol = 0.5f / handjoints::kPositionScale + 1e-6f;
+        if (std::fabs(pa.position.x - pb.position.x) > posTol) ++bad;
+        if (std::fabs(pa.position.y - pb.position.y) > posTol) ++bad;
+        if (std::fabs(pa.position.z - pb.position.z) > posTol) ++bad;
+        if (SameRotation(pa.orientation, pb.orientation) < 1.0f - 5e-6f) ++bad;  // ~0.35 degrees
+        if (std::fabs(a.radius[i] - b.radius[i]) > handjoints::kRadiusStep * 0.5f + 1e-6f) ++bad;
+    }
+    return bad;
+}
+
+void TestCodecRoundTrip() {
+    for (int round = 0; round < 50; ++round) {
+        const Skeleton src = RandomSkeleton();
+        const std::string text = handjoints::EncodeHand(src);
+        CHECK(text.size() == handjoints::kEncodedHandChars);
+        Skeleton dst;
+        CHECK(handjoints::DecodeHand(text, dst));
+        CHECK(CompareSkeletons(src, dst) == 0);
+        // Decoded quaternions are unit length
+        for (size_t i = 0; i < handjoints::kJointCount; ++i) {
+            const XrQuaternionf q = dst.Pose(i).orientation;
+            CHECK_NEAR(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w, 1.0f, 1e-5f);
+        }
+        // Encoding the decoded hand reproduces the same text
+        CHECK(handjoints::EncodeHand(dst) == text);
+    }
+}
+
+void TestCodecSignAndClamps() {
+    // q and -q encode identically; out-of-range positions and radii clamp instead of wrapping
+    Skeleton a, b;
+    const XrQuaternionf q = Normalized({ 0.1f, -0.7f, 0.2f, 0.3f });
+    a.Set(0, XrPosef{ q, { 5.0f, -5.0f, 0.0f } }, 1.0f);
+    b.Set(0, XrPosef{ { -q.x, -q.y, -q.z, -q.w }, { 5.0f, -5.0f, 0.0f } }, 1.0f);
+    CHECK(handjoints::EncodeHand(a) == handjoints::EncodeHand(b));
+    Skeleton d;
+    CHECK(handjoints::DecodeHand(handjoints::EncodeHand(a), d));
+    CHECK_NEAR(d.px[0], 32767.0f / handjoints::kPositionScale, 1e-6f);
+    CHECK_NEAR(d.py[0], -32767.0f / handjoints::kPositionScale, 1e-6f);
+    CHECK_NEAR(d.radius[0], 63 * handjoints::kRadiusStep, 1e-6f);
+    CHECK(SameRotation(d.Pose(0).orientation, q) > 0.99999f);
+}
+
+void TestDecodeRejectsMalformed() {
+    const std::string good = handjoints::EncodeHand(RandomSkeleton());
+    Skeleton s;
+    s.px[0] = 123.0f;
+    CHECK(!handjoints::DecodeHand(good.substr(1), s));
+    CHECK(!handjoints::DecodeHand(good + "A", s));
+    CHECK(!handjoints::DecodeHand("", s));
+    std::string bad = good;
+    bad[10] = '*';
+    CHECK(!handjoints::DecodeHand(bad, s));
+    bad = good;
+    bad[8] = '=';  // Padding only in the last group
+    CHECK(!handjoints::DecodeHand(bad, s));
+    CHECK(s.px[0] == 123.0f);  // Untouched on failure
+}
+
+std::string BasePacket() {
+    std::string p = "client";
+    for (int i = 0; i < 28; ++i) p += " " + std::to_string(i * 0.5f);
+    return p + " 77 TFTFTFTFTFTFTFTFTFT";
+}
+
+void TestPacketHandSections() {
+    Skeleton left, right;
+    handjoints::Synthesize(false, handjoints::Curls{ 0.2f, 0.4f, 0.6f, 0.8f, 1.0f }, left);
+    handjoints::Synthesize(true, handjoints::Curls{}, right);
+    const std::string l = handjoints::EncodeHand(left), r = handjoints::EncodeHand(right);
+
+    udppkt::Packet packet;
+    CHECK(udppkt::Parse(BasePacket(), packet));
+    CHECK(packet.frameID == 77 && !packet.hasHand[0] && !packet.hasHand[1]);
+
+    // Both hands, among the other optional sections, in any order
+    CHECK(udppkt::Parse(BasePacket() + " hand R " + r + " analog 0.1 0.2 0.3 0.4 hand L " + l + " touch TFTFTFTFTF", packet));
+    CHECK(packet.hasHand[0] && packet.hasHand[1]);
+    CHECK(packet.hasAnalog && packet.hasTouch);
+    CHECK(CompareSkeletons(packet.hands[0], left) == 0);
+    CHECK(CompareSkeletons(packet.hands[1], right) == 0);
+
+    // One hand only; the other is not tracked this packet
+    CHECK(udppkt::Parse(BasePacket() + " hand L " + l, packet));
+    CHECK(packet.hasHand[0] && !packet.hasHand[1]);
+
+    // A corrupt or truncated hand is dropped, the rest of the packet still parses
+    CHECK(udppkt::Parse(BasePacket() + " hand R " + r.substr(0, 100) + " analog 1 1 1 1", packet));
+    CHECK(!packet.hasHand[1] && packet.hasAnalog);
+    CHECK(udppkt::Parse(BasePacket() + " hand X " + l + " hand", packet));
+    CHECK(!packet.hasHand[0] && !packet.hasHand[1]);
+}
+
+void TestPacketAnalogSection() {
+    udppkt::Packet packet;
+    CHECK(udppkt::Parse(BasePacket() + " analog -0.5 0.25 1.5 1", packet));
+    CHECK(packet.hasAnalog);
+    CHECK(packet.analog[0] == 0.0f && packet.analog[1] == 0.25f && packet.analog[2] == 1.0f && packet.analog[3] == 1.0f);
+
+    // Non-finite values drop the whole section; the rest of the packet still parses
+    for (const char* bad : { "nan", "-nan", "inf", "-inf" }) {
+        CHECK(udppkt::Parse(BasePacket() + " analog 0.1 " + bad + " 0.3 0.4 touch TTTTTTTTTT", packet));
+        CHECK(!packet.hasAnalog && packet.hasTouch);
+    }
+    CHECK(udppkt::Parse(BasePacket() + " analog 0.1 0.2", packet));
+    CHECK(!packet.hasAnalog);
+}
+
+void TestLeftHandMirrorsRight() {
+    const handjoints::Curls curls{ 0.3f, 0.9f, 0.5f, 0.1f, 0.7f };
+    Skeleton left, right;
+    handjoints::Synthesize(false, curls, left);
+    handjoints::Synthesize(true, curls, right);
+    for (size_t i = 0; i < handjoints::kJointCount; ++i) {
+        // Mirror across YZ: x flips, and so do the rotation components about Y and Z
+        CHECK(left.px[i] == -right.px[i] && left.py[i] == right.py[i] && left.pz[i] == right.pz[i]);
+        CHECK(left.qx[i] == right.qx[i] && left.qy[i] == -right.qy[i] && left.qz[i] == -right.qz[i] && left.qw[i] == right.qw[i]);
+        CHECK(left.radius[i] == right.radius[i]);
+    }
+    // Right thumb toward -X, left toward +X
+    CHECK(right.px[XR_HAND_JOINT_THUMB_TIP_EXT] < 0.0f && left.px[XR_HAND_JOINT_THUMB_TIP_EXT] > 0.0f);
+
+    // The mirrored orientations are still proper rotations that carry each bone to the next joint
+    for (const auto& finger : handjoints::detail::kFingers) {
+        for (uint32_t b = 0; b < finger.boneCount; ++b) {
+            const uint32_t j = finger.firstJoint + b;
+            const XrVector3f d = handjoints::detail::Rotate(left.Pose(j).orientation, XrVector3f{ 0.0f, 0.0f, -finger.length[b] });
+            CHECK_NEAR(left.px[j] + d.x, left.px[j + 1], 1e-5f);
+            CHECK_NEAR(left.py[j] + d.y, left.py[j + 1], 1e-5f);
+            CHECK_NEAR(left.pz[j] + d.z, left.pz[j + 1], 1e-5f);
+        }
+    }
+}
+
+void TestTransformMatchesScalar() {
+    const Skeleton local = RandomSkeleton();
+    const XrPosef base{ Normalized({ 0.2f, -0.4f, 0.1f, 0.9f }), { 0.3f, 1.5f, -0.2f } };
+    XrHandJointLocationEXT out[handjoints::kJointCount];
+    handjoints::Transform(base, local, out, handjoints::kJointCount, XR_SPACE_LOCATION_POSITION_VALID_BIT);
+    for (size_t i = 0; i < handjoints::kJointCount; ++i) {
+        const XrVector3f v = handjoints::detail::Rotate(base.orientation, local.Pose(i).position);
+        const XrQuaternionf q = handjoints::detail::Mul(base.orientation, local.Pose(i).orientation);
+        CHECK_NEAR(out[i].pose.position.x, base.position.x + v.x, 1e-5f);
+        CHECK_NEAR(out[i].pose.position.y, base.position.y + v.y, 1e-5f);
+        CHECK_NEAR(out[i].pose.position.z, base.position.z + v.z, 1e-5f);
+        CHECK(SameRotation(out[i].pose.orientation, q) > 0.99999f);
+        CHECK(out[i].radius == local.radius[i]);
+        CHECK(out[i].locationFlags == XR_SPACE_LOCATION_POSITION_VALID_BIT);
+    }
+}
+
+} // namespace
+
+int main() {
+    TestCodecRoundTrip();
+    TestCodecSignAndClamps();
+    TestDecodeRejectsMalformed();
+    TestPacketHandSections();
+    TestPacketAnalogSection();
+    TestLeftHandMirrorsRight();
+    TestTransformMatchesScalar();
+    return testutil::Finish();
+}
@@ -0,0 +1,164 @@
+// Tests for handle_table.h
+// Handles are checked for stale generations, foreign types, generation wraparound, slot reuse and Clear
+
+#include "handle_table.h"
+#include "test_common.h"
+
+#include <openxr/openxr.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using handles::HandleType;
+using IntTable = handles::Table<int, HandleType::Space>;
+
+void TestEncodeRoundTrip() {
+    const uint64_t h = handles::Encode(HandleType::Action, 0x123456u, 0xDEADBEEFu);
+    CHECK(handles::TypeOf(h) == HandleType::Action);
+    CHECK(handles::GenerationOf(h) == 0x123456u);
+    CHECK(handles::IndexOf(h) == 0xDEADBEEFu);
+    // Generations wider than 24 bits are truncated, never bleed into the type
+    CHECK(handles::TypeOf(handles::Encode(HandleType::Space, 0xFFFFFFFFu, 0)) == HandleType::Space);
+}
+
+void TestInsertGetRemove() {
+    IntTable table;
+    const uint64_t a = table.Insert(10), b = table.Insert(20);
+    CHECK(a != 0 && b != 0 && a != b);
+    CHECK(table.Size() == 2);
+    CHECK(table.Get(a) && *table.Get(a) == 10);
+    CHECK(table.Get(b) && *table.Get(b) == 20);
+    CHECK(table.Remove(a));
+    CHECK(!table.Remove(a));
+    CHECK(!table.Contains(a));
+    CHECK(table.Contains(b));
+    CHECK(table.Size() == 1);
+    CHECK(!table.Get(0));
+    CHECK(!table.Get(handles::Encode(HandleType::Space, 1, 99)));  // Index past the end
+}
+
+void TestStaleGeneration() {
+    IntTable table;
+    const uint64_t old = table.Insert(1);
+    table.Remove(old);
+    const uint64_t reused = table.Insert(2);
+    // Same slot, new generation: the old handle must not reach the new object
+    CHECK(handles::IndexOf(reused) == handles::IndexOf(old));
+    CHECK(handles::GenerationOf(reused) == handles::GenerationOf(old) + 1);
+    CHECK(!table.Get(old));
+    CHECK(!table.Remove(old));
+    CHECK(table.Get(reused) && *table.Get(reused) == 2);
+}
+
+void TestTypeMismatch() {
+    IntTable spaces;
+    handles::Table<int, HandleType::Action> actions;
+    const uint64_t space = spaces.Insert(1);
+    const uint64_t action = actions.Insert(2);
+    // Same index and generation, different type byte
+    CHECK(handles::IndexOf(space) == handles::IndexOf(action));
+    CHECK(!spaces.Get(action));
+    CHECK(!actions.Get(space));
+    CHECK(!spaces.Remove(action));
+    CHECK(spaces.Size() == 1);
+}
+
+void TestGenerationWraparound() {
+    IntTable table;
+    uint64_t h = table.Insert(0);
+    const uint64_t first = h;
+    // Walk one slot through every generation; it skips 0 on the way round so no handle is ever null
+    for (uint64_t i = 1; i < handles::kGenerationMask; ++i) {
+        table.Remove(h);
+        h = table.Insert((int)i);
+    }
+    CHECK(handles::GenerationOf(h) == handles::kGenerationMask);
+    CHECK(!table.Get(first));
+    table.Remove(h);
+    const uint64_t wrapped = table.Insert(-1);
+    CHECK(handles::GenerationOf(wrapped) == 1);
+    CHECK(handles::IndexOf(wrapped) == handles::IndexOf(first));
+    CHECK(wrapped != 0);
+    CHECK(!table.Get(h));
+    CHECK(table.Get(wrapped) && *table.Get(wrapped) == -1);
+}
+
+void TestFreeListReuse() {
+    IntTable table;
+    std::vector<uint64_t> hs;
+    for (int i = 0; i < 8; ++i) hs.push_back(table.Insert(i));
+    table.Remove(hs[2]);
+    table.Remove(hs[5]);
+    // Most recently freed slot first, and no growth while free slots remain
+    const uint64_t a = table.Insert(50), b = table.Insert(20);
+    CHECK(handles::IndexOf(a) == handles::IndexOf(hs[5]));
+    CHECK(handles::IndexOf(b) == handles::IndexOf(hs[2]));
+    const uint64_t c = table.Insert(80);
+    CHECK(handles::IndexOf(c) == 8);
+    CHECK(table.Size() == 9);
+
+    int visited = 0, sum = 0;
+    table.ForEach([&](uint64_t h, int& v) {
+        CHECK(table.Get(h) == &v);
+        ++visited;
+        sum += v;
+    });
+    CHECK(visited == 9);
+    CHECK(sum == 0 + 1 + 3 + 4 + 6 + 7 + 50 + 20 + 80);
+}
+
+void TestRemoveReleasesValue() {
+    handles::Table<std::shared_ptr<int>, HandleType::Swapchain> table;
+    auto value = std::make_shared<int>(7);
+    const uint64_t h = table.Insert(value);
+    CHECK(value.use_count() == 2);
+    table.Remove(h);
+    CHECK(value.use_count() == 1);
+}
+
+void TestClearKeepsHandlesStale() {
+    handles::Table<std::shared_ptr<int>, HandleType::Swapchain> table;
+    auto value = std::make_shared<int>(3);
+    const uint64_t a = table.Insert(value), b = table.Insert(nullptr);
+    table.Remove(b);
+    table.Clear();
+    CHECK(table.Size() == 0);
+    CHECK(value.use_count() == 1);
+    CHECK(!table.Get(a));
+    CHECK(!table.Get(b));
+    // Reused slots never hand out a handle equal to one from before the Clear
+    const uint64_t c = table.Insert(nullptr), d = table.Insert(nullptr);
+    CHECK(c != a && c != b && d != a && d != b);
+    CHECK(handles::IndexOf(c) == 0 && handles::IndexOf(d) == 1);
+    CHECK(!table.Get(a) && !table.Get(b));
+    CHECK(table.Contains(c) && table.Contains(d));
+    CHECK(handles::IndexOf(table.Insert(nullptr)) == 2);
+}
+
+void TestOpenXRHandleType() {
+    handles::Table<std::string, HandleType::Swapchain, XrSwapchain> table;
+    const XrSwapchain h = table.Insert("left");
+    CHECK(h != XR_NULL_HANDLE);
+    CHECK(handles::TypeOf(handles::ToBits(h)) == HandleType::Swapchain);
+    CHECK(table.Get(h) && *table.Get(h) == "left");
+    CHECK(!table.Get(XR_NULL_HANDLE));
+    CHECK(table.Remove(h));
+    CHECK(!table.Get(h));
+}
+
+} // namespace
+
+int main() {
+    TestEncodeRoundTrip();
+    TestInsertGetRemove();
+    TestStaleGeneration();
+    TestTypeMismatch();
+    TestGenerationWraparound();
+    TestFreeListReuse();
+    TestRemoveReleasesValue();
+    TestClearKeepsHandlesStale();
+    TestOpenXRHandleType();
+    return testutil::Finish();
+}
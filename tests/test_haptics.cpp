@@ -0,0 +1,162 @@
+// Tests for haptics.h
+// The scheduler is driven with explicit times, one Flush per simulated frame
+
+#include "haptics.h"
+#include "test_common.h"
+
+#include <openxr/openxr.h>
+#include <cstdint>
+
+namespace {
+
+constexpr int64_t kMs = 1000000;
+constexpr int64_t kStart = 5000 * kMs;   // QPC-like clock, far from zero
+
+struct Frame {
+    haptics::Output out[haptics::kHandCount];
+    bool changed[haptics::kHandCount]{};
+    bool any{ false };
+};
+
+Frame Flush(haptics::Scheduler& s, int64_t now) {
+    Frame f;
+    f.any = s.Flush(now, f.out, f.changed);
+    return f;
+}
+
+void TestFiniteVibrationRunsAndEnds() {
+    haptics::Scheduler s;
+    s.Apply(0, 1, 50 * kMs, 0.5f, 160.0f);
+    Frame f = Flush(s, kStart);
+    CHECK(f.any && f.changed[0] && !f.changed[1]);
+    CHECK(f.out[0].active && f.out[0].amplitude == 0.5f && f.out[0].frequency == 160.0f);
+    CHECK(f.out[0].remainingNs == 50 * kMs);
+    f = Flush(s, kStart + 20 * kMs);
+    CHECK(!f.any);
+    CHECK(f.out[0].remainingNs == 30 * kMs);
+    f = Flush(s, kStart + 50 * kMs);
+    CHECK(f.changed[0] && !f.out[0].active);
+}
+
+void TestInfiniteDurationSaturates() {
+    haptics::Scheduler s;
+    s.Apply(1, 7, XR_INFINITE_DURATION, 1.0f, 0.0f);
+    Frame f = Flush(s, kStart);
+    CHECK(f.changed[1] && f.out[1].active);
+    CHECK(f.out[1].remainingNs == haptics::kInfiniteNs);
+    // Still running far in the future: nowNs + duration would have wrapped negative
+    f = Flush(s, kStart + 3600ll * 1000 * kMs);
+    CHECK(!f.any && f.out[1].active);
+    CHECK(f.out[1].remainingNs == haptics::kInfiniteNs);
+    // A large finite duration that would also overflow saturates the same way
+    s.Apply(0, 8, INT64_MAX - 10, 0.3f, 0.0f);
+    f = Flush(s, kStart);
+    CHECK(f.out[0].active && f.out[0].remainingNs == haptics::kInfiniteNs);
+    s.Stop(1, 7);
+    f = Flush(s, kStart + 1);
+    CHECK(f.changed[1] && !f.out[1].active);
+}
+
+void TestMinAndNoDuration() {
+    // XR_MIN_HAPTIC_DURATION (-1) and XR_NO_DURATION (0) both give the shortest pulse, and it isn't lost to a late flush
+    for (int64_t duration : { (int64_t)-1, (int64_t)0 }) {
+        haptics::Scheduler s;
+        s.Apply(0, 1, duration, 0.8f, 0.0f);
+        Frame f = Flush(s, kStart + 100 * kMs);
+        CHECK(f.changed[0] && f.out[0].active);
+        CHECK(f.out[0].remainingNs == haptics::kMinDurationNs);
+        f = Flush(s, kStart + 100 * kMs + haptics::kMinDurationNs);
+        CHECK(f.changed[0] && !f.out[0].active);
+    }
+}
+
+void TestSameSourceReplaces() {
+    haptics::Scheduler s;
+    s.Apply(0, 1, 100 * kMs, 0.9f, 0.0f);
+    Flush(s, kStart);
+    s.Apply(0, 1, 20 * kMs, 0.2f, 0.0f);
+    Frame f = Flush(s, kStart + 10 * kMs);
+    CHECK(f.changed[0]);
+    CHECK(f.out[0].amplitude == 0.2f && f.out[0].remainingNs == 20 * kMs);
+    f = Flush(s, kStart + 30 * kMs);
+    CHECK(!f.out[0].active);  // The replaced 100 ms vibration is gone, not merged
+}
+
+void TestSourcesOverlapStrongestWins() {
+    haptics::Scheduler s;
+    s.Apply(0, 1, 100 * kMs, 0.3f, 100.0f);
+    s.Apply(0, 2, 40 * kMs, 0.7f, 200.0f);
+    Frame f = Flush(s, kStart);
+    CHECK(f.out[0].amplitude == 0.7f && f.out[0].frequency == 200.0f);
+    CHECK(f.out[0].remainingNs == 100 * kMs);
+    f = Flush(s, kStart + 40 * kMs);
+    CHECK(f.changed[0]);
+    CHECK(f.out[0].amplitude == 0.3f && f.out[0].frequency == 100.0f);
+}
+
+void TestSourceCapDropsOldest() {
+    haptics::Scheduler s;
+    // Source 1 is the strongest and the oldest; the ninth source pushes it out
+    s.Apply(0, 1, 100 * kMs, 1.0f, 0.0f);
+    for (uint64_t src = 2; src <= haptics::kMaxSourcesPerHand; ++src) s.Apply(0, src, 100 * kMs, 0.1f * (float)(src - 1), 0.0f);
+    Frame f = Flush(s, kStart);
+    CHECK(f.out[0].amplitude == 1.0f);
+    s.Apply(0, 100, 100 * kMs, 0.05f, 0.0f);
+    f = Flush(s, kStart + kMs);
+    CHECK_NEAR(f.out[0].amplitude, 0.1f * (float)(haptics::kMaxSourcesPerHand - 1), 1e-6);
+    // Replacing an existing source doesn't count against the cap
+    s.Apply(0, 3, 100 * kMs, 0.95f, 0.0f);
+    f = Flush(s, kStart + 2 * kMs);
+    CHECK(f.out[0].amplitude == 0.95f);
+    s.Stop(0, 2);
+    s.Stop(0, 100);
+    f = Flush(s, kStart + 3 * kMs);
+    CHECK(f.out[0].amplitude == 0.95f);
+}
+
+void TestStop() {
+    haptics::Scheduler s;
+    s.Apply(0, 1, 100 * kMs, 0.5f, 0.0f);
+    s.Apply(1, 1, 100 * kMs, 0.5f, 0.0f);
+    Flush(s, kStart);
+    s.Stop(0, 1);
+    s.Stop(0, 99);      // Unknown source: no effect
+    s.Stop(5, 1);       // Bad hand: ignored
+    Frame f = Flush(s, kStart + kMs);
+    CHECK(f.changed[0] && !f.out[0].active);
+    CHECK(!f.changed[1] && f.out[1].active);
+    // Stopping before the first flush means the vibration is never reported
+    s.Apply(0, 2, 100 * kMs, 0.5f, 0.0f);
+    s.Stop(0, 2);
+    f = Flush(s, kStart + 2 * kMs);
+    CHECK(!f.changed[0] && !f.out[0].active);
+}
+
+void TestClampsAndRestartReport() {
+    haptics::Scheduler s;
+    s.Apply(0, 1, 100 * kMs, 3.0f, -5.0f);
+    Frame f = Flush(s, kStart);
+    CHECK(f.out[0].amplitude == 1.0f && f.out[0].frequency == 0.0f);
+    // The same vibration again changes no output but restarts the clock, so it is sent again
+    s.Apply(0, 1, 100 * kMs, 1.0f, 0.0f);
+    f = Flush(s, kStart + 50 * kMs);
+    CHECK(f.changed[0]);
+    CHECK(f.out[0].remainingNs == 100 * kMs);
+    s.Clear();
+    f = Flush(s, kStart + 60 * kMs);
+    CHECK(!f.any && !f.out[0].active);
+}
+
+} // namespace
+
+int main() {
+    TestFiniteVibrationRunsAndEnds();
+    TestInfiniteDurationSaturates();
+    TestMinAndNoDuration();
+    TestSameSourceReplaces();
+    TestSourcesOverlapStrongestWins();
+    TestSourceCapDropsOldest();
+    TestStop();
+    TestClampsAndRestartReport();
+    return testutil::Finish();
+}
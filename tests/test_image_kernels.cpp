@@ -0,0 +1,205 @@
+// Tests for image_kernels.h
+// Every SIMD kernel is compared with its scalar reference over all small sizes, and the format conversions over every input code
+
+#include "image_kernels.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+uint32_t g_seed = 12345u;
+
+uint32_t Random() {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return g_seed;
+}
+
+std::vector<uint8_t> RandomBytes(size_t n) {
+    std::vector<uint8_t> v(n);
+    for (auto& b : v) b = (uint8_t)(Random() >> 24);
+    return v;
+}
+
+// Guard bytes around every destination catch stores that run past the end
+constexpr size_t kGuard = 64;
+constexpr uint8_t kGuardByte = 0xA5;
+
+bool GuardsIntact(const std::vector<uint8_t>& buf, size_t payload) {
+    for (size_t i = 0; i < kGuard; ++i) {
+        if (buf[i] != kGuardByte || buf[kGuard + payload + i] != kGuardByte) return false;
+    }
+    return true;
+}
+
+void TestFlipRows() {
+    for (size_t rowBytes = 1; rowBytes <= 80; ++rowBytes) {
+        for (uint32_t rows = 0; rows <= 9; ++rows) {
+            for (size_t extra = 0; extra <= 5; extra += 5) {
+                const size_t pitch = rowBytes + extra;
+                const std::vector<uint8_t> src = RandomBytes(pitch * rows + 1);
+                std::vector<uint8_t> ref = src, got = src;
+                imgk::FlipRowsInPlaceScalar(ref.data(), rowBytes, rows, pitch);
+                imgk::FlipRowsInPlace(got.data(), rowBytes, rows, extra ? pitch : 0);
+                CHECK(got == ref);
+            }
+        }
+    }
+    // Flipping twice is the identity, including at the sizes the preview uses
+    std::vector<uint8_t> img = RandomBytes((size_t)1832 * 4 * 17);
+    const std::vector<uint8_t> original = img;
+    imgk::FlipRowsInPlace(img.data(), (size_t)1832 * 4, 17);
+    CHECK(img != original);
+    imgk::FlipRowsInPlace(img.data(), (size_t)1832 * 4, 17);
+    CHECK(img == original);
+}
+
+void TestCopyFlipped() {
+    for (size_t rowBytes = 1; rowBytes <= 40; ++rowBytes) {
+        for (uint32_t rows = 0; rows <= 6; ++rows) {
+            const size_t srcPitch = rowBytes + 3, dstPitch = rowBytes + 7;
+            const std::vector<uint8_t> src = RandomBytes(srcPitch * rows + 1);
+            std::vector<uint8_t> dst(dstPitch * rows + 1, 0), ref(dstPitch * rows + 1, 0);
+            for (uint32_t y = 0; y < rows; ++y) {
+                std::memcpy(ref.data() + (size_t)y * dstPitch, src.data() + (size_t)(rows - 1 - y) * srcPitch, rowBytes);
+            }
+            imgk::CopyFlipped(dst.data(), dstPitch, src.data(), srcPitch, rowBytes, rows);
+            CHECK(dst == ref);
+        }
+    }
+}
+
+void TestSwizzleRB() {
+    for (size_t count = 0; count <= 70; ++count) {
+        for (size_t offset = 0; offset < 2; ++offset) {
+            // Misaligned by one pixel on the second pass
+            std::vector<uint32_t> src(count + offset);
+            for (auto& p : src) p = Random();
+            std::vector<uint32_t> ref(count), got(count + offset);
+            imgk::SwizzleRBScalar(ref.data(), src.data() + offset, count);
+            imgk::SwizzleRB(got.data() + offset, src.data() + offset, count);
+            CHECK(std::memcmp(got.data() + offset, ref.data(), count * 4) == 0);
+
+            // In place
+            std::vector<uint32_t> inPlace = src;
+            imgk::SwizzleRB(inPlace.data() + offset, inPlace.data() + offset, count);
+            CHECK(std::memcmp(inPlace.data() + offset, ref.data(), count * 4) == 0);
+        }
+    }
+    CHECK(imgk::detail::SwapRB(0x11223344u) == 0x11443322u);
+}
+
+void TestPackToBGR() {
+    for (size_t count = 0; count <= 70; ++count) {
+        for (int redFirst = 0; redFirst <= 1; ++redFirst) {
+            const std::vector<uint8_t> src = RandomBytes(count * 4);
+            std::vector<uint8_t> ref(count * 3 + 2 * kGuard, kGuardByte), got(count * 3 + 2 * kGuard, kGuardByte);
+            imgk::PackToBGRScalar(ref.data() + kGuard, src.data(), count, redFirst != 0);
+            imgk::PackToBGR(got.data() + kGuard, src.data(), count, redFirst != 0);
+            CHECK(got == ref);
+            CHECK(GuardsIntact(got, count * 3));
+            if (count > 0) {
+                // BMP order: blue first
+                CHECK(got[kGuard] == src[redFirst ? 2 : 0]);
+                CHECK(got[kGuard + 2] == src[redFirst ? 0 : 2]);
+            }
+        }
+    }
+}
+
+// Independent half decode: value = (-1)^s * 2^(e-15) * (1 + m/1024), denormals 2^-14 * m/1024
+double HalfReference(uint16_t h) {
+    const int sign = (h >> 15) & 1, exp = (h >> 10) & 0x1F, mant = h & 0x3FF;
+    double v;
+    if (exp == 0) v = std::ldexp((double)mant / 1024.0, -14);
+    else if (exp == 31) v = mant ? NAN : INFINITY;
+    else v = std::ldexp(1.0 + (double)mant / 1024.0, exp - 15);
+    return sign ? -v : v;
+}
+
+uint8_t ByteReference(double v, bool srgb) {
+    if (std::isnan(v) || v <= 0.0) return 0;
+    if (v >= 1.0) return 255;
+    if (srgb) v = (v <= 0.0031308) ? v * 12.92 : 1.055 * std::pow(v, 1.0 / 2.4) - 0.055;
+    return (uint8_t)std::lround(v * 255.0);
+}
+
+void TestHalfToFloatAllCodes() {
+    for (uint32_t h = 0; h <= 0xFFFF; ++h) {
+        const float f = imgk::detail::HalfToFloat((uint16_t)h);
+        const double ref = HalfReference((uint16_t)h);
+        if (std::isnan(ref)) CHECK(std::isnan(f));
+        else CHECK((double)f == ref);
+    }
+}
+
+void TestHalfToRGBA8AllCodes() {
+    // One pixel per code in every channel position
+    std::vector<uint16_t> src((size_t)65536 * 4);
+    for (uint32_t h = 0; h <= 0xFFFF; ++h) {
+        for (int c = 0; c < 4; ++c) src[(size_t)h * 4 + c] = (uint16_t)h;
+    }
+    std::vector<uint8_t> dst(src.size());
+    for (int srgb = 0; srgb <= 1; ++srgb) {
+        imgk::HalfToRGBA8(dst.data(), src.data(), 65536, srgb != 0);
+        int mismatches = 0;
+        for (uint32_t h = 0; h <= 0xFFFF; ++h) {
+            const double v = HalfReference((uint16_t)h);
+            const uint8_t color = ByteReference(v, srgb != 0), alpha = ByteReference(v, false);
+            // Float rounding in the table build may land a hair on the other side of a .5 boundary
+            for (int c = 0; c < 3; ++c) {
+                if (std::abs((int)dst[(size_t)h * 4 + c] - (int)color) > (srgb ? 1 : 0)) ++mismatches;
+            }
+            if (dst[(size_t)h * 4 + 3] != alpha) ++mismatches;
+        }
+        CHECK(mismatches == 0);
+    }
+    // The clamps the preview relies on
+    const uint16_t special[4] = { 0x7C00, 0xFC00, 0x7E00, 0x4000 };  // +inf, -inf, NaN, 2.0
+    uint8_t out[4];
+    imgk::HalfToRGBA8(out, special, 1, false);
+    CHECK(out[0] == 255 && out[1] == 0 && out[2] == 0 && out[3] == 255);
+}
+
+void TestUnorm1010102AllCodes() {
+    std::vector<uint32_t> src(1024 * 4);
+    for (uint32_t v = 0; v < 1024; ++v) {
+        for (uint32_t a = 0; a < 4; ++a) src[v * 4 + a] = v | (((v * 7) & 0x3FF) << 10) | (((1023 - v) & 0x3FF) << 20) | (a << 30);
+    }
+    std::vector<uint8_t> dst(src.size() * 4);
+    for (int srgb = 0; srgb <= 1; ++srgb) {
+        imgk::Unorm1010102ToRGBA8(dst.data(), src.data(), src.size(), srgb != 0);
+        int mismatches = 0;
+        for (size_t i = 0; i < src.size(); ++i) {
+            const uint32_t p = src[i];
+            for (int c = 0; c < 3; ++c) {
+                const uint8_t ref = ByteReference((double)((p >> (10 * c)) & 0x3FF) / 1023.0, srgb != 0);
+                if (std::abs((int)dst[i * 4 + c] - (int)ref) > (srgb ? 1 : 0)) ++mismatches;
+            }
+            if (dst[i * 4 + 3] != (uint8_t)((p >> 30) * 85)) ++mismatches;
+        }
+        CHECK(mismatches == 0);
+    }
+}
+
+} // namespace
+
+int main() {
+#if defined(IMGK_HAVE_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        std::printf("CPU has no AVX2, skipping\n");
+        return 0;
+    }
+#endif
+    TestFlipRows();
+    TestCopyFlipped();
+    TestSwizzleRB();
+    TestPackToBGR();
+    TestHalfToFloatAllCodes();
+    TestHalfToRGBA8AllCodes();
+    TestUnorm1010102AllCodes();
+    return testutil::Finish();
+}
@@ -0,0 +1,92 @@
+// Tests for interaction_profiles.h
+// Table lookups, identifier-only paths resolved by action type, and the shape of every profile table
+
+#include "interaction_profiles.h"
+#include "test_common.h"
+
+#include <string_view>
+
+namespace {
+
+using bindings::Input;
+using profiles::InputPath;
+
+template <size_t N>
+Input Find(const InputPath (&table)[N], std::string_view subpath, XrActionType type) {
+    const InputPath* found = profiles::FindInput(table, N, subpath, type);
+    return found ? found->input : (Input)0xFF;
+}
+
+constexpr Input kMissing = (Input)0xFF;
+
+void TestExactPaths() {
+    CHECK(Find(profiles::kTouchLeft, "/input/trigger/value", XR_ACTION_TYPE_FLOAT_INPUT) == Input::Trigger);
+    CHECK(Find(profiles::kTouchLeft, "/input/thumbstick", XR_ACTION_TYPE_VECTOR2F_INPUT) == Input::Thumbstick);
+    // Exact matches win whatever the action type
+    CHECK(Find(profiles::kTouchLeft, "/input/thumbstick/click", XR_ACTION_TYPE_FLOAT_INPUT) == Input::ThumbstickClick);
+    // Listed but nothing in the feed drives it
+    CHECK(Find(profiles::kTouchRight, "/output/haptic", XR_ACTION_TYPE_VIBRATION_OUTPUT) == Input::None);
+    CHECK(Find(profiles::kIndex, "/input/trackpad/x", XR_ACTION_TYPE_FLOAT_INPUT) == Input::None);
+}
+
+void TestIdentifierOnly() {
+    // Touch has no trigger/click: booleans fall back to the value
+    CHECK(Find(profiles::kTouchLeft, "/input/trigger", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Trigger);
+    CHECK(Find(profiles::kTouchLeft, "/input/trigger", XR_ACTION_TYPE_FLOAT_INPUT) == Input::Trigger);
+    CHECK(Find(profiles::kTouchRight, "/input/squeeze", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Squeeze);
+    CHECK(Find(profiles::kTouchRight, "/input/a", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Primary);
+    CHECK(Find(profiles::kPico4Left, "/input/squeeze", XR_ACTION_TYPE_FLOAT_INPUT) == Input::Squeeze);
+    CHECK(Find(profiles::kSimple, "/input/select", XR_ACTION_TYPE_BOOLEAN_INPUT) == Input::Trigger);
+    CHECK(Find(profiles::kTouchLeft, "/input/grip", XR_ACTION_TYPE_POSE_INPUT) == Input::Pose);
+    CHECK(Find(profiles::kTouchLeft, "/input/aim", XR_ACTION_TYPE_POSE_INPUT) == Input::Pose);
+    // The parent's pose is only implied for pose actions, and a float never picks a touch component
+    CHECK(Find(profiles::kTouchLeft, "/input/grip", XR_ACTION_TYPE_BOOLEAN_INPUT) == kMissing);
+    CHECK(Find(profiles::kTouchLeft, "/input/thumbrest", XR_ACTION_TYPE_FLOAT_INPUT) == kMissing);
+    // Not on this hand, or not a prefix at a component boundary
+    CHECK(Find(profiles::kTouchLeft, "/input/a", XR_ACTION_TYPE_BOOLEAN_INPUT) == kMissing);
+    CHECK(Find(profiles::kTouchLeft, "/input/trig", XR_ACTION_TYPE_FLOAT_INPUT) == kMissing);
+    CHECK(Find(profiles::kTouchLeft, "", XR_ACTION_TYPE_FLOAT_INPUT) == kMissing);
+}
+
+void TestDefaultComponents() {
+    const char* c[2];
+    CHECK(profiles::DefaultComponents(XR_ACTION_TYPE_BOOLEAN_INPUT, c) == 2 && std::string_view(c[0]) == "click");
+    CHECK(profiles::DefaultComponents(XR_ACTION_TYPE_FLOAT_INPUT, c) == 2 && std::string_view(c[0]) == "value");
+    CHECK(profiles::DefaultComponents(XR_ACTION_TYPE_POSE_INPUT, c) == 1 && std::string_view(c[0]) == "pose");
+    CHECK(profiles::DefaultComponents(XR_ACTION_TYPE_VECTOR2F_INPUT, c) == 0);
+    CHECK(profiles::DefaultComponents(XR_ACTION_TYPE_VIBRATION_OUTPUT, c) == 0);
+}
+
+bool WellFormedTable(const InputPath* inputs, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const std::string_view path = inputs[i].path;
+        if (path.substr(0, 7) != "/input/" && path != "/output/haptic") return false;
+        if (path.back() == '/') return false;
+        for (size_t j = i + 1; j < count; ++j) {
+            if (path == inputs[j].path) return false;
+        }
+    }
+    return true;
+}
+
+void TestProfileTables() {
+    for (const profiles::Profile& p : profiles::kProfiles) {
+        CHECK(std::string_view(p.path).substr(0, 22) == "/interaction_profiles/");
+        CHECK(WellFormedTable(p.left, p.leftCount));
+        CHECK(WellFormedTable(p.right, p.rightCount));
+        // Every profile offers both poses on both hands
+        CHECK(profiles::FindInput(p.left, p.leftCount, "/input/grip", XR_ACTION_TYPE_POSE_INPUT) != nullptr);
+        CHECK(profiles::FindInput(p.right, p.rightCount, "/input/aim", XR_ACTION_TYPE_POSE_INPUT) != nullptr);
+    }
+    CHECK(profiles::kButtonCount == 19);
+}
+
+} // namespace
+
+int main() {
+    TestExactPaths();
+    TestIdentifierOnly();
+    TestDefaultComponents();
+    TestProfileTables();
+    return testutil::Finish();
+}
@@ -0,0 +1,150 @@
+// Tests for path_interner.h
+// IDs stay dense across index rehashes, entry chunk and arena block boundaries, and readers never need the writer's lock
+
+#include "path_interner.h"
+#include "test_common.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::string PathFor(uint32_t i) {
+    return "/user/test/input/" + std::to_string(i) + "/value";
+}
+
+void TestWellFormed() {
+    CHECK(paths::IsWellFormed("/user/hand/left"));
+    CHECK(!paths::IsWellFormed(""));
+    CHECK(!paths::IsWellFormed("user/hand"));
+    CHECK(!paths::IsWellFormed("/user/hand/"));
+    CHECK(!paths::IsWellFormed("/user//hand"));
+    CHECK(!paths::IsWellFormed(std::string(XR_MAX_PATH_LENGTH, 'a').insert(0, "/")));
+}
+
+void TestPreinternedAndNull() {
+    paths::Interner interner{ "/user/hand/left", "/user/hand/right", "/user/head" };
+    CHECK(interner.Size() == 3);
+    CHECK(interner.Find("/user/hand/left") == 1);
+    CHECK(interner.Find("/user/head") == 3);
+    CHECK(interner.Intern("/user/hand/right") == 2);
+    CHECK(interner.Size() == 3);
+    CHECK(interner.View(XR_NULL_PATH).empty());
+    CHECK(interner.View(4).empty());
+    CHECK(!interner.Contains(XR_NULL_PATH));
+    CHECK(!interner.Contains(4));
+    CHECK(interner.Find("/user/gamepad") == XR_NULL_PATH);
+}
+
+void TestDenseIdsAcrossRehashAndChunks() {
+    // Several index rehashes (256, 512, ... slots) and entry chunks (256, 512, 1024, ... entries)
+    constexpr uint32_t kCount = 5000;
+    paths::Interner interner;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        const XrPath id = interner.Intern(PathFor(i));
+        CHECK(id == (XrPath)(i + 1));
+        // Interning again is a lookup
+        CHECK(interner.Intern(PathFor(i)) == id);
+    }
+    CHECK(interner.Size() == kCount);
+    int wrong = 0;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        if (interner.Find(PathFor(i)) != (XrPath)(i + 1)) ++wrong;
+        if (interner.View(i + 1) != PathFor(i)) ++wrong;
+    }
+    CHECK(wrong == 0);
+    // Entries right at chunk edges
+    for (uint32_t edge : { 255u, 256u, 767u, 768u, 1791u, 1792u, 3839u, 3840u }) {
+        CHECK(interner.View(edge + 1) == PathFor(edge));
+    }
+    CHECK(interner.Find(PathFor(kCount)) == XR_NULL_PATH);
+}
+
+void TestArenaGrowthKeepsViews() {
+    // Longest legal paths fill a 4 KB arena block every few strings; earlier views must not move
+    paths::Interner interner;
+    std::vector<std::string_view> views;
+    std::vector<std::string> expected;
+    for (uint32_t i = 0; i < 200; ++i) {
+        std::string path = "/" + std::to_string(i) + "/";
+        path.append(XR_MAX_PATH_LENGTH - 1 - path.size(), 'x');
+        CHECK(paths::IsWellFormed(path));
+        expected.push_back(path);
+        views.push_back(interner.View(interner.Intern(path)));
+    }
+    for (size_t i = 0; i < views.size(); ++i) {
+        CHECK(views[i] == expected[i]);
+        CHECK(views[i].data() == interner.View((XrPath)(i + 1)).data());
+        CHECK(views[i].data()[views[i].size()] == '\0');  // Null-terminated for xrPathToString
+    }
+}
+
+void TestReadersDuringInterning() {
+    // One writer interns while readers resolve everything published so far, with no lock on their side
+    constexpr uint32_t kCount = 20000;
+    paths::Interner interner;
+    std::atomic<bool> done{ false };
+    std::atomic<int> errors{ 0 };
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&, r] {
+            uint32_t probe = (uint32_t)r;
+            while (!done.load(std::memory_order_acquire)) {
+                const uint32_t size = (uint32_t)interner.Size();
+                if (size == 0) continue;
+                probe = (probe * 2654435761u + 1) % size;
+                const std::string expected = PathFor(probe);
+                if (interner.View(probe + 1) != expected) errors.fetch_add(1);
+                // A reader still on a retired index may miss the newest path, never return a wrong one
+                const XrPath found = interner.Find(expected);
+                if (found != XR_NULL_PATH && found != probe + 1) errors.fetch_add(1);
+                if (probe + 1 < size / 2 && found != probe + 1) errors.fetch_add(1);
+            }
+        });
+    }
+    for (uint32_t i = 0; i < kCount; ++i) interner.Intern(PathFor(i));
+    done.store(true, std::memory_order_release);
+    for (std::thread& t : readers) t.join();
+    CHECK(errors.load() == 0);
+    CHECK(interner.Size() == kCount);
+}
+
+void TestConcurrentWritersAgree() {
+    // Threads interning overlapping sets get one ID per string
+    constexpr uint32_t kCount = 3000;
+    paths::Interner interner;
+    std::vector<std::vector<XrPath>> ids(4, std::vector<XrPath>(kCount));
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&, w] {
+            for (uint32_t i = 0; i < kCount; ++i) {
+                const uint32_t n = (w & 1) ? kCount - 1 - i : i;
+                ids[w][n] = interner.Intern(PathFor(n));
+            }
+        });
+    }
+    for (std::thread& t : writers) t.join();
+    CHECK(interner.Size() == kCount);
+    int mismatches = 0;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        for (int w = 1; w < 4; ++w) {
+            if (ids[w][i] != ids[0][i]) ++mismatches;
+        }
+        if (interner.View(ids[0][i]) != PathFor(i)) ++mismatches;
+    }
+    CHECK(mismatches == 0);
+}
+
+} // namespace
+
+int main() {
+    TestWellFormed();
+    TestPreinternedAndNull();
+    TestDenseIdsAcrossRehashAndChunks();
+    TestArenaGrowthKeepsViews();
+    TestReadersDuringInterning();
+    TestConcurrentWritersAgree();
+    return testutil::Finish();
+}
@@ -0,0 +1,73 @@
+// Tests for proc_dispatch.h
+// Every name in OXRWXR_RUNTIME_FUNCTIONS must find itself, and nothing else may find anything
+
+#include "proc_dispatch.h"
+#include "runtime_functions.h"
+#include "test_common.h"
+
+#include <string>
+#include <string_view>
+
+namespace {
+
+#define OXRWXR_FN_NAME(fn) #fn,
+constexpr std::string_view kFnNames[] = { OXRWXR_RUNTIME_FUNCTIONS(OXRWXR_FN_NAME) };
+#undef OXRWXR_FN_NAME
+constexpr size_t kCount = std::size(kFnNames);
+constexpr auto kFnHash = procdispatch::Build(kFnNames);
+static_assert(kFnHash.Ok(), "OXRWXR_RUNTIME_FUNCTIONS lists a function twice");
+
+// Resolved at compile time too
+static_assert(kFnHash.Find("xrGetInstanceProcAddr") == 0, "first entry point");
+static_assert(kFnHash.Find("xrNotAFunction") == kCount, "unknown entry point");
+
+void TestEveryNameRoundTrips() {
+    for (size_t i = 0; i < kCount; ++i) {
+        CHECK(kFnHash.Find(kFnNames[i]) == i);
+        // From a NUL-terminated copy, the way the loader passes it
+        const std::string copy(kFnNames[i]);
+        CHECK(kFnHash.Find(copy.c_str()) == i);
+    }
+}
+
+void TestNearMissesAreRejected() {
+    int found = 0;
+    for (size_t i = 0; i < kCount; ++i) {
+        const std::string name(kFnNames[i]);
+        if (kFnHash.Find(name.substr(0, name.size() - 1)) != kCount) ++found;
+        if (kFnHash.Find(name + "KHR") != kCount) ++found;
+        if (kFnHash.Find(name + std::string(1, '\0')) != kCount) ++found;
+        for (size_t c = 0; c < name.size(); ++c) {
+            std::string changed = name;
+            changed[c] = (char)(changed[c] ^ 0x20);  // Case flip, or a different punctuation character
+            if (kFnHash.Find(changed) != kCount) ++found;
+        }
+    }
+    CHECK(found == 0);
+    CHECK(kFnHash.Find("") == kCount);
+    // Real OpenXR functions the runtime doesn't implement
+    CHECK(kFnHash.Find("xrCreateFoveationProfileFB") == kCount);
+    CHECK(kFnHash.Find("xrGetVulkanGraphicsRequirementsKHR") == kCount);
+    CHECK(kFnHash.Find("xrEnumerateDisplayRefreshRatesFB") == kCount);
+}
+
+void TestDuplicatesAreReported() {
+    constexpr std::string_view dup[] = { "xrA", "xrB", "xrA" };
+    constexpr auto hash = procdispatch::Build(dup);
+    static_assert(!hash.Ok(), "duplicate names can't be placed");
+
+    constexpr std::string_view one[] = { "xrOnly" };
+    constexpr auto single = procdispatch::Build(one);
+    static_assert(single.Ok(), "single name");
+    CHECK(single.Find("xrOnly") == 0);
+    CHECK(single.Find("xrOther") == 1);
+}
+
+} // namespace
+
+int main() {
+    TestEveryNameRoundTrips();
+    TestNearMissesAreRejected();
+    TestDuplicatesAreReported();
+    return testutil::Finish();
+}
@@ -0,0 +1,152 @@
+// Tests for readback_ring.h
+// A fake GPU finishes each queued copy a fixed number of frames after it was queued
+
+#include "readback_ring.h"
+#include "test_common.h"
+
+namespace {
+
+struct FakeSlot {
+    int frame{ -1 };        // Frame whose copy sits in the slot
+    int readyAt{ -1 };      // Frame at which the fake GPU has finished it
+};
+
+using Ring = readback::Ring<FakeSlot, 2>;
+
+struct Shown {
+    int frame{ -1 };
+    int superseded{ 0 };
+};
+
+// One runtime frame: queue this frame's copy, show the previous one if the GPU is done with it
+bool Step(Ring& ring, int frame, int latency, Shown& shown) {
+    bool superseded = false;
+    FakeSlot& slot = ring.Queue(superseded);
+    if (superseded) ++shown.superseded;
+    slot.frame = frame;
+    slot.readyAt = frame + latency;
+
+    FakeSlot* previous = ring.Previous();
+    if (!previous) return false;
+    CHECK(previous != &slot);
+    CHECK(previous->frame == frame - 1);
+    if (previous->readyAt > frame) {
+        ring.Late();
+        return false;
+    }
+    shown.frame = previous->frame;
+    ring.Consumed(*previous);
+    return true;
+}
+
+void TestConfigure() {
+    Ring ring;
+    CHECK(ring.Configure(64, 32));
+    CHECK(!ring.Configure(64, 32));
+    CHECK(ring.Width() == 64 && ring.Height() == 32);
+    CHECK(ring.Configure(128, 32));
+    ring.Reset();
+    CHECK(ring.Width() == 0 && ring.Height() == 0);
+}
+
+void TestFirstFrameHasNothingToShow() {
+    Ring ring;
+    ring.Configure(16, 16);
+    Shown shown;
+    CHECK(!Step(ring, 0, 0, shown));
+    CHECK(ring.LateFrames() == 0);
+}
+
+void TestOneFrameBehind() {
+    // Copies finish within the frame (or by the next one): every frame shows the one before it
+    for (int latency = 0; latency <= 1; ++latency) {
+        Ring ring;
+        ring.Configure(16, 16);
+        Shown shown;
+        Step(ring, 0, latency, shown);
+        for (int frame = 1; frame < 100; ++frame) {
+            CHECK(Step(ring, frame, latency, shown));
+            CHECK(shown.frame == frame - 1);
+        }
+        CHECK(shown.superseded == 0);
+        CHECK(ring.LateFrames() == 0);
+    }
+}
+
+void TestSlowGpuIsLateAndSupersedes() {
+    // A copy that takes two frames is never waited on: the preview keeps its image and the slot is reused
+    Ring ring;
+    ring.Configure(16, 16);
+    Shown shown;
+    Step(ring, 0, 2, shown);
+    for (int frame = 1; frame < 10; ++frame) CHECK(!Step(ring, frame, 2, shown));
+    CHECK(shown.frame == -1);
+    CHECK(ring.LateFrames() == 9);
+    CHECK(shown.superseded == 8);
+}
+
+void TestRecoversAfterLateFrame() {
+    Ring ring;
+    ring.Configure(16, 16);
+    Shown shown;
+    Step(ring, 0, 0, shown);
+    CHECK(Step(ring, 1, 2, shown));     // Shows frame 0; frame 1's copy is slow
+    CHECK(shown.frame == 0);
+    CHECK(!Step(ring, 2, 0, shown));    // Frame 1 not ready: late, frame 0 stays up
+    CHECK(ring.LateFrames() == 1);
+    CHECK(Step(ring, 3, 0, shown));     // Frame 1's slot was superseded by frame 3; frame 2 is shown
+    CHECK(shown.frame == 2);
+    CHECK(shown.superseded == 1);
+}
+
+void TestConsumedSlotIsNotShownTwice() {
+    Ring ring;
+    ring.Configure(16, 16);
+    Shown shown;
+    Step(ring, 0, 0, shown);
+    CHECK(Step(ring, 1, 0, shown));
+    FakeSlot* previous = ring.Previous();
+    CHECK(previous == nullptr);
+}
+
+void TestResizeForgetsQueuedCopies() {
+    Ring ring;
+    ring.Configure(16, 16);
+    Shown shown;
+    Step(ring, 0, 0, shown);
+    Step(ring, 1, 0, shown);
+    CHECK(ring.Configure(32, 16));
+    // The copies queued at the old size are gone: no supersede, nothing to show on the first frame
+    CHECK(!Step(ring, 2, 0, shown));
+    CHECK(shown.superseded == 0);
+    CHECK(Step(ring, 3, 0, shown));
+    CHECK(shown.frame == 2);
+}
+
+void TestSlotsAlternate() {
+    readback::Ring<FakeSlot, 3> ring;
+    ring.Configure(8, 8);
+    bool superseded = false;
+    FakeSlot* a = &ring.Queue(superseded);
+    FakeSlot* b = &ring.Queue(superseded);
+    FakeSlot* c = &ring.Queue(superseded);
+    CHECK(a != b && b != c && a != c);
+    CHECK(ring.Previous() == b);
+    CHECK(&ring.Queue(superseded) == a);
+    CHECK(superseded);
+    CHECK(ring.Queued(*c));
+}
+
+} // namespace
+
+int main() {
+    TestConfigure();
+    TestFirstFrameHasNothingToShow();
+    TestOneFrameBehind();
+    TestSlowGpuIsLateAndSupersedes();
+    TestRecoversAfterLateFrame();
+    TestConsumedSlotIsNotShownTwice();
+    TestResizeForgetsQueuedCopies();
+    TestSlotsAlternate();
+    return testutil::Finish();
+}
@@ -0,0 +1,148 @@
+// Tests for resolution_governor.h
+// A synthetic GPU whose frame time is a fixed overhead plus a cost proportional to the pixel count drives the governor
+
+#include "resolution_governor.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+constexpr double kBudgetNs = 1e9 / 90.0;
+
+// Frame time at a given per-axis scale: overhead + fullCost * scale^2, both as fractions of the budget
+struct LoadModel {
+    double overhead;
+    double fullCost;
+    double FrameNs(float scale) const { return (overhead + fullCost * (double)scale * scale) * kBudgetNs; }
+};
+
+struct Run {
+    uint32_t changes{ 0 };
+    uint32_t lastChange{ 0 };
+    float minSeen{ 10.0f };
+    float maxSeen{ 0.0f };
+    bool onGrid{ true };
+};
+
+Run Drive(resgov::Governor& gov, const LoadModel& load, uint32_t frames) {
+    Run run;
+    const resgov::Config& c = gov.GetConfig();
+    for (uint32_t f = 0; f < frames; ++f) {
+        if (gov.Update(load.FrameNs(gov.Scale()), kBudgetNs)) {
+            ++run.changes;
+            run.lastChange = f;
+        }
+        run.minSeen = std::fmin(run.minSeen, gov.Scale());
+        run.maxSeen = std::fmax(run.maxSeen, gov.Scale());
+        const float steps = gov.Scale() / c.step;
+        if (std::fabs(steps - std::round(steps)) > 1e-3f) run.onGrid = false;
+    }
+    return run;
+}
+
+void TestLightLoadStaysAtFullScale() {
+    resgov::Governor gov;
+    const Run run = Drive(gov, { 0.1, 0.4 }, 1000);
+    CHECK(run.changes == 0);
+    CHECK(gov.Scale() == gov.GetConfig().maxScale);
+    CHECK_NEAR(gov.Utilization(), 0.5, 1e-3);
+}
+
+void TestHeavyLoadConvergesIntoBand() {
+    // Twice the budget at full scale: the governor must settle below the down threshold and stay there
+    resgov::Governor gov;
+    const LoadModel load{ 0.1, 1.9 };
+    const Run run = Drive(gov, load, 3000);
+    const resgov::Config& c = gov.GetConfig();
+    CHECK(run.changes > 0);
+    CHECK(run.onGrid);
+    CHECK(run.minSeen >= c.minScale && run.maxSeen <= c.maxScale);
+    CHECK(gov.Scale() < c.maxScale);
+    const double settled = load.FrameNs(gov.Scale()) / kBudgetNs;
+    CHECK(settled <= c.downThreshold);
+    // No oscillation: once settled, the scale holds
+    const Run after = Drive(gov, load, 2000);
+    CHECK(after.changes == 0);
+    // Settles within a few seconds at 90 Hz
+    CHECK(run.lastChange < 900);
+}
+
+void TestOverloadClampsAtMinimum() {
+    resgov::Governor gov;
+    Drive(gov, { 1.5, 4.0 }, 2000);
+    CHECK(gov.Scale() == gov.GetConfig().minScale);
+}
+
+void TestRecoversWhenLoadDrops() {
+    resgov::Governor gov;
+    Drive(gov, { 0.1, 1.9 }, 2000);
+    const float low = gov.Scale();
+    CHECK(low < 1.0f);
+    // Scaling up is one step per hold period, so give it enough frames for every step
+    const resgov::Config& c = gov.GetConfig();
+    const uint32_t steps = (uint32_t)std::ceil((c.maxScale - low) / c.step) + 1;
+    const Run run = Drive(gov, { 0.1, 0.3 }, steps * (c.upHoldFrames + c.cooldownFrames) + 200);
+    CHECK(gov.Scale() == c.maxScale);
+    CHECK(run.onGrid);
+}
+
+void TestSpikeDoesNotScaleDown() {
+    // One long frame among light ones moves the average but not past the threshold
+    resgov::Governor gov;
+    const LoadModel light{ 0.1, 0.5 };
+    Drive(gov, light, 100);
+    CHECK(!gov.Update(3.0 * kBudgetNs, kBudgetNs));
+    Drive(gov, light, 100);
+    CHECK(gov.Scale() == gov.GetConfig().maxScale);
+}
+
+void TestInvalidSamplesIgnored() {
+    resgov::Governor gov;
+    CHECK(!gov.Update(1e6, 0.0));
+    CHECK(!gov.Update(-1.0, kBudgetNs));
+    CHECK(gov.Utilization() == 0.0);
+}
+
+void TestResetRestoresFullScale() {
+    resgov::Governor gov;
+    Drive(gov, { 0.1, 1.9 }, 1000);
+    CHECK(gov.Scale() < 1.0f);
+    gov.Reset();
+    CHECK(gov.Scale() == gov.GetConfig().maxScale);
+    CHECK(gov.Utilization() == 0.0);
+    // The first sample after a reset primes the average instead of being blended with the old one
+    gov.Update(0.5 * kBudgetNs, kBudgetNs);
+    CHECK_NEAR(gov.Utilization(), 0.5, 1e-9);
+}
+
+void TestExtentAndBaselines() {
+    resgov::Governor gov;
+    uint32_t w = 0, h = 0;
+    gov.Extent(1600, 900, w, h);
+    CHECK(w == 1600 && h == 896);
+    Drive(gov, { 0.1, 1.9 }, 1000);
+    gov.Extent(1600, 900, w, h);
+    CHECK(w % 8 == 0 && h % 8 == 0);
+    CHECK(w < 1600 && w >= 8 && h >= 8);
+
+    CHECK(resgov::FindBaseline("META", "QUEST 3").width == 1600);
+    CHECK(resgov::FindBaseline("META", "QUEST 2").width == 1280);
+    CHECK(resgov::FindBaseline("PICO", "4 ULTRA").width == 1280);
+    CHECK(&resgov::FindBaseline("ACME", "X") == &resgov::kDefaultBaseline);
+}
+
+} // namespace
+
+int main() {
+    TestLightLoadStaysAtFullScale();
+    TestHeavyLoadConvergesIntoBand();
+    TestOverloadClampsAtMinimum();
+    TestRecoversWhenLoadDrops();
+    TestSpikeDoesNotScaleDown();
+    TestInvalidSamplesIgnored();
+    TestResetRestoresFullScale();
+    TestExtentAndBaselines();
+    return testutil::Finish();
+}
@@ -0,0 +1,152 @@
+// Tests for visibility_mask.h
+// The hidden and visible meshes must tile the view rect exactly, with every triangle wound counter-clockwise
+
+#include "visibility_mask.h"
+#include "test_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+XrFovf Fov(float left, float right, float up, float down) {
+    XrFovf fov;
+    fov.angleLeft = left;
+    fov.angleRight = right;
+    fov.angleUp = up;
+    fov.angleDown = down;
+    return fov;
+}
+
+// Symmetric, a typical canted-display left eye, and a narrow asymmetric one
+const XrFovf kFovs[] = {
+    Fov(-0.785f, 0.785f, 0.785f, -0.785f),
+    Fov(-0.942f, 0.698f, 0.768f, -0.873f),
+    Fov(-0.3f, 0.5f, 0.2f, -0.6f),
+};
+
+double SignedArea(const XrVector2f& a, const XrVector2f& b, const XrVector2f& c) {
+    return 0.5 * (((double)b.x - a.x) * ((double)c.y - a.y) - ((double)c.x - a.x) * ((double)b.y - a.y));
+}
+
+struct MeshArea {
+    double total{ 0.0 };
+    double mostNegative{ 0.0 };
+};
+
+MeshArea Area(const vismask::Mesh& mesh) {
+    MeshArea area;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        const double a = SignedArea(mesh.vertices[mesh.indices[i]], mesh.vertices[mesh.indices[i + 1]], mesh.vertices[mesh.indices[i + 2]]);
+        area.total += a;
+        area.mostNegative = std::fmin(area.mostNegative, a);
+    }
+    return area;
+}
+
+// Triangles of the mesh that strictly contain p
+int Covering(const vismask::Mesh& mesh, const XrVector2f& p) {
+    int n = 0;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        const XrVector2f& a = mesh.vertices[mesh.indices[i]];
+        const XrVector2f& b = mesh.vertices[mesh.indices[i + 1]];
+        const XrVector2f& c = mesh.vertices[mesh.indices[i + 2]];
+        if (SignedArea(a, b, p) > 0.0 && SignedArea(b, c, p) > 0.0 && SignedArea(c, a, p) > 0.0) ++n;
+    }
+    return n;
+}
+
+void CheckMeshes(const vismask::LensProfile& lens, const XrFovf& fov, float nasalSign, uint32_t samples) {
+    const vismask::Meshes m = vismask::Generate(lens, fov, nasalSign, samples);
+    const double left = std::tan(fov.angleLeft), right = std::tan(fov.angleRight);
+    const double down = std::tan(fov.angleDown), up = std::tan(fov.angleUp);
+    const double rect = (right - left) * (up - down);
+
+    CHECK(m.hidden.indices.size() % 3 == 0 && m.visible.indices.size() % 3 == 0);
+    for (uint32_t i : m.hidden.indices) CHECK(i < m.hidden.vertices.size());
+    for (uint32_t i : m.visible.indices) CHECK(i < m.visible.vertices.size());
+
+    // No clockwise triangles (degenerate slivers along the clipped border may be zero)
+    const MeshArea hidden = Area(m.hidden), visible = Area(m.visible);
+    CHECK(hidden.mostNegative >= -1e-6 * rect);
+    CHECK(visible.mostNegative >= -1e-6 * rect);
+
+    // Hidden plus visible covers the rect exactly
+    CHECK_NEAR((hidden.total + visible.total) / rect, 1.0, 1e-4);
+    CHECK_NEAR(visible.total / rect, m.visibleFraction, 1e-4);
+    CHECK(m.visibleFraction > 0.5f && m.visibleFraction <= 1.0f);
+
+    // Every vertex stays inside the rect
+    for (const XrVector2f& v : m.hidden.vertices) {
+        CHECK(v.x >= left - 1e-5 && v.x <= right + 1e-5 && v.y >= down - 1e-5 && v.y <= up + 1e-5);
+    }
+
+    // Line loop is the visible outline in order
+    CHECK(m.lineLoop.indices.size() == m.lineLoop.vertices.size());
+    CHECK(m.lineLoop.vertices.size() + 1 == m.visible.vertices.size());
+
+    // Sample points are covered by exactly one triangle of the two meshes together
+    int overlaps = 0, gaps = 0;
+    for (uint32_t y = 0; y < 23; ++y) {
+        for (uint32_t x = 0; x < 29; ++x) {
+            const XrVector2f p{ (float)(left + (right - left) * (x + 0.37) / 29.0), (float)(down + (up - down) * (y + 0.61) / 23.0) };
+            const int n = Covering(m.hidden, p) + Covering(m.visible, p);
+            if (n > 1) ++overlaps;
+            if (n == 0) ++gaps;
+        }
+    }
+    CHECK(overlaps == 0);
+    CHECK(gaps == 0);
+}
+
+void TestAllProfilesTileTheRect() {
+    for (const XrFovf& fov : kFovs) {
+        for (float nasalSign : { 1.0f, -1.0f, 0.0f }) {
+            for (uint32_t samples : { 4u, 16u, 64u }) {
+                for (const vismask::LensProfile& lens : vismask::kLensProfiles) CheckMeshes(lens, fov, nasalSign, samples);
+                CheckMeshes(vismask::kDefaultLens, fov, nasalSign, samples);
+            }
+        }
+    }
+}
+
+void TestNasalShiftMirrors() {
+    const vismask::LensProfile& lens = vismask::FindLens("META", "QUEST 2");
+    const vismask::Meshes l = vismask::Generate(lens, kFovs[0], 1.0f);
+    const vismask::Meshes r = vismask::Generate(lens, kFovs[0], -1.0f);
+    CHECK_NEAR(l.visibleFraction, r.visibleFraction, 1e-5);
+    // Left eye's lens centre sits toward the nose, i.e. right
+    CHECK(l.visible.vertices[0].x > 0.0f);
+    CHECK_NEAR(l.visible.vertices[0].x, -r.visible.vertices[0].x, 1e-6);
+}
+
+void TestFresnelHidesMoreThanPancake() {
+    const vismask::Meshes fresnel = vismask::Generate(vismask::FindLens("META", "QUEST 2"), kFovs[0], 1.0f);
+    const vismask::Meshes pancake = vismask::Generate(vismask::FindLens("META", "QUEST 3"), kFovs[0], 1.0f);
+    CHECK(fresnel.visibleFraction < pancake.visibleFraction);
+    CHECK(&vismask::FindLens("ACME", "X") == &vismask::kDefaultLens);
+}
+
+void TestCache() {
+    vismask::Cache cache;
+    const vismask::LensProfile& lens = vismask::kDefaultLens;
+    // References are only good until the next miss, so compare copies
+    const vismask::Meshes* a = &cache.Get(lens, kFovs[0], 1.0f);
+    const size_t vertices = a->visible.vertices.size();
+    const float firstX = a->visible.vertices[1].x;
+    CHECK(&cache.Get(lens, kFovs[0], 1.0f) == a);
+    CHECK(cache.Get(lens, kFovs[0], -1.0f).visible.vertices.size() == vertices);
+    CHECK(cache.Get(lens, kFovs[1], 1.0f).visible.vertices[1].x != firstX);
+    CHECK(cache.Get(lens, kFovs[0], 1.0f).visible.vertices[1].x == firstX);
+}
+
+} // namespace
+
+int main() {
+    TestAllProfilesTileTheRect();
+    TestNasalShiftMirrors();
+    TestFresnelHidesMoreThanPancake();
+    TestCache();
+    return testutil::Finish();
+}